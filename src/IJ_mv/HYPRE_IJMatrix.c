@@ -45,6 +45,8 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixSlotMap(ijmatrix)        = NULL;
+   hypre_IJMatrixStream(ijmatrix)         = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -660,6 +662,11 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
          hypre_IJMatrixAddToValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
       }
 
+      if (hypre_IJMatrixStreamActive(ijmatrix))
+      {
+         hypre_IJMatrixStreamProgressParCSR(ijmatrix);
+      }
+
       if (!ncols)
       {
          hypre_TFree(ncols_tmp, HYPRE_MEMORY_HOST);
@@ -711,6 +718,103 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetValueSlots( HYPRE_IJMatrix      matrix,
+                             HYPRE_Int           npairs,
+                             const HYPRE_BigInt *rows,
+                             const HYPRE_BigInt *cols )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (npairs < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (npairs > 0 && !rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (npairs > 0 && !cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR ||
+        !hypre_IJMatrixAssembleFlag(ijmatrix) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   if (hypre_GetExecPolicy1( hypre_IJMatrixMemoryLocation(ijmatrix) ) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Value slots are not supported for device matrices");
+      return hypre_error_flag;
+   }
+#endif
+
+   return ( hypre_IJMatrixSetValueSlotsParCSR( ijmatrix, npairs, rows, cols ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddToValueSlots( HYPRE_IJMatrix       matrix,
+                               HYPRE_Int            first,
+                               HYPRE_Int            nvalues,
+                               const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (nvalues == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!ijmatrix || !hypre_IJMatrixSlotMap(ijmatrix))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (first < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nvalues < 0 ||
+       first + nvalues > hypre_IJSlotMapNumPairs(hypre_IJMatrixSlotMap(ijmatrix)))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!values)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_IJMatrixAddToValueSlotsParCSR( ijmatrix, first, nvalues, values ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1009,6 +1113,39 @@ HYPRE_IJMatrixSetMaxOffProcElmts( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetOffProcStreaming( HYPRE_IJMatrix matrix,
+                                   HYPRE_Int      chunk_size )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (chunk_size < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+   {
+      return ( hypre_IJMatrixSetOffProcStreamingParCSR(ijmatrix, chunk_size) );
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixRead
  * create IJMatrix on host memory
@@ -197,6 +197,39 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * Freezes the pattern of an assembled matrix for repeated assembly.  The
+ * arrays \e rows and \e cols of length \e npairs list (row, column) pairs,
+ * for example the element matrix entries of a finite element mesh in
+ * element order.  Each pair must be in the assembled pattern, on this or on
+ * another processor, and may appear more than once.  The position of the
+ * value of each pair is computed once here, so that
+ * \ref HYPRE_IJMatrixAddToValueSlots can add values without any searching.
+ * Calling this again replaces the previous list.
+ *
+ * Host memory only.  Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetValueSlots(HYPRE_IJMatrix      matrix,
+                                      HYPRE_Int           npairs,
+                                      const HYPRE_BigInt *rows,
+                                      const HYPRE_BigInt *cols);
+
+/**
+ * Adds \e nvalues values to the pairs \e first, ..., \e first + \e nvalues - 1
+ * of the list given to \ref HYPRE_IJMatrixSetValueSlots.  Values for pairs
+ * owned by other processors are accumulated locally and sent at the next
+ * \ref HYPRE_IJMatrixAssemble.  Calls may be made concurrently from
+ * several threads.  To re-assemble, zero the matrix with
+ * \ref HYPRE_IJMatrixSetConstantValues, add the new values and call
+ * \ref HYPRE_IJMatrixAssemble.
+ *
+ * Not collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixAddToValueSlots(HYPRE_IJMatrix       matrix,
+                                        HYPRE_Int            first,
+                                        HYPRE_Int            nvalues,
+                                        const HYPRE_Complex *values);
+
 /**
  * Gets number of nonzeros elements for \e nrows rows specified in \e rows
  * and returns them in \e ncols, which needs to be allocated by the
@@ -295,6 +328,22 @@ HYPRE_Int HYPRE_IJMatrixSetDiagOffdSizes(HYPRE_IJMatrix   matrix,
 HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts(HYPRE_IJMatrix matrix,
                                            HYPRE_Int      max_off_proc_elmts);
 
+/**
+ * (Optional) Streams entries added to rows of other processors.  With
+ * \e chunk_size > 0, such entries are gathered per destination processor
+ * and sent as soon as \e chunk_size of them are collected, while the
+ * caller keeps adding values; received entries are merged into the matrix
+ * during later calls to \ref HYPRE_IJMatrixAddToValues.  This overlaps the
+ * exchange with the computation of the values and bounds the memory used
+ * for off-processor entries.  A value of 0 (the default) buffers all such
+ * entries until \ref HYPRE_IJMatrixAssemble.  Only \ref
+ * HYPRE_IJMatrixAddToValues entries are streamed.
+ *
+ * Host memory only.  Must be called with the same value on all processors.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetOffProcStreaming(HYPRE_IJMatrix matrix,
+                                            HYPRE_Int      chunk_size);
+
 /**
  * (Optional) Sets the print level, if the user wants to print
  * error messages. The default is 0, i.e. no error messages are printed.
@@ -671,6 +671,10 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
 
    if (hypre_IJMatrixAssembleFlag(matrix))  /* matrix already assembled*/
    {
+      /* values change in place: drop the SELL-C-sigma layouts */
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
       HYPRE_Int j_offd;
@@ -1033,6 +1037,9 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_CSRMatrixSellDestroy(diag);
+   hypre_CSRMatrixSellDestroy(offd);
+
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -1143,6 +1150,10 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
    first = hypre_IJMatrixGlobalFirstCol(matrix);
    if (hypre_IJMatrixAssembleFlag(matrix))
    {
+      /* values change in place: drop the SELL-C-sigma layouts */
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
       HYPRE_Int num_cols_offd;
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int j_offd;
@@ -1276,6 +1287,11 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
                indx++;
             }
          }
+         /* not my row, streamed to its owner */
+         else if (hypre_IJMatrixStreamActive(matrix))
+         {
+            hypre_IJMatrixStreamAddParCSR(matrix, row, n, &cols[indx], &values[indx]);
+         }
          /* not my row */
          else
          {
@@ -1541,6 +1557,11 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
 
             }
          }
+         /* not my row, streamed to its owner */
+         else if (hypre_IJMatrixStreamActive(matrix))
+         {
+            hypre_IJMatrixStreamAddParCSR(matrix, row, n, &cols[indx], &values[indx]);
+         }
          /* not my row */
          else
          {
@@ -1611,10 +1632,14 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_IJSlotMapDestroy(hypre_IJMatrixSlotMap(matrix));
+   hypre_IJStreamDestroy(hypre_IJMatrixStream(matrix));
 
    /* Reset pointers to NULL */
    hypre_IJMatrixObject(matrix)     = NULL;
    hypre_IJMatrixTranslator(matrix) = NULL;
+   hypre_IJMatrixSlotMap(matrix)    = NULL;
+   hypre_IJMatrixStream(matrix)     = NULL;
 
    return hypre_error_flag;
 }
@@ -2551,6 +2576,20 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* values added through a slot map to rows of other processors */
+   if (hypre_IJMatrixAssembleFlag(matrix) && hypre_IJMatrixSlotMap(matrix))
+   {
+      hypre_IJMatrixAssembleValueSlotsParCSR(matrix);
+   }
+
+   /* streamed off-processor entries; received entries of rows owned by
+    * another processor may create the translator */
+   if (hypre_IJMatrixStream(matrix))
+   {
+      hypre_IJMatrixStreamFinalizeParCSR(matrix);
+      aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   }
+
    max_num_threads = hypre_NumThreads();
 
    /* first find out if anyone has an aux_matrix, and create one if you don't
@@ -2915,6 +2954,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       hypre_CSRMatrixSetRownnz(offd);
    }
 
+   /* Values may have been changed in place: drop the SELL-C-sigma layouts */
+   hypre_CSRMatrixSellDestroy(diag);
+   hypre_CSRMatrixSellDestroy(offd);
+
    /* Free memory */
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
@@ -3011,6 +3054,10 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
 
    if (hypre_IJMatrixAssembleFlag(matrix))  /* matrix already assembled*/
    {
+      /* values change in place: drop the SELL-C-sigma layouts */
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
 
@@ -3654,6 +3701,10 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    first = hypre_IJMatrixGlobalFirstCol(matrix);
    if (hypre_IJMatrixAssembleFlag(matrix)) /* matrix already assembled */
    {
+      /* values change in place: drop the SELL-C-sigma layouts */
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
       HYPRE_Int num_cols_offd;
       HYPRE_BigInt *col_map_offd;
 
@@ -3683,6 +3734,8 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       #pragma omp parallel
 #endif
       {
+         /* the pattern is frozen, so rows shared by several threads only
+          * need atomic adds, which are skipped when running on one thread */
          HYPRE_Int j_offd;
          HYPRE_Int num_threads, my_thread_num;
          HYPRE_Int len, rest, ns, ne;
@@ -3774,7 +3827,17 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                      {
                         if (offd_j[j] == j_offd)
                         {
-                           offd_data[j] += values[indx];
+                           if (num_threads > 1)
+                           {
+#ifdef HYPRE_USING_OPENMP
+                              #pragma omp atomic
+#endif
+                              offd_data[j] += values[indx];
+                           }
+                           else
+                           {
+                              offd_data[j] += values[indx];
+                           }
                            not_found = 0;
                            break;
                         }
@@ -3814,7 +3877,17 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                         break;
                         /*return hypre_error_flag;*/
                      }
-                     diag_data[pos_diag] += values[indx];
+                     if (num_threads > 1)
+                     {
+#ifdef HYPRE_USING_OPENMP
+                        #pragma omp atomic
+#endif
+                        diag_data[pos_diag] += values[indx];
+                     }
+                     else
+                     {
+                        diag_data[pos_diag] += values[indx];
+                     }
                   }
                   else  /* insert into diag */
                   {
@@ -3822,7 +3895,17 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                      {
                         if (diag_j[j] == (HYPRE_Int)(cols[indx] - col_0))
                         {
-                           diag_data[j] += values[indx];
+                           if (num_threads > 1)
+                           {
+#ifdef HYPRE_USING_OPENMP
+                              #pragma omp atomic
+#endif
+                              diag_data[j] += values[indx];
+                           }
+                           else
+                           {
+                              diag_data[j] += values[indx];
+                           }
                            not_found = 0;
                            break;
                         }
@@ -3846,9 +3929,7 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                   indx++;
                }
             }
-            /* not my row */
-            /* need to find solution for threaded version!!!! */
-            /* could save row number and process later .... */
+            /* not my row, saved and merged into the stash below */
             else
             {
                if (!my_offproc_cnt)
@@ -3869,6 +3950,7 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
                {
                   size = my_offproc_cnt[0];
                   my_offproc_cnt = hypre_TReAlloc(my_offproc_cnt, HYPRE_Int, size + 200, HYPRE_MEMORY_HOST);
+                  offproc_cnt[my_thread_num] = my_offproc_cnt;
                   my_offproc_cnt[0] += 200;
                   my_offproc_cnt[i] = ii;
                   my_offproc_cnt[i + 1] = indx;
@@ -4176,74 +4258,1176 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       hypre_AuxParCSRMatrixNeedAux(aux_matrix) = 0;
       hypre_IJMatrixTranslator(matrix) = aux_matrix;
    }
-   for (i1 = 0; i1 < max_num_threads; i1++)
+   if (hypre_IJMatrixStreamActive(matrix))
    {
-      if (offproc_cnt[i1])
+      /* the stream is not thread safe */
+      for (i1 = 0; i1 < max_num_threads; i1++)
       {
-         HYPRE_Int *my_offproc_cnt = offproc_cnt[i1];
-         HYPRE_Int i, i2, ii, n, indx;
-         HYPRE_BigInt row;
-         for (i2 = 2; i2 < my_offproc_cnt[1]; i2 += 2)
+         if (offproc_cnt[i1])
          {
-            ii = my_offproc_cnt[i2];
-            row = rows[ii];
-            n = ncols ? ncols[ii] : 1;
-            if (n == 0) /* empty row */
+            HYPRE_Int *my_offproc_cnt = offproc_cnt[i1];
+            HYPRE_Int i2, ii;
+            for (i2 = 2; i2 < my_offproc_cnt[1]; i2 += 2)
             {
-               continue;
+               ii = my_offproc_cnt[i2];
+               hypre_IJMatrixStreamAddParCSR(matrix, rows[ii], ncols ? ncols[ii] : 1,
+                                             &cols[my_offproc_cnt[i2 + 1]],
+                                             &values[my_offproc_cnt[i2 + 1]]);
             }
-            indx = my_offproc_cnt[i2 + 1];
-            current_num_elmts
-               = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
-            max_off_proc_elmts
-               = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
-            off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
-            off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-            off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-            off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
+         }
+      }
+   }
+   else
+   {
+      /* merge the rows saved by each thread into the stash; a prefix sum over
+       * the threads gives each of them its own range */
+      HYPRE_Int *prefix_sum_workspace;
+      HYPRE_Int  num_off_rows, num_off_elmts;
 
-            if (!max_off_proc_elmts)
+      prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2 * (max_num_threads + 1), HYPRE_MEMORY_HOST);
+      current_num_elmts = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
+      off_proc_i_indx   = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel
+#endif
+      {
+         HYPRE_Int  num_threads   = hypre_NumActiveThreads();
+         HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int  my_num_rows   = 0;
+         HYPRE_Int  my_num_elmts  = 0;
+         HYPRE_Int *my_offproc_cnt;
+         HYPRE_Int  i, i2, t, ii, n, indx, row_indx, elmt_indx;
+
+         for (t = my_thread_num; t < max_num_threads; t += num_threads)
+         {
+            my_offproc_cnt = offproc_cnt[t];
+            if (my_offproc_cnt)
             {
-               max_off_proc_elmts = hypre_max(n, 1000);
-               hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix) =
-                  max_off_proc_elmts;
+               for (i2 = 2; i2 < my_offproc_cnt[1]; i2 += 2)
+               {
+                  ii = my_offproc_cnt[i2];
+                  my_num_rows++;
+                  my_num_elmts += ncols ? ncols[ii] : 1;
+               }
+            }
+         }
+
+         hypre_prefix_sum_pair(&my_num_rows, &num_off_rows, &my_num_elmts, &num_off_elmts,
+                               prefix_sum_workspace);
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp master
+#endif
+         {
+            max_off_proc_elmts = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
+            if (!max_off_proc_elmts && num_off_elmts)
+            {
+               max_off_proc_elmts = hypre_max(num_off_elmts, 1000);
                hypre_AuxParCSRMatrixOffProcI(aux_matrix)
                   = hypre_CTAlloc(HYPRE_BigInt, 2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
                hypre_AuxParCSRMatrixOffProcJ(aux_matrix)
                   = hypre_CTAlloc(HYPRE_BigInt, max_off_proc_elmts, HYPRE_MEMORY_HOST);
                hypre_AuxParCSRMatrixOffProcData(aux_matrix)
                   = hypre_CTAlloc(HYPRE_Complex, max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
-               off_proc_j = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
-               off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
             }
-            else if (current_num_elmts + n > max_off_proc_elmts)
+            else if (current_num_elmts + num_off_elmts > max_off_proc_elmts)
             {
-               max_off_proc_elmts += 3 * n;
-               off_proc_i = hypre_TReAlloc(off_proc_i, HYPRE_BigInt, 2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_j = hypre_TReAlloc(off_proc_j, HYPRE_BigInt, max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               off_proc_data = hypre_TReAlloc(off_proc_data, HYPRE_Complex,
-                                              max_off_proc_elmts, HYPRE_MEMORY_HOST);
-               hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix)
-                  = max_off_proc_elmts;
-               hypre_AuxParCSRMatrixOffProcI(aux_matrix) = off_proc_i;
-               hypre_AuxParCSRMatrixOffProcJ(aux_matrix) = off_proc_j;
-               hypre_AuxParCSRMatrixOffProcData(aux_matrix) = off_proc_data;
+               max_off_proc_elmts = current_num_elmts + 3 * num_off_elmts;
+               hypre_AuxParCSRMatrixOffProcI(aux_matrix)
+                  = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcI(aux_matrix), HYPRE_BigInt,
+                                   2 * max_off_proc_elmts, HYPRE_MEMORY_HOST);
+               hypre_AuxParCSRMatrixOffProcJ(aux_matrix)
+                  = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcJ(aux_matrix), HYPRE_BigInt,
+                                   max_off_proc_elmts, HYPRE_MEMORY_HOST);
+               hypre_AuxParCSRMatrixOffProcData(aux_matrix)
+                  = hypre_TReAlloc(hypre_AuxParCSRMatrixOffProcData(aux_matrix), HYPRE_Complex,
+                                   max_off_proc_elmts, HYPRE_MEMORY_HOST);
             }
-            off_proc_i[off_proc_i_indx++] = row;
-            off_proc_i[off_proc_i_indx++] = n;
-            for (i = 0; i < n; i++)
+            hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix) = max_off_proc_elmts;
+            off_proc_i    = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
+            off_proc_j    = hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
+            off_proc_data = hypre_AuxParCSRMatrixOffProcData(aux_matrix);
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+
+         row_indx  = off_proc_i_indx + 2 * my_num_rows;
+         elmt_indx = current_num_elmts + my_num_elmts;
+         for (t = my_thread_num; t < max_num_threads; t += num_threads)
+         {
+            my_offproc_cnt = offproc_cnt[t];
+            if (my_offproc_cnt)
             {
-               off_proc_j[current_num_elmts] = cols[indx];
-               off_proc_data[current_num_elmts++] = values[indx++];
+               for (i2 = 2; i2 < my_offproc_cnt[1]; i2 += 2)
+               {
+                  ii   = my_offproc_cnt[i2];
+                  indx = my_offproc_cnt[i2 + 1];
+                  n    = ncols ? ncols[ii] : 1;
+                  off_proc_i[row_indx++] = rows[ii];
+                  off_proc_i[row_indx++] = n;
+                  for (i = 0; i < n; i++)
+                  {
+                     off_proc_j[elmt_indx]      = cols[indx];
+                     off_proc_data[elmt_indx++] = values[indx++];
+                  }
+               }
             }
-            hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = off_proc_i_indx;
-            hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts;
          }
-         hypre_TFree(offproc_cnt[i1], HYPRE_MEMORY_HOST);
-      }
+      } /* end parallel region */
+
+      hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix)        = off_proc_i_indx + 2 * num_off_rows;
+      hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts + num_off_elmts;
+      hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
+   }
+
+   for (i1 = 0; i1 < max_num_threads; i1++)
+   {
+      hypre_TFree(offproc_cnt[i1], HYPRE_MEMORY_HOST);
    }
    hypre_TFree(offproc_cnt, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
 }
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixFindSlotParCSR
+ *
+ * returns the slot of entry (row, col) in a local row of an assembled
+ * matrix, or -1 if the entry is not in the pattern
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixFindSlotParCSR( hypre_IJMatrix *matrix,
+                              HYPRE_BigInt    row,
+                              HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag             = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd             = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i           = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j           = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i           = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j           = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd    = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd     = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt        first            = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int           row_local, col_local, j, j_offd;
+
+   row_local = (HYPRE_Int)(row - row_partitioning[0]);
+
+   if (col >= col_partitioning[0] && col < col_partitioning[1])
+   {
+      col_local = (HYPRE_Int)(col - col_partitioning[0]);
+      for (j = diag_i[row_local]; j < diag_i[row_local + 1]; j++)
+      {
+         if (diag_j[j] == col_local)
+         {
+            return j;
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      /* col_map_offd is relative to the global first column */
+      j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+      if (j_offd > -1)
+      {
+         for (j = offd_i[row_local]; j < offd_i[row_local + 1]; j++)
+         {
+            if (offd_j[j] == j_offd)
+            {
+               return hypre_CSRMatrixNumNonzeros(diag) + j;
+            }
+         }
+      }
+   }
+
+   return -1;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetValueSlotsParCSR
+ *
+ * builds the slot map of an assembled matrix for a list of (row, col) pairs.
+ * Pairs in rows of other processors are merged, sorted by owner, row and
+ * column, and assigned a position in a send buffer.  The owners learn the
+ * pairs once, here, and keep the matching local slots, so that the values
+ * can later be exchanged without any indices.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixSetValueSlotsParCSR( hypre_IJMatrix     *matrix,
+                                   HYPRE_Int           npairs,
+                                   const HYPRE_BigInt *rows,
+                                   const HYPRE_BigInt *cols )
+{
+   MPI_Comm             comm             = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix  *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt         global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt         global_num_rows  = hypre_IJMatrixGlobalNumRows(matrix);
+   HYPRE_Int            print_level      = hypre_IJMatrixPrintLevel(matrix);
+
+   hypre_IJSlotMap     *slot_map;
+   HYPRE_Int           *slots;
+   HYPRE_Int            diag_nnz, offd_nnz, local_nnz;
+
+   HYPRE_Int            num_off, num_unique, num_rows;
+   HYPRE_Int           *off_order;
+   HYPRE_BigInt        *off_rows, *off_cols;
+   HYPRE_BigInt        *row_list;
+   HYPRE_Int           *row_proc;
+
+   HYPRE_Int            num_sends, *send_procs, *send_starts;
+   HYPRE_BigInt        *send_pairs;
+   HYPRE_Int            num_recvs, *recv_procs, *recv_starts, *recv_slots;
+   HYPRE_Int           *recv_order;
+
+   hypre_IJAssumedPart        *apart;
+   hypre_DataExchangeResponse  response_obj1, response_obj2;
+   hypre_ProcListElements      send_proc_obj;
+   HYPRE_Int                   ex_num_contacts, *ex_contact_procs, *ex_contact_vec_starts;
+   HYPRE_BigInt               *ex_contact_buf;
+   HYPRE_BigInt               *response_buf;
+   HYPRE_Int                  *response_buf_starts;
+   HYPRE_Int                   num_ranges, proc_id;
+   HYPRE_BigInt                range_start, range_end, upper_bound;
+
+   HYPRE_Int            i, j, k, start, pos;
+   HYPRE_Int            error = 0;
+
+   diag_nnz  = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix));
+   offd_nnz  = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix));
+   local_nnz = diag_nnz + offd_nnz;
+
+   /*-----------------------------------------------------------------------
+    * Local pairs get their diag/offd slot directly
+    *-----------------------------------------------------------------------*/
+
+   slots     = hypre_TAlloc(HYPRE_Int, npairs, HYPRE_MEMORY_HOST);
+   off_order = hypre_TAlloc(HYPRE_Int, npairs, HYPRE_MEMORY_HOST);
+   num_off   = 0;
+   for (k = 0; k < npairs; k++)
+   {
+      if (rows[k] >= row_partitioning[0] && rows[k] < row_partitioning[1])
+      {
+         slots[k] = hypre_IJMatrixFindSlotParCSR(matrix, rows[k], cols[k]);
+         if (slots[k] < 0)
+         {
+            error = 1;
+            if (print_level)
+            {
+               hypre_printf(" Error, element %b %b does not exist\n", rows[k], cols[k]);
+            }
+         }
+      }
+      else
+      {
+         off_order[num_off++] = k;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Sort the off-processor pairs by row, then column, and merge duplicates
+    *-----------------------------------------------------------------------*/
+
+   off_rows = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   off_cols = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_off; i++)
+   {
+      off_rows[i] = rows[off_order[i]];
+   }
+   hypre_BigQsortbi(off_rows, off_order, 0, num_off - 1);
+   for (i = 0; i < num_off; i++)
+   {
+      off_cols[i] = cols[off_order[i]];
+   }
+   for (start = 0; start < num_off; start = i)
+   {
+      i = start + 1;
+      while (i < num_off && off_rows[i] == off_rows[start])
+      {
+         i++;
+      }
+      hypre_BigQsortbi(off_cols, off_order, start, i - 1);
+   }
+
+   num_unique = 0;
+   num_rows   = 0;
+   row_list   = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_off; i++)
+   {
+      if (i == 0 || off_rows[i] != off_rows[i - 1])
+      {
+         row_list[num_rows++] = off_rows[i];
+      }
+      if (i == 0 || off_rows[i] != off_rows[i - 1] || off_cols[i] != off_cols[i - 1])
+      {
+         off_rows[num_unique] = off_rows[i];
+         off_cols[num_unique] = off_cols[i];
+         num_unique++;
+      }
+      slots[off_order[i]] = local_nnz + num_unique - 1;
+   }
+   hypre_TFree(off_order, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Find the owners of the rows through the assumed partition
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_IJMatrixAssumedPart(matrix) == NULL)
+   {
+      hypre_IJMatrixCreateAssumedPartition(matrix);
+   }
+   apart = (hypre_IJAssumedPart *) hypre_IJMatrixAssumedPart(matrix);
+
+   ex_contact_procs      = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   ex_contact_vec_starts = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   ex_contact_buf        = hypre_TAlloc(HYPRE_BigInt, 2 * num_rows, HYPRE_MEMORY_HOST);
+   ex_num_contacts       = 0;
+   range_end             = -1;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (row_list[i] > range_end)
+      {
+         if (ex_num_contacts > 0)
+         {
+            ex_contact_buf[2 * ex_num_contacts - 1] = row_list[i - 1];
+         }
+         hypre_GetAssumedPartitionProcFromRow(comm, row_list[i], global_first_row,
+                                              global_num_rows, &proc_id);
+         ex_contact_procs[ex_num_contacts]      = proc_id;
+         ex_contact_vec_starts[ex_num_contacts] = 2 * ex_num_contacts;
+         ex_contact_buf[2 * ex_num_contacts]    = row_list[i];
+         ex_num_contacts++;
+         hypre_GetAssumedPartitionRowRange(comm, proc_id, global_first_row, global_num_rows,
+                                           &range_start, &range_end);
+      }
+   }
+   ex_contact_vec_starts[ex_num_contacts] = 2 * ex_num_contacts;
+   if (ex_num_contacts > 0)
+   {
+      ex_contact_buf[2 * ex_num_contacts - 1] = row_list[num_rows - 1];
+   }
+
+   response_obj1.fill_response = hypre_RangeFillResponseIJDetermineRecvProcs;
+   response_obj1.data1 = apart;
+   response_obj1.data2 = NULL;
+
+   hypre_DataExchangeList(ex_num_contacts, ex_contact_procs,
+                          ex_contact_buf, ex_contact_vec_starts, sizeof(HYPRE_BigInt),
+                          sizeof(HYPRE_BigInt), &response_obj1, 6, 1,
+                          comm, (void**) &response_buf, &response_buf_starts);
+
+   hypre_TFree(ex_contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(ex_contact_vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(ex_contact_buf, HYPRE_MEMORY_HOST);
+
+   /* the response is a list of (proc id, range upper bound) */
+   row_proc   = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   num_ranges = response_buf_starts[ex_num_contacts] / 2;
+   j = 0;
+   for (i = 0; i < num_ranges; i++)
+   {
+      upper_bound = response_buf[2 * i + 1];
+      while (j < num_rows && row_list[j] <= upper_bound)
+      {
+         row_proc[j++] = (HYPRE_Int) response_buf[2 * i];
+      }
+   }
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Rows are sorted, so the unique pairs are grouped by owner
+    *-----------------------------------------------------------------------*/
+
+   send_procs  = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   send_starts = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   send_pairs  = hypre_TAlloc(HYPRE_BigInt, 2 * num_unique, HYPRE_MEMORY_HOST);
+   num_sends   = 0;
+   j = 0;
+   for (i = 0; i < num_unique; i++)
+   {
+      while (row_list[j] != off_rows[i])
+      {
+         j++;
+      }
+      if (num_sends == 0 || row_proc[j] != send_procs[num_sends - 1])
+      {
+         send_procs[num_sends]  = row_proc[j];
+         send_starts[num_sends] = 2 * i;
+         num_sends++;
+      }
+      send_pairs[2 * i]     = off_rows[i];
+      send_pairs[2 * i + 1] = off_cols[i];
+   }
+   send_starts[num_sends] = 2 * num_unique;
+
+   hypre_TFree(row_list, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_proc, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_cols, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Send the pairs to their owners
+    *-----------------------------------------------------------------------*/
+
+   send_proc_obj.length                 = 0;
+   send_proc_obj.storage_length         = num_sends + 5;
+   send_proc_obj.id                     = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts             = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                                        HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts[0]          = 0;
+   send_proc_obj.element_storage_length = 2 * num_unique + 1;
+   send_proc_obj.elements               = hypre_CTAlloc(HYPRE_BigInt,
+                                                        send_proc_obj.element_storage_length,
+                                                        HYPRE_MEMORY_HOST);
+
+   response_obj2.fill_response = hypre_FillResponseIJDetermineSendProcs;
+   response_obj2.data1 = NULL;
+   response_obj2.data2 = &send_proc_obj;
+
+   hypre_DataExchangeList(num_sends, send_procs,
+                          send_pairs, send_starts, sizeof(HYPRE_BigInt),
+                          sizeof(HYPRE_BigInt), &response_obj2, 0, 2,
+                          comm, (void **) &response_buf, &response_buf_starts);
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_pairs, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_sends; i++)
+   {
+      send_starts[i] /= 2;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Map the received pairs to local slots, ordered by sender so that the
+    * sums do not depend on message arrival
+    *-----------------------------------------------------------------------*/
+
+   num_recvs   = send_proc_obj.length;
+   recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   recv_slots  = hypre_TAlloc(HYPRE_Int, send_proc_obj.vec_starts[num_recvs] / 2,
+                              HYPRE_MEMORY_HOST);
+   recv_order  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_procs[i] = send_proc_obj.id[i];
+      recv_order[i] = i;
+   }
+   hypre_qsort2i(recv_procs, recv_order, 0, num_recvs - 1);
+
+   recv_starts[0] = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      pos = recv_starts[i];
+      for (j = send_proc_obj.vec_starts[recv_order[i]];
+           j < send_proc_obj.vec_starts[recv_order[i] + 1]; j += 2)
+      {
+         HYPRE_BigInt row = send_proc_obj.elements[j];
+         HYPRE_BigInt col = send_proc_obj.elements[j + 1];
+
+         recv_slots[pos] = -1;
+         if (row >= row_partitioning[0] && row < row_partitioning[1])
+         {
+            recv_slots[pos] = hypre_IJMatrixFindSlotParCSR(matrix, row, col);
+         }
+         if (recv_slots[pos] < 0)
+         {
+            error = 1;
+            if (print_level)
+            {
+               hypre_printf(" Error, element %b %b does not exist\n", row, col);
+            }
+         }
+         pos++;
+      }
+      recv_starts[i + 1] = pos;
+   }
+
+   hypre_TFree(recv_order, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.elements, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Store the map
+    *-----------------------------------------------------------------------*/
+
+   hypre_IJSlotMapDestroy(hypre_IJMatrixSlotMap(matrix));
+
+   slot_map = hypre_CTAlloc(hypre_IJSlotMap, 1, HYPRE_MEMORY_HOST);
+   hypre_IJSlotMapNumPairs(slot_map)   = npairs;
+   hypre_IJSlotMapSlots(slot_map)      = slots;
+   hypre_IJSlotMapDiagNNZ(slot_map)    = diag_nnz;
+   hypre_IJSlotMapOffdNNZ(slot_map)    = offd_nnz;
+   hypre_IJSlotMapNumSends(slot_map)   = num_sends;
+   hypre_IJSlotMapSendProcs(slot_map)  = send_procs;
+   hypre_IJSlotMapSendStarts(slot_map) = send_starts;
+   hypre_IJSlotMapSendData(slot_map)   = hypre_CTAlloc(HYPRE_Complex, num_unique,
+                                                       HYPRE_MEMORY_HOST);
+   hypre_IJSlotMapNumRecvs(slot_map)   = num_recvs;
+   hypre_IJSlotMapRecvProcs(slot_map)  = recv_procs;
+   hypre_IJSlotMapRecvStarts(slot_map) = recv_starts;
+   hypre_IJSlotMapRecvSlots(slot_map)  = recv_slots;
+   hypre_IJSlotMapRecvData(slot_map)   = hypre_TAlloc(HYPRE_Complex, recv_starts[num_recvs],
+                                                      HYPRE_MEMORY_HOST);
+   hypre_IJMatrixSlotMap(matrix) = slot_map;
+
+   if (error)
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAddToValueSlotsParCSR
+ *
+ * adds values to the pairs first, ..., first + nvalues - 1 of the slot map.
+ * Pairs that were not found in the pattern are skipped.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAddToValueSlotsParCSR( hypre_IJMatrix      *matrix,
+                                     HYPRE_Int            first,
+                                     HYPRE_Int            nvalues,
+                                     const HYPRE_Complex *values )
+{
+   hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJSlotMap    *slot_map   = hypre_IJMatrixSlotMap(matrix);
+   HYPRE_Complex      *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex      *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Complex      *send_data  = hypre_IJSlotMapSendData(slot_map);
+   HYPRE_Int          *slots      = hypre_IJSlotMapSlots(slot_map) + first;
+   HYPRE_Int           diag_nnz   = hypre_IJSlotMapDiagNNZ(slot_map);
+   HYPRE_Int           local_nnz  = diag_nnz + hypre_IJSlotMapOffdNNZ(slot_map);
+   HYPRE_Int           num_threads = hypre_NumActiveThreads();
+   HYPRE_Complex      *data;
+   HYPRE_Int           i, s;
+
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+
+   for (i = 0; i < nvalues; i++)
+   {
+      s = slots[i];
+      if (s < 0)
+      {
+         continue;
+      }
+      else if (s < diag_nnz)
+      {
+         data = &diag_data[s];
+      }
+      else if (s < local_nnz)
+      {
+         data = &offd_data[s - diag_nnz];
+      }
+      else
+      {
+         data = &send_data[s - local_nnz];
+      }
+      /* calls from inside a parallel region may race on the same slot */
+      if (num_threads > 1)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp atomic
+#endif
+         *data += values[i];
+      }
+      else
+      {
+         *data += values[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/* tag of the slot value messages, distinct from the other assembly messages */
+#define HYPRE_IJ_SLOTS_TAG 1510
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAssembleValueSlotsParCSR
+ *
+ * sends the accumulated off-processor slot values to their owners, adds them
+ * in, and clears the send buffer for the next assembly
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAssembleValueSlotsParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm            comm        = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix *par_matrix  = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJSlotMap    *slot_map    = hypre_IJMatrixSlotMap(matrix);
+   HYPRE_Complex      *diag_data   = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex      *offd_data   = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int           diag_nnz    = hypre_IJSlotMapDiagNNZ(slot_map);
+   HYPRE_Int           num_sends   = hypre_IJSlotMapNumSends(slot_map);
+   HYPRE_Int          *send_procs  = hypre_IJSlotMapSendProcs(slot_map);
+   HYPRE_Int          *send_starts = hypre_IJSlotMapSendStarts(slot_map);
+   HYPRE_Complex      *send_data   = hypre_IJSlotMapSendData(slot_map);
+   HYPRE_Int           num_recvs   = hypre_IJSlotMapNumRecvs(slot_map);
+   HYPRE_Int          *recv_procs  = hypre_IJSlotMapRecvProcs(slot_map);
+   HYPRE_Int          *recv_starts = hypre_IJSlotMapRecvStarts(slot_map);
+   HYPRE_Int          *recv_slots  = hypre_IJSlotMapRecvSlots(slot_map);
+   HYPRE_Complex      *recv_data   = hypre_IJSlotMapRecvData(slot_map);
+   hypre_MPI_Request  *requests;
+   hypre_MPI_Status   *status;
+   HYPRE_Int           i, s;
+
+   requests = hypre_TAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   status   = hypre_TAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Irecv(&recv_data[recv_starts[i]], recv_starts[i + 1] - recv_starts[i],
+                      HYPRE_MPI_COMPLEX, recv_procs[i], HYPRE_IJ_SLOTS_TAG, comm, &requests[i]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Isend(&send_data[send_starts[i]], send_starts[i + 1] - send_starts[i],
+                      HYPRE_MPI_COMPLEX, send_procs[i], HYPRE_IJ_SLOTS_TAG, comm,
+                      &requests[num_recvs + i]);
+   }
+   hypre_MPI_Waitall(num_sends + num_recvs, requests, status);
+
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   /* received slots are always local, and each is updated in sender order */
+   for (i = 0; i < recv_starts[num_recvs]; i++)
+   {
+      s = recv_slots[i];
+      if (s < 0)
+      {
+         continue;
+      }
+      else if (s < diag_nnz)
+      {
+         diag_data[s] += recv_data[i];
+      }
+      else
+      {
+         offd_data[s - diag_nnz] += recv_data[i];
+      }
+   }
+
+   for (i = 0; i < send_starts[num_sends]; i++)
+   {
+      send_data[i] = 0.0;
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJSlotMapDestroy
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJSlotMapDestroy( hypre_IJSlotMap *slot_map )
+{
+   if (slot_map)
+   {
+      hypre_TFree(hypre_IJSlotMapSlots(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapSendProcs(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapSendStarts(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapSendData(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapRecvProcs(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapRecvStarts(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapRecvSlots(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJSlotMapRecvData(slot_map), HYPRE_MEMORY_HOST);
+      hypre_TFree(slot_map, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * Streaming of off-processor entries
+ *
+ * Entries added to rows of other processors are packed into one chunk per
+ * destination, the assumed partition owner of the row, and a chunk is sent
+ * as soon as it is full.  Received chunks are added to the matrix during
+ * later calls to AddToValues.  Rows received by a processor that does not
+ * own them are stashed as usual and forwarded at assembly.  The message tag
+ * alternates between assemblies, so that a processor that already started
+ * the next assembly cannot confuse one that is still finishing this one.
+ *
+ *****************************************************************************/
+
+#define HYPRE_IJ_STREAM_TAG 1500
+
+#define hypre_IJStreamEntrySize \
+   (2 * sizeof(HYPRE_BigInt) + sizeof(HYPRE_Complex))
+
+#define hypre_IJStreamTag(stream) \
+   (HYPRE_IJ_STREAM_TAG + hypre_IJStreamPhase(stream) % 2)
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetOffProcStreamingParCSR
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixSetOffProcStreamingParCSR( hypre_IJMatrix *matrix,
+                                         HYPRE_Int       chunk_size )
+{
+   hypre_IJStream *stream = hypre_IJMatrixStream(matrix);
+
+   if (stream && hypre_IJStreamNumDests(stream))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Off-processor streaming cannot be changed before assembly");
+      return hypre_error_flag;
+   }
+
+   if (!chunk_size)
+   {
+      hypre_IJStreamDestroy(stream);
+      hypre_IJMatrixStream(matrix) = NULL;
+      return hypre_error_flag;
+   }
+
+   if (!stream)
+   {
+      stream = hypre_CTAlloc(hypre_IJStream, 1, HYPRE_MEMORY_HOST);
+      hypre_IJMatrixStream(matrix) = stream;
+   }
+   hypre_IJStreamChunkSize(stream) = chunk_size;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJStreamSendChunk
+ *
+ * sends the open chunk of destination d and opens a new one
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJStreamSendChunk( hypre_IJStream *stream,
+                         HYPRE_Int       d,
+                         MPI_Comm        comm )
+{
+   HYPRE_Int   chunk_size = hypre_IJStreamChunkSize(stream);
+   HYPRE_Int   n          = hypre_IJStreamDestSizes(stream)[d];
+   char       *buf        = hypre_IJStreamDestBufs(stream)[d];
+   HYPRE_Int   num_pending;
+
+   if (!n)
+   {
+      return hypre_error_flag;
+   }
+
+   /* pack a partial chunk */
+   if (n < chunk_size)
+   {
+      memmove(buf + n * sizeof(HYPRE_BigInt),
+              buf + chunk_size * sizeof(HYPRE_BigInt),
+              n * sizeof(HYPRE_BigInt));
+      memmove(buf + 2 * n * sizeof(HYPRE_BigInt),
+              buf + 2 * chunk_size * sizeof(HYPRE_BigInt),
+              n * sizeof(HYPRE_Complex));
+   }
+
+   num_pending = hypre_IJStreamNumPending(stream);
+   if (num_pending == hypre_IJStreamMaxPending(stream))
+   {
+      hypre_IJStreamMaxPending(stream) = 2 * num_pending + 8;
+      hypre_IJStreamPendingReqs(stream) = hypre_TReAlloc(hypre_IJStreamPendingReqs(stream),
+                                                         hypre_MPI_Request,
+                                                         hypre_IJStreamMaxPending(stream),
+                                                         HYPRE_MEMORY_HOST);
+      hypre_IJStreamPendingBufs(stream) = hypre_TReAlloc(hypre_IJStreamPendingBufs(stream),
+                                                         char *,
+                                                         hypre_IJStreamMaxPending(stream),
+                                                         HYPRE_MEMORY_HOST);
+   }
+
+   hypre_MPI_Isend(buf, (HYPRE_Int)(n * hypre_IJStreamEntrySize), hypre_MPI_BYTE,
+                   hypre_IJStreamDestProcs(stream)[d], hypre_IJStreamTag(stream), comm,
+                   &hypre_IJStreamPendingReqs(stream)[num_pending]);
+   hypre_IJStreamPendingBufs(stream)[num_pending] = buf;
+   hypre_IJStreamNumPending(stream)++;
+
+   hypre_IJStreamDestNumMsgs(stream)[d]++;
+   hypre_IJStreamDestSizes(stream)[d] = 0;
+   hypre_IJStreamDestBufs(stream)[d]  = hypre_TAlloc(char, chunk_size * hypre_IJStreamEntrySize,
+                                                     HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixStreamAddParCSR
+ *
+ * appends the n entries of an off-processor row to the chunk of its
+ * destination, and sends the chunk when it is full
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStreamAddParCSR( hypre_IJMatrix      *matrix,
+                               HYPRE_BigInt         row,
+                               HYPRE_Int            n,
+                               const HYPRE_BigInt  *cols,
+                               const HYPRE_Complex *values )
+{
+   MPI_Comm         comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJStream  *stream     = hypre_IJMatrixStream(matrix);
+   HYPRE_Int        chunk_size = hypre_IJStreamChunkSize(stream);
+   HYPRE_Int        num_dests  = hypre_IJStreamNumDests(stream);
+   HYPRE_Int       *dest_procs = hypre_IJStreamDestProcs(stream);
+   HYPRE_BigInt    *buf_rows, *buf_cols;
+   HYPRE_Complex   *buf_data;
+   HYPRE_Int        proc, d, i, k, m;
+
+   hypre_GetAssumedPartitionProcFromRow(comm, row, hypre_IJMatrixGlobalFirstRow(matrix),
+                                        hypre_IJMatrixGlobalNumRows(matrix), &proc);
+
+   d = hypre_BinarySearch(dest_procs, proc, num_dests);
+   if (d < 0)
+   {
+      if (num_dests == hypre_IJStreamMaxDests(stream))
+      {
+         hypre_IJStreamMaxDests(stream) = 2 * num_dests + 8;
+         hypre_IJStreamDestProcs(stream) = hypre_TReAlloc(hypre_IJStreamDestProcs(stream),
+                                                          HYPRE_Int, hypre_IJStreamMaxDests(stream),
+                                                          HYPRE_MEMORY_HOST);
+         hypre_IJStreamDestNumMsgs(stream) = hypre_TReAlloc(hypre_IJStreamDestNumMsgs(stream),
+                                                            HYPRE_Int, hypre_IJStreamMaxDests(stream),
+                                                            HYPRE_MEMORY_HOST);
+         hypre_IJStreamDestSizes(stream) = hypre_TReAlloc(hypre_IJStreamDestSizes(stream),
+                                                          HYPRE_Int, hypre_IJStreamMaxDests(stream),
+                                                          HYPRE_MEMORY_HOST);
+         hypre_IJStreamDestBufs(stream) = hypre_TReAlloc(hypre_IJStreamDestBufs(stream),
+                                                         char *, hypre_IJStreamMaxDests(stream),
+                                                         HYPRE_MEMORY_HOST);
+         dest_procs = hypre_IJStreamDestProcs(stream);
+      }
+
+      /* keep the destinations sorted */
+      d = num_dests;
+      while (d > 0 && dest_procs[d - 1] > proc)
+      {
+         dest_procs[d] = dest_procs[d - 1];
+         hypre_IJStreamDestNumMsgs(stream)[d] = hypre_IJStreamDestNumMsgs(stream)[d - 1];
+         hypre_IJStreamDestSizes(stream)[d]   = hypre_IJStreamDestSizes(stream)[d - 1];
+         hypre_IJStreamDestBufs(stream)[d]    = hypre_IJStreamDestBufs(stream)[d - 1];
+         d--;
+      }
+      dest_procs[d] = proc;
+      hypre_IJStreamDestNumMsgs(stream)[d] = 0;
+      hypre_IJStreamDestSizes(stream)[d]   = 0;
+      hypre_IJStreamDestBufs(stream)[d]    = hypre_TAlloc(char, chunk_size * hypre_IJStreamEntrySize,
+                                                          HYPRE_MEMORY_HOST);
+      hypre_IJStreamNumDests(stream)++;
+   }
+
+   /* a row may be split across chunks */
+   i = 0;
+   while (i < n)
+   {
+      k = hypre_IJStreamDestSizes(stream)[d];
+      m = hypre_min(n - i, chunk_size - k);
+
+      buf_rows = (HYPRE_BigInt *) hypre_IJStreamDestBufs(stream)[d];
+      buf_cols = buf_rows + chunk_size;
+      buf_data = (HYPRE_Complex *) (buf_cols + chunk_size);
+      for (; m > 0; m--, i++, k++)
+      {
+         buf_rows[k] = row;
+         buf_cols[k] = cols[i];
+         buf_data[k] = values[i];
+      }
+      hypre_IJStreamDestSizes(stream)[d] = k;
+
+      if (k == chunk_size)
+      {
+         hypre_IJStreamSendChunk(stream, d, comm);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixStreamRecvParCSR
+ *
+ * receives one chunk from processor source and adds its entries
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStreamRecvParCSR( hypre_IJMatrix   *matrix,
+                                hypre_MPI_Status *status )
+{
+   MPI_Comm          comm   = hypre_IJMatrixComm(matrix);
+   hypre_IJStream   *stream = hypre_IJMatrixStream(matrix);
+   HYPRE_Int         nbytes, n, i, j, len;
+   HYPRE_Int         zero = 0;
+   char             *buf;
+   HYPRE_BigInt     *buf_rows, *buf_cols;
+   HYPRE_Complex    *buf_data;
+
+   hypre_MPI_Get_count(status, hypre_MPI_BYTE, &nbytes);
+   buf = hypre_TAlloc(char, nbytes, HYPRE_MEMORY_HOST);
+   hypre_MPI_Recv(buf, nbytes, hypre_MPI_BYTE, status->hypre_MPI_SOURCE,
+                  hypre_IJStreamTag(stream), comm, status);
+   hypre_IJStreamNumRecvd(stream)++;
+
+   n = nbytes / (HYPRE_Int) hypre_IJStreamEntrySize;
+   buf_rows = (HYPRE_BigInt *) buf;
+   buf_cols = buf_rows + n;
+   buf_data = (HYPRE_Complex *) (buf_cols + n);
+
+   /* entries of a row are contiguous; rows not owned here are stashed */
+   hypre_IJStreamApplying(stream) = 1;
+   for (i = 0; i < n; i += len)
+   {
+      for (j = i + 1; j < n && buf_rows[j] == buf_rows[i]; j++)
+      {
+      }
+      len = j - i;
+      hypre_IJMatrixAddToValuesParCSR(matrix, 1, &len, &buf_rows[i], &zero,
+                                      &buf_cols[i], &buf_data[i]);
+   }
+   hypre_IJStreamApplying(stream) = 0;
+
+   hypre_TFree(buf, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJStreamTestSends
+ *
+ * frees the buffers of the completed sends
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJStreamTestSends( hypre_IJStream *stream )
+{
+   hypre_MPI_Request  *reqs = hypre_IJStreamPendingReqs(stream);
+   char              **bufs = hypre_IJStreamPendingBufs(stream);
+   hypre_MPI_Status    status;
+   HYPRE_Int           i, k, flag;
+
+   k = 0;
+   for (i = 0; i < hypre_IJStreamNumPending(stream); i++)
+   {
+      hypre_MPI_Test(&reqs[i], &flag, &status);
+      if (flag)
+      {
+         hypre_TFree(bufs[i], HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         reqs[k] = reqs[i];
+         bufs[k] = bufs[i];
+         k++;
+      }
+   }
+   hypre_IJStreamNumPending(stream) = k;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixStreamProgressParCSR
+ *
+ * adds the chunks that have arrived and releases completed sends, without
+ * blocking
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStreamProgressParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm          comm   = hypre_IJMatrixComm(matrix);
+   hypre_IJStream   *stream = hypre_IJMatrixStream(matrix);
+   hypre_MPI_Status  status;
+   HYPRE_Int         flag;
+
+   hypre_IJStreamTestSends(stream);
+
+   hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, hypre_IJStreamTag(stream), comm, &flag, &status);
+   while (flag)
+   {
+      hypre_IJMatrixStreamRecvParCSR(matrix, &status);
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, hypre_IJStreamTag(stream), comm, &flag, &status);
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixStreamFinalizeParCSR
+ *
+ * sends the partial chunks, tells each destination how many messages to
+ * expect, and receives the remaining ones.  Collective.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStreamFinalizeParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm                comm   = hypre_IJMatrixComm(matrix);
+   hypre_IJStream         *stream = hypre_IJMatrixStream(matrix);
+   HYPRE_Int               num_dests = hypre_IJStreamNumDests(stream);
+   HYPRE_BigInt           *num_msgs;
+   HYPRE_Int              *num_msgs_starts;
+   hypre_DataExchangeResponse  response_obj;
+   hypre_ProcListElements  count_obj;
+   void                   *response_buf;
+   HYPRE_Int              *response_buf_starts;
+   hypre_MPI_Status       *status;
+   hypre_MPI_Status        probe_status;
+   HYPRE_Int               num_expected;
+   HYPRE_Int               i;
+
+   for (i = 0; i < num_dests; i++)
+   {
+      hypre_IJStreamSendChunk(stream, i, comm);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Exchange the message counts
+    *-----------------------------------------------------------------------*/
+
+   num_msgs        = hypre_TAlloc(HYPRE_BigInt, num_dests, HYPRE_MEMORY_HOST);
+   num_msgs_starts = hypre_TAlloc(HYPRE_Int, num_dests + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_dests; i++)
+   {
+      num_msgs[i]        = (HYPRE_BigInt) hypre_IJStreamDestNumMsgs(stream)[i];
+      num_msgs_starts[i] = i;
+   }
+   num_msgs_starts[num_dests] = num_dests;
+
+   count_obj.length                 = 0;
+   count_obj.storage_length         = 10;
+   count_obj.id                     = hypre_CTAlloc(HYPRE_Int, count_obj.storage_length,
+                                                    HYPRE_MEMORY_HOST);
+   count_obj.vec_starts             = hypre_CTAlloc(HYPRE_Int, count_obj.storage_length + 1,
+                                                    HYPRE_MEMORY_HOST);
+   count_obj.element_storage_length = 10;
+   count_obj.elements               = hypre_CTAlloc(HYPRE_BigInt,
+                                                    count_obj.element_storage_length,
+                                                    HYPRE_MEMORY_HOST);
+
+   response_obj.fill_response = hypre_FillResponseIJDetermineSendProcs;
+   response_obj.data1 = NULL;
+   response_obj.data2 = &count_obj;
+
+   hypre_DataExchangeList(num_dests, hypre_IJStreamDestProcs(stream),
+                          num_msgs, num_msgs_starts, sizeof(HYPRE_BigInt),
+                          sizeof(HYPRE_BigInt), &response_obj, 0, 3,
+                          comm, &response_buf, &response_buf_starts);
+
+   num_expected = 0;
+   for (i = 0; i < count_obj.vec_starts[count_obj.length]; i++)
+   {
+      num_expected += (HYPRE_Int) count_obj.elements[i];
+   }
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(count_obj.id, HYPRE_MEMORY_HOST);
+   hypre_TFree(count_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(count_obj.elements, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_msgs, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_msgs_starts, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Receive the remaining messages and complete the sends
+    *-----------------------------------------------------------------------*/
+
+   while (hypre_IJStreamNumRecvd(stream) < num_expected)
+   {
+      hypre_MPI_Probe(hypre_MPI_ANY_SOURCE, hypre_IJStreamTag(stream), comm, &probe_status);
+      hypre_IJMatrixStreamRecvParCSR(matrix, &probe_status);
+   }
+
+   status = hypre_TAlloc(hypre_MPI_Status, hypre_IJStreamNumPending(stream), HYPRE_MEMORY_HOST);
+   hypre_MPI_Waitall(hypre_IJStreamNumPending(stream), hypre_IJStreamPendingReqs(stream), status);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+   for (i = 0; i < hypre_IJStreamNumPending(stream); i++)
+   {
+      hypre_TFree(hypre_IJStreamPendingBufs(stream)[i], HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < num_dests; i++)
+   {
+      hypre_TFree(hypre_IJStreamDestBufs(stream)[i], HYPRE_MEMORY_HOST);
+   }
+
+   hypre_IJStreamNumPending(stream) = 0;
+   hypre_IJStreamNumDests(stream)   = 0;
+   hypre_IJStreamNumRecvd(stream)   = 0;
+   hypre_IJStreamPhase(stream)++;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJStreamDestroy
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJStreamDestroy( hypre_IJStream *stream )
+{
+   HYPRE_Int i;
+
+   if (stream)
+   {
+      for (i = 0; i < hypre_IJStreamNumDests(stream); i++)
+      {
+         hypre_TFree(hypre_IJStreamDestBufs(stream)[i], HYPRE_MEMORY_HOST);
+      }
+      for (i = 0; i < hypre_IJStreamNumPending(stream); i++)
+      {
+         hypre_TFree(hypre_IJStreamPendingBufs(stream)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_IJStreamDestProcs(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJStreamDestNumMsgs(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJStreamDestSizes(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJStreamDestBufs(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJStreamPendingReqs(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJStreamPendingBufs(stream), HYPRE_MEMORY_HOST);
+      hypre_TFree(stream, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
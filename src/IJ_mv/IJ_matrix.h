@@ -14,6 +14,104 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJSlotMap:
+ *
+ * Positions of the values of a fixed list of (row, col) pairs of an
+ * assembled ParCSR matrix.  A slot s < diag_nnz is an index into the diag
+ * data, a slot s < diag_nnz + offd_nnz is an index into the offd data, and
+ * the remaining slots index send_data, where contributions to rows of other
+ * processors are accumulated until the next assemble.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_IJSlotMap_struct
+{
+   HYPRE_Int       num_pairs;
+   HYPRE_Int      *slots;
+   HYPRE_Int       diag_nnz;
+   HYPRE_Int       offd_nnz;
+
+   HYPRE_Int       num_sends;
+   HYPRE_Int      *send_procs;
+   HYPRE_Int      *send_starts;
+   HYPRE_Complex  *send_data;
+
+   HYPRE_Int       num_recvs;
+   HYPRE_Int      *recv_procs;
+   HYPRE_Int      *recv_starts;
+   HYPRE_Int      *recv_slots;     /* local slots of the received values */
+   HYPRE_Complex  *recv_data;
+
+} hypre_IJSlotMap;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJSlotMap
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJSlotMapNumPairs(map)           ((map) -> num_pairs)
+#define hypre_IJSlotMapSlots(map)              ((map) -> slots)
+#define hypre_IJSlotMapDiagNNZ(map)            ((map) -> diag_nnz)
+#define hypre_IJSlotMapOffdNNZ(map)            ((map) -> offd_nnz)
+#define hypre_IJSlotMapNumSends(map)           ((map) -> num_sends)
+#define hypre_IJSlotMapSendProcs(map)          ((map) -> send_procs)
+#define hypre_IJSlotMapSendStarts(map)         ((map) -> send_starts)
+#define hypre_IJSlotMapSendData(map)           ((map) -> send_data)
+#define hypre_IJSlotMapNumRecvs(map)           ((map) -> num_recvs)
+#define hypre_IJSlotMapRecvProcs(map)          ((map) -> recv_procs)
+#define hypre_IJSlotMapRecvStarts(map)         ((map) -> recv_starts)
+#define hypre_IJSlotMapRecvSlots(map)          ((map) -> recv_slots)
+#define hypre_IJSlotMapRecvData(map)           ((map) -> recv_data)
+
+/*--------------------------------------------------------------------------
+ * hypre_IJStream:
+ *
+ * State of the streaming exchange of off-processor entries.  Entries are
+ * packed into one open chunk per destination (the assumed partition owner
+ * of the row) and each chunk is sent as soon as it holds chunk_size entries.
+ * A message carries n rows, n columns and n values, in this order.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_IJStream_struct
+{
+   HYPRE_Int           chunk_size;     /* entries per message */
+   HYPRE_Int           phase;          /* assemble count, selects the message tag */
+   HYPRE_Int           applying;       /* set while received entries are added */
+
+   HYPRE_Int           num_dests;
+   HYPRE_Int           max_dests;
+   HYPRE_Int          *dest_procs;     /* sorted */
+   HYPRE_Int          *dest_num_msgs;  /* messages sent in this phase */
+   HYPRE_Int          *dest_sizes;     /* entries in the open chunk */
+   char              **dest_bufs;      /* open chunks */
+
+   HYPRE_Int           num_pending;    /* sends in flight */
+   HYPRE_Int           max_pending;
+   hypre_MPI_Request  *pending_reqs;
+   char              **pending_bufs;
+
+   HYPRE_Int           num_recvd;      /* messages received in this phase */
+
+} hypre_IJStream;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJStream
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJStreamChunkSize(stream)        ((stream) -> chunk_size)
+#define hypre_IJStreamPhase(stream)            ((stream) -> phase)
+#define hypre_IJStreamApplying(stream)         ((stream) -> applying)
+#define hypre_IJStreamNumDests(stream)         ((stream) -> num_dests)
+#define hypre_IJStreamMaxDests(stream)         ((stream) -> max_dests)
+#define hypre_IJStreamDestProcs(stream)        ((stream) -> dest_procs)
+#define hypre_IJStreamDestNumMsgs(stream)      ((stream) -> dest_num_msgs)
+#define hypre_IJStreamDestSizes(stream)        ((stream) -> dest_sizes)
+#define hypre_IJStreamDestBufs(stream)         ((stream) -> dest_bufs)
+#define hypre_IJStreamNumPending(stream)       ((stream) -> num_pending)
+#define hypre_IJStreamMaxPending(stream)       ((stream) -> max_pending)
+#define hypre_IJStreamPendingReqs(stream)      ((stream) -> pending_reqs)
+#define hypre_IJStreamPendingBufs(stream)      ((stream) -> pending_bufs)
+#define hypre_IJStreamNumRecvd(stream)         ((stream) -> num_recvd)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -39,6 +137,8 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
+   hypre_IJSlotMap *slot_map;         /* optional fixed-pattern value map */
+   hypre_IJStream  *stream;           /* optional streaming off-proc exchange */
 
 } hypre_IJMatrix;
 
@@ -63,6 +163,12 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixSlotMap(matrix)          ((matrix) -> slot_map)
+#define hypre_IJMatrixStream(matrix)           ((matrix) -> stream)
+
+/* off-processor entries are streamed rather than stashed */
+#define hypre_IJMatrixStreamActive(matrix) \
+   (hypre_IJMatrixStream(matrix) && !hypre_IJStreamApplying(hypre_IJMatrixStream(matrix)))
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -94,6 +94,23 @@ HYPRE_Int hypre_FillResponseIJOffProcVals ( void *p_recv_contact_buf, HYPRE_Int
                                             HYPRE_Int *response_message_size );
 HYPRE_Int hypre_FindProc ( HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_length );
 HYPRE_Int hypre_IJMatrixAssembleParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixFindSlotParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt row,
+                                         HYPRE_BigInt col );
+HYPRE_Int hypre_IJMatrixSetValueSlotsParCSR ( hypre_IJMatrix *matrix, HYPRE_Int npairs,
+                                              const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixAddToValueSlotsParCSR ( hypre_IJMatrix *matrix, HYPRE_Int first,
+                                                HYPRE_Int nvalues, const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixAssembleValueSlotsParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJSlotMapDestroy ( hypre_IJSlotMap *slot_map );
+HYPRE_Int hypre_IJMatrixSetOffProcStreamingParCSR ( hypre_IJMatrix *matrix, HYPRE_Int chunk_size );
+HYPRE_Int hypre_IJMatrixStreamAddParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt row, HYPRE_Int n,
+                                          const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int hypre_IJStreamSendChunk ( hypre_IJStream *stream, HYPRE_Int d, MPI_Comm comm );
+HYPRE_Int hypre_IJMatrixStreamRecvParCSR ( hypre_IJMatrix *matrix, hypre_MPI_Status *status );
+HYPRE_Int hypre_IJStreamTestSends ( hypre_IJStream *stream );
+HYPRE_Int hypre_IJMatrixStreamProgressParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixStreamFinalizeParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJStreamDestroy ( hypre_IJStream *stream );
 HYPRE_Int hypre_IJMatrixSetValuesOMPParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
                                              const HYPRE_Complex *values );
@@ -174,6 +191,10 @@ HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixSetValueSlots ( HYPRE_IJMatrix matrix, HYPRE_Int npairs,
+                                        const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixAddToValueSlots ( HYPRE_IJMatrix matrix, HYPRE_Int first,
+                                          HYPRE_Int nvalues, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
@@ -187,6 +208,7 @@ HYPRE_Int HYPRE_IJMatrixSetRowSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *si
 HYPRE_Int HYPRE_IJMatrixSetDiagOffdSizes ( HYPRE_IJMatrix matrix, const HYPRE_Int *diag_sizes,
                                            const HYPRE_Int *offdiag_sizes );
 HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix, HYPRE_Int max_off_proc_elmts );
+HYPRE_Int HYPRE_IJMatrixSetOffProcStreaming ( HYPRE_IJMatrix matrix, HYPRE_Int chunk_size );
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int type,
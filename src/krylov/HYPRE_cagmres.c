@@ -0,0 +1,274 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_CAGMRES interface
+ *
+ *****************************************************************************/
+#include "krylov.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetup( HYPRE_Solver solver,
+                    HYPRE_Matrix A,
+                    HYPRE_Vector b,
+                    HYPRE_Vector x      )
+{
+   return ( hypre_CAGMRESSetup( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSolve( HYPRE_Solver solver,
+                    HYPRE_Matrix A,
+                    HYPRE_Vector b,
+                    HYPRE_Vector x      )
+{
+   return ( hypre_CAGMRESSolve( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetKDim, HYPRE_CAGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetKDim( HYPRE_Solver solver,
+                      HYPRE_Int k_dim )
+{
+   return ( hypre_CAGMRESSetKDim( (void *) solver, k_dim ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetKDim( HYPRE_Solver solver,
+                      HYPRE_Int *k_dim )
+{
+   return ( hypre_CAGMRESGetKDim( (void *) solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetSStep, HYPRE_CAGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetSStep( HYPRE_Solver solver,
+                       HYPRE_Int s_step )
+{
+   return ( hypre_CAGMRESSetSStep( (void *) solver, s_step ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetSStep( HYPRE_Solver solver,
+                       HYPRE_Int *s_step )
+{
+   return ( hypre_CAGMRESGetSStep( (void *) solver, s_step ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetUnroll, HYPRE_CAGMRESGetUnroll
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetUnroll( HYPRE_Solver solver,
+                        HYPRE_Int unroll )
+{
+   return ( hypre_CAGMRESSetUnroll( (void *) solver, unroll ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetUnroll( HYPRE_Solver solver,
+                        HYPRE_Int *unroll )
+{
+   return ( hypre_CAGMRESGetUnroll( (void *) solver, unroll ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetTol, HYPRE_CAGMRESGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetTol( HYPRE_Solver solver,
+                     HYPRE_Real tol )
+{
+   return ( hypre_CAGMRESSetTol( (void *) solver, tol ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetTol( HYPRE_Solver solver,
+                     HYPRE_Real *tol )
+{
+   return ( hypre_CAGMRESGetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetAbsoluteTol, HYPRE_CAGMRESGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetAbsoluteTol( HYPRE_Solver solver,
+                             HYPRE_Real a_tol )
+{
+   return ( hypre_CAGMRESSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetAbsoluteTol( HYPRE_Solver solver,
+                             HYPRE_Real *a_tol )
+{
+   return ( hypre_CAGMRESGetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetMinIter, HYPRE_CAGMRESGetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetMinIter( HYPRE_Solver solver,
+                         HYPRE_Int min_iter )
+{
+   return ( hypre_CAGMRESSetMinIter( (void *) solver, min_iter ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetMinIter( HYPRE_Solver solver,
+                         HYPRE_Int *min_iter )
+{
+   return ( hypre_CAGMRESGetMinIter( (void *) solver, min_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetMaxIter, HYPRE_CAGMRESGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetMaxIter( HYPRE_Solver solver,
+                         HYPRE_Int max_iter )
+{
+   return ( hypre_CAGMRESSetMaxIter( (void *) solver, max_iter ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetMaxIter( HYPRE_Solver solver,
+                         HYPRE_Int *max_iter )
+{
+   return ( hypre_CAGMRESGetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetPrecond( HYPRE_Solver          solver,
+                         HYPRE_PtrToSolverFcn  precond,
+                         HYPRE_PtrToSolverFcn  precond_setup,
+                         HYPRE_Solver          precond_solver )
+{
+   return ( hypre_CAGMRESSetPrecond( (void *) solver,
+                                     (HYPRE_Int (*)(void*, void*, void*, void*))precond,
+                                     (HYPRE_Int (*)(void*, void*, void*, void*))precond_setup,
+                                     (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESGetPrecond( HYPRE_Solver  solver,
+                         HYPRE_Solver *precond_data_ptr )
+{
+   return ( hypre_CAGMRESGetPrecond( (void *)     solver,
+                                     (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetPrintLevel, HYPRE_CAGMRESGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetPrintLevel( HYPRE_Solver solver,
+                            HYPRE_Int level )
+{
+   return ( hypre_CAGMRESSetPrintLevel( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetPrintLevel( HYPRE_Solver solver,
+                            HYPRE_Int *level )
+{
+   return ( hypre_CAGMRESGetPrintLevel( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESSetLogging, HYPRE_CAGMRESGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESSetLogging( HYPRE_Solver solver,
+                         HYPRE_Int level )
+{
+   return ( hypre_CAGMRESSetLogging( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_CAGMRESGetLogging( HYPRE_Solver solver,
+                         HYPRE_Int *level )
+{
+   return ( hypre_CAGMRESGetLogging( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESGetNumIterations( HYPRE_Solver  solver,
+                               HYPRE_Int    *num_iterations )
+{
+   return ( hypre_CAGMRESGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESGetConverged( HYPRE_Solver  solver,
+                           HYPRE_Int    *converged )
+{
+   return ( hypre_CAGMRESGetConverged( (void *) solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                           HYPRE_Real   *norm   )
+{
+   return ( hypre_CAGMRESGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CAGMRESGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CAGMRESGetResidual( HYPRE_Solver  solver,
+                          void         *residual )
+{
+   /* returns a pointer to the residual vector */
+   return ( hypre_CAGMRESGetResidual( (void *) solver, (void **) residual ) );
+}
@@ -177,6 +177,19 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of PCG, which performs a single
+ * non-blocking reduction per iteration and overlaps it with the preconditioner
+ * and the matrix-vector product.  It is less stable than the standard variant
+ * and supports only the default stopping test: if the stopping criterion,
+ * absolute tolerance factor, convergence factor tolerance, residual tolerance,
+ * relative change or recompute residual options are set, the standard variant
+ * is used.  Requires support from the matrix/vector interface (available for
+ * ParCSR, Struct and SStruct); otherwise the standard variant is used too.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -258,6 +271,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver  solver,
+                                HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -1007,6 +1025,183 @@ HYPRE_Int HYPRE_COGMRESSetModifyPC(HYPRE_Solver           solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name CAGMRES Solver
+ *
+ * s-step (communication-avoiding) GMRES with right preconditioning.  Krylov
+ * vectors are generated in blocks of \e s and each block is orthogonalized
+ * with two passes of block Gram-Schmidt and Cholesky QR, so that the number
+ * of global reductions per restart cycle is reduced by a factor of about \e s
+ * compared to GMRES.  The basis is a monomial basis; when it becomes too
+ * ill-conditioned for large values of \e s, the block is shortened
+ * automatically, which costs additional reductions.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the system.  The coefficient data in \e b and \e x is
+ * ignored here, but information about the layout of the data may be used.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetup(HYPRE_Solver solver,
+                             HYPRE_Matrix A,
+                             HYPRE_Vector b,
+                             HYPRE_Vector x);
+
+/**
+ * Solve the system.
+ **/
+HYPRE_Int HYPRE_CAGMRESSolve(HYPRE_Solver solver,
+                             HYPRE_Matrix A,
+                             HYPRE_Vector b,
+                             HYPRE_Vector x);
+
+/**
+ * (Optional) Set the convergence tolerance.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetTol(HYPRE_Solver solver,
+                              HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ * (The convergence test is
+ * \f$\|r\| \leq\f$ max(relative\f$\_\f$tolerance\f$\ast \|b\|\f$, absolute\f$\_\f$tolerance).)
+ **/
+HYPRE_Int HYPRE_CAGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                      HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_CAGMRESSetMinIter(HYPRE_Solver solver,
+                                  HYPRE_Int    min_iter);
+
+/**
+ * (Optional) Set maximum number of iterations.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetMaxIter(HYPRE_Solver solver,
+                                  HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the maximum size of the Krylov space (default is 8).
+ **/
+HYPRE_Int HYPRE_CAGMRESSetKDim(HYPRE_Solver solver,
+                               HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the number of Krylov vectors \e s generated and
+ * orthogonalized as one block (default is 4).  Values larger than the Krylov
+ * space dimension are reduced to it.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
+/**
+ * (Optional) Set number of unrolling in mass functions in CAGMRES
+ * Can be 4 or 8. Default: no unrolling.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetUnroll(HYPRE_Solver solver,
+                                 HYPRE_Int    unroll);
+
+/**
+ * (Optional) Set the preconditioner to use.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetPrecond(HYPRE_Solver         solver,
+                                  HYPRE_PtrToSolverFcn precond,
+                                  HYPRE_PtrToSolverFcn precond_setup,
+                                  HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetLogging(HYPRE_Solver solver,
+                                  HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_CAGMRESSetPrintLevel(HYPRE_Solver solver,
+                                     HYPRE_Int    level);
+
+/**
+ * Return the number of iterations taken.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetNumIterations(HYPRE_Solver  solver,
+                                        HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                    HYPRE_Real   *norm);
+
+/**
+ * Return the residual.
+ **/
+HYPRE_Int HYPRE_CAGMRESGetResidual(HYPRE_Solver   solver,
+                                   void          *residual);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetTol(HYPRE_Solver  solver,
+                              HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetAbsoluteTol(HYPRE_Solver  solver,
+                                      HYPRE_Real   *a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_CAGMRESGetMinIter(HYPRE_Solver solver,
+                                  HYPRE_Int   *min_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetMaxIter(HYPRE_Solver  solver,
+                                  HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetKDim(HYPRE_Solver  solver,
+                               HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetUnroll(HYPRE_Solver  solver,
+                                 HYPRE_Int    *unroll);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetPrecond(HYPRE_Solver  solver,
+                                  HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetLogging(HYPRE_Solver  solver,
+                                  HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetPrintLevel(HYPRE_Solver  solver,
+                                     HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_CAGMRESGetConverged(HYPRE_Solver  solver,
+                                    HYPRE_Int    *converged);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -0,0 +1,1098 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * CAGMRES s-step (communication-avoiding) gmres
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_CAGMRESFunctions *
+hypre_CAGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Int unroll, void *result ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+)
+{
+   hypre_CAGMRESFunctions * cagmres_functions;
+   cagmres_functions = (hypre_CAGMRESFunctions *)
+                       CAlloc( 1, sizeof(hypre_CAGMRESFunctions), HYPRE_MEMORY_HOST );
+
+   cagmres_functions->CAlloc            = CAlloc;
+   cagmres_functions->Free              = Free;
+   cagmres_functions->CommInfo          = CommInfo;
+   cagmres_functions->CreateVector      = CreateVector;
+   cagmres_functions->CreateVectorArray = CreateVectorArray;
+   cagmres_functions->DestroyVector     = DestroyVector;
+   cagmres_functions->MatvecCreate      = MatvecCreate;
+   cagmres_functions->Matvec            = Matvec;
+   cagmres_functions->MatvecDestroy     = MatvecDestroy;
+   cagmres_functions->InnerProd         = InnerProd;
+   cagmres_functions->BlockInnerProd    = BlockInnerProd;
+   cagmres_functions->CopyVector        = CopyVector;
+   cagmres_functions->ClearVector       = ClearVector;
+   cagmres_functions->ScaleVector       = ScaleVector;
+   cagmres_functions->Axpy              = Axpy;
+   cagmres_functions->MassAxpy          = MassAxpy;
+   /* default preconditioner must be set here but can be changed later... */
+   cagmres_functions->precond_setup     = PrecondSetup;
+   cagmres_functions->precond           = Precond;
+
+   return cagmres_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_CAGMRESCreate( hypre_CAGMRESFunctions *cagmres_functions )
+{
+   hypre_CAGMRESData *cagmres_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   cagmres_data = hypre_CTAllocF(hypre_CAGMRESData, 1, cagmres_functions, HYPRE_MEMORY_HOST);
+   cagmres_data->functions = cagmres_functions;
+
+   /* set defaults */
+   (cagmres_data -> k_dim)          = 8;
+   (cagmres_data -> s_step)         = 4;
+   (cagmres_data -> tol)            = 1.0e-06; /* relative residual tol */
+   (cagmres_data -> a_tol)          = 0.0; /* abs. residual tol */
+   (cagmres_data -> min_iter)       = 0;
+   (cagmres_data -> max_iter)       = 1000;
+   (cagmres_data -> converged)      = 0;
+   (cagmres_data -> precond_data)   = NULL;
+   (cagmres_data -> print_level)    = 0;
+   (cagmres_data -> logging)        = 0;
+   (cagmres_data -> p)              = NULL;
+   (cagmres_data -> r)              = NULL;
+   (cagmres_data -> z)              = NULL;
+   (cagmres_data -> matvec_data)    = NULL;
+   (cagmres_data -> norms)          = NULL;
+   (cagmres_data -> log_file_name)  = NULL;
+   (cagmres_data -> unroll)         = 0;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) cagmres_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESDestroy( void *cagmres_vdata )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   HYPRE_Int i;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   if (cagmres_data)
+   {
+      hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+
+      hypre_TFreeF( cagmres_data -> norms, cagmres_functions );
+
+      if ( (cagmres_data -> matvec_data) != NULL )
+      {
+         (*(cagmres_functions->MatvecDestroy))(cagmres_data -> matvec_data);
+      }
+
+      if ( (cagmres_data -> r) != NULL )
+      {
+         (*(cagmres_functions->DestroyVector))(cagmres_data -> r);
+      }
+      if ( (cagmres_data -> z) != NULL )
+      {
+         (*(cagmres_functions->DestroyVector))(cagmres_data -> z);
+      }
+
+      if ( (cagmres_data -> p) != NULL )
+      {
+         for (i = 0; i < (cagmres_data -> k_dim + 1); i++)
+         {
+            if ( (cagmres_data -> p)[i] != NULL )
+            {
+               (*(cagmres_functions->DestroyVector))( (cagmres_data -> p) [i]);
+            }
+         }
+         hypre_TFreeF( cagmres_data->p, cagmres_functions );
+      }
+      hypre_TFreeF( cagmres_data, cagmres_functions );
+      hypre_TFreeF( cagmres_functions, cagmres_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_CAGMRESGetResidual( void *cagmres_vdata, void **residual )
+{
+   hypre_CAGMRESData  *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   *residual = cagmres_data->r;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetup( void *cagmres_vdata,
+                    void *A,
+                    void *b,
+                    void *x         )
+{
+   hypre_CAGMRESData *cagmres_data     = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+
+   HYPRE_Int k_dim            = (cagmres_data -> k_dim);
+   HYPRE_Int max_iter         = (cagmres_data -> max_iter);
+   HYPRE_Int (*precond_setup)(void*, void*, void*, void*) = (cagmres_functions->precond_setup);
+   void       *precond_data   = (cagmres_data -> precond_data);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cagmres_data -> A) = A;
+
+   /*--------------------------------------------------
+    * The arguments for NewVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    *--------------------------------------------------*/
+
+   if ((cagmres_data -> p) == NULL)
+   {
+      (cagmres_data -> p) = (void**)(*(cagmres_functions->CreateVectorArray))(k_dim + 1, x);
+   }
+   if ((cagmres_data -> r) == NULL)
+   {
+      (cagmres_data -> r) = (*(cagmres_functions->CreateVector))(b);
+   }
+   if ((cagmres_data -> z) == NULL)
+   {
+      (cagmres_data -> z) = (*(cagmres_functions->CreateVector))(x);
+   }
+
+   if ((cagmres_data -> matvec_data) == NULL)
+   {
+      (cagmres_data -> matvec_data) = (*(cagmres_functions->MatvecCreate))(A, x);
+   }
+
+   precond_setup(precond_data, A, b, x);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (cagmres_data->logging) > 0 || (cagmres_data->print_level) > 0 )
+   {
+      if ((cagmres_data -> norms) == NULL)
+      {
+         (cagmres_data -> norms) = hypre_CTAllocF(HYPRE_Real, max_iter + 1, cagmres_functions,
+                                                  HYPRE_MEMORY_HOST);
+      }
+   }
+   if ( (cagmres_data->print_level) > 0 )
+   {
+      if ((cagmres_data -> log_file_name) == NULL)
+      {
+         (cagmres_data -> log_file_name) = (char*)"cagmres.out.log";
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESBlockOrth
+ *
+ * One pass of block classical Gram-Schmidt followed by Cholesky QR.  The nw
+ * vectors p[nq], ..., p[nq+nw-1] are orthogonalized against the orthonormal
+ * vectors p[0], ..., p[nq-1] and then among themselves, such that
+ *
+ *    W = Q C + W_new R,
+ *
+ * where C (nq x nw) and R (nw x nw, upper triangular) are stored by columns.
+ * All inner products are obtained from a single call to BlockInnerProd, and
+ * the Gram matrix of the projected block is computed as W^T W - C^T C.
+ *
+ * Returns the number of vectors that were normalized.  If the Cholesky
+ * factorization breaks down at column k < nw, column k of C and R is still
+ * filled in with R(k,k) = 0, vector p[nq+k] is left unnormalized, and the
+ * vectors following it are not modified.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CAGMRESBlockOrth( hypre_CAGMRESFunctions *cagmres_functions,
+                        void                  **p,
+                        HYPRE_Int               nq,
+                        HYPRE_Int               nw,
+                        HYPRE_Int               unroll,
+                        HYPRE_Real             *gram,
+                        HYPRE_Real             *alpha,
+                        HYPRE_Real             *C,
+                        HYPRE_Real             *R )
+{
+   HYPRE_Int   ny = nq + nw;
+   HYPRE_Int   nv = nw;
+   HYPRE_Int   i, k, l, m;
+   HYPRE_Real  t, g;
+
+   (*(cagmres_functions->BlockInnerProd))(&p[nq], nw, p, ny, unroll, gram);
+
+   for (k = 0; k < nw; k++)
+   {
+      for (i = 0; i < nq; i++)
+      {
+         C[k * nq + i] = gram[k * ny + i];
+      }
+      for (l = 0; l < nw; l++)
+      {
+         R[k * nw + l] = 0.0;
+      }
+   }
+
+   /* upper Cholesky factor of (W^T W - C^T C) */
+   for (k = 0; k < nw; k++)
+   {
+      for (l = 0; l <= k; l++)
+      {
+         t = gram[k * ny + nq + l];
+         for (i = 0; i < nq; i++)
+         {
+            t -= C[l * nq + i] * C[k * nq + i];
+         }
+         for (m = 0; m < l; m++)
+         {
+            t -= R[l * nw + m] * R[k * nw + m];
+         }
+         if (l < k)
+         {
+            R[k * nw + l] = t / R[l * nw + l];
+         }
+         else
+         {
+            g = gram[k * ny + nq + k];
+            if (t <= HYPRE_REAL_EPSILON * g)
+            {
+               nv = k;
+            }
+            else
+            {
+               R[k * nw + k] = hypre_sqrt(t);
+            }
+         }
+      }
+      if (nv < nw)
+      {
+         break;
+      }
+   }
+
+   /* W_new(:,k) = (W(:,k) - Q C(:,k) - W_new(:,0:k-1) R(0:k-1,k)) / R(k,k) */
+   for (k = 0; k < nv; k++)
+   {
+      for (i = 0; i < nq; i++)
+      {
+         alpha[i] = -C[k * nq + i];
+      }
+      for (l = 0; l < k; l++)
+      {
+         alpha[nq + l] = -R[k * nw + l];
+      }
+      (*(cagmres_functions->MassAxpy))(alpha, p, p[nq + k], nq + k, unroll);
+      (*(cagmres_functions->ScaleVector))(1.0 / R[k * nw + k], p[nq + k]);
+   }
+
+   return nv;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSolve
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSolve(void  *cagmres_vdata,
+                   void  *A,
+                   void  *b,
+                   void  *x)
+{
+   hypre_CAGMRESData      *cagmres_data      = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+   HYPRE_Int     k_dim             = (cagmres_data -> k_dim);
+   HYPRE_Int     s_step            = (cagmres_data -> s_step);
+   HYPRE_Int     unroll            = (cagmres_data -> unroll);
+   HYPRE_Int     min_iter          = (cagmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cagmres_data -> max_iter);
+   HYPRE_Real    r_tol             = (cagmres_data -> tol);
+   HYPRE_Real    a_tol             = (cagmres_data -> a_tol);
+   void         *matvec_data       = (cagmres_data -> matvec_data);
+
+   void         *r                 = (cagmres_data -> r);
+   void         *z                 = (cagmres_data -> z);
+   void        **p                 = (cagmres_data -> p);
+
+   HYPRE_Int (*precond)(void*, void*, void*, void*) = (cagmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cagmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cagmres_data -> print_level);
+   HYPRE_Int logging     = (cagmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cagmres_data -> norms);
+
+   HYPRE_Int   ldh = k_dim + 1;
+   HYPRE_Int   i, j, k, l, col, itmp;
+   HYPRE_Int   nb, nv1, nv2, npass2, s_eff, breakdown, cycle_converged;
+   HYPRE_Int   iter;
+   HYPRE_Int   my_id, num_procs;
+   HYPRE_Real *hh, *rr, *rs, *c, *s;
+   HYPRE_Real *gram, *alpha, *C1, *C2, *R1, *R2, *Ct, *Rt, *kin;
+   HYPRE_Real  epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real  real_r_norm_old;
+
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (cagmres_data -> converged) = 0;
+
+   (*(cagmres_functions->CommInfo))(A, &my_id, &num_procs);
+   if ( logging > 0 || print_level > 0 )
+   {
+      norms = (cagmres_data -> norms);
+   }
+
+   s_step = hypre_max(1, hypre_min(s_step, k_dim));
+
+   /* compute initial residual */
+   (*(cagmres_functions->CopyVector))(b, r);
+   (*(cagmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   b_norm = hypre_sqrt((*(cagmres_functions->InnerProd))(b, b));
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (b_norm != 0.) { ieee_check = b_norm / b_norm; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_CAGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   r_norm = hypre_sqrt((*(cagmres_functions->InnerProd))(r, r));
+
+   if (r_norm != 0.) { ieee_check = r_norm / r_norm; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_CAGMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* initialize work arrays */
+   hh    = hypre_CTAllocF(HYPRE_Real, ldh * k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   rr    = hypre_CTAllocF(HYPRE_Real, ldh * k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   rs    = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cagmres_functions, HYPRE_MEMORY_HOST);
+   c     = hypre_CTAllocF(HYPRE_Real, k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   s     = hypre_CTAllocF(HYPRE_Real, k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   gram  = hypre_CTAllocF(HYPRE_Real, s_step * (k_dim + 1), cagmres_functions,
+                          HYPRE_MEMORY_HOST);
+   alpha = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cagmres_functions, HYPRE_MEMORY_HOST);
+   kin   = hypre_CTAllocF(HYPRE_Real, k_dim + 1, cagmres_functions, HYPRE_MEMORY_HOST);
+   C1    = hypre_CTAllocF(HYPRE_Real, s_step * k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   C2    = hypre_CTAllocF(HYPRE_Real, s_step * k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   Ct    = hypre_CTAllocF(HYPRE_Real, s_step * k_dim, cagmres_functions, HYPRE_MEMORY_HOST);
+   R1    = hypre_CTAllocF(HYPRE_Real, s_step * s_step, cagmres_functions, HYPRE_MEMORY_HOST);
+   R2    = hypre_CTAllocF(HYPRE_Real, s_step * s_step, cagmres_functions, HYPRE_MEMORY_HOST);
+   Rt    = hypre_CTAllocF(HYPRE_Real, s_step * s_step, cagmres_functions, HYPRE_MEMORY_HOST);
+
+   if ( logging > 0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level > 1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm)
+      den_norm = |r_0| or |b| */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon  = hypre_max(a_tol, r_tol * den_norm);
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   real_r_norm_old = r_norm;
+
+   while (1)
+   {
+      /* r holds the true residual here */
+      if ((r_norm <= epsilon && iter >= min_iter) || r_norm == 0.0)
+      {
+         (cagmres_data -> converged) = 1;
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("\n\n");
+            hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+         }
+         break;
+      }
+      if (iter >= max_iter)
+      {
+         break;
+      }
+
+      (*(cagmres_functions->CopyVector))(r, p[0]);
+      (*(cagmres_functions->ScaleVector))(1.0 / r_norm, p[0]);
+      rs[0] = r_norm;
+
+      i = 0;
+      breakdown = 0;
+      cycle_converged = 0;
+
+      /*** RESTART CYCLE (right-preconditioning), s columns at a time ***/
+      while (i < k_dim && iter < max_iter && !breakdown && !cycle_converged)
+      {
+         nb = hypre_min(s_step, hypre_min(k_dim - i, max_iter - iter));
+
+         /* monomial basis: p[i+k] = A M^{-1} p[i+k-1] */
+         for (k = 1; k <= nb; k++)
+         {
+            (*(cagmres_functions->ClearVector))(z);
+            precond(precond_data, A, p[i + k - 1], z);
+            (*(cagmres_functions->Matvec))(matvec_data, 1.0, A, z, 0.0, p[i + k]);
+         }
+
+         /* two passes of block Gram-Schmidt + CholQR, one reduction each */
+         nv1 = hypre_CAGMRESBlockOrth(cagmres_functions, p, i + 1, nb, unroll,
+                                      gram, alpha, C1, R1);
+         npass2 = nv1;
+         nv2 = 0;
+         if (npass2 > 0)
+         {
+            /* C2 and R2 are stored with npass2 columns */
+            nv2 = hypre_CAGMRESBlockOrth(cagmres_functions, p, i + 1, npass2, unroll,
+                                         gram, alpha, C2, R2);
+         }
+         /* If the very first new vector is (numerically) in the span of the
+            basis, the Krylov space is invariant: keep its column, which has a
+            zero subdiagonal entry, and end the cycle.  Otherwise a breakdown
+            only reflects the conditioning of the monomial basis, and the
+            block is truncated to its well-conditioned leading columns. */
+         if (nv1 == 0 || nv2 == 0)
+         {
+            s_eff = 1;
+            breakdown = 1;
+         }
+         else
+         {
+            s_eff = nv2;
+         }
+
+         /* combined factors: C = C1 + C2 R1, R = R2 R1 */
+         for (k = 0; k < s_eff; k++)
+         {
+            for (j = 0; j <= i; j++)
+            {
+               t = C1[k * (i + 1) + j];
+               for (l = 0; l <= hypre_min(k, npass2 - 1); l++)
+               {
+                  t += C2[l * (i + 1) + j] * R1[k * nb + l];
+               }
+               Ct[k * (i + 1) + j] = t;
+            }
+            for (j = 0; j < s_step; j++)
+            {
+               t = 0.0;
+               for (l = j; l <= hypre_min(k, npass2 - 1); l++)
+               {
+                  t += R2[l * npass2 + j] * R1[k * nb + l];
+               }
+               Rt[k * s_step + j] = (j <= k) ? t : 0.0;
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * Recover the Arnoldi columns: A M^{-1} K(:,k) = V Rout(:,k), with
+          * K(:,0) = v_i and K(:,k) = V Rout(:,k-1), so that
+          * H(:,i+k) = (Rout(:,k) - H(:,0:i+k-1) K(0:i+k-1,k)) / K(i+k,k)
+          *-----------------------------------------------------------------*/
+         for (k = 0; k < s_eff; k++)
+         {
+            col  = i + k;
+            itmp = col * ldh;
+
+            for (j = 0; j < ldh; j++) { hh[itmp + j] = 0.0; }
+            for (j = 0; j <= i; j++)
+            {
+               hh[itmp + j] = Ct[k * (i + 1) + j];
+            }
+            for (j = 0; j <= k; j++)
+            {
+               hh[itmp + i + 1 + j] = Rt[k * s_step + j];
+            }
+
+            /* coefficients of the k-th input vector */
+            for (j = 0; j <= col; j++) { kin[j] = 0.0; }
+            if (k == 0)
+            {
+               kin[i] = 1.0;
+            }
+            else
+            {
+               for (j = 0; j <= i; j++)
+               {
+                  kin[j] = Ct[(k - 1) * (i + 1) + j];
+               }
+               for (j = 0; j < k; j++)
+               {
+                  kin[i + 1 + j] = Rt[(k - 1) * s_step + j];
+               }
+            }
+
+            for (l = 0; l < col; l++)
+            {
+               if (kin[l] != 0.0)
+               {
+                  for (j = 0; j <= hypre_min(l + 1, k_dim); j++)
+                  {
+                     hh[itmp + j] -= hh[l * ldh + j] * kin[l];
+                  }
+               }
+            }
+            t = 1.0 / kin[col];
+            for (j = 0; j <= col + 1; j++)
+            {
+               hh[itmp + j] *= t;
+            }
+         }
+
+         /* apply Givens rotations to the new columns and update residual norms */
+         for (k = 0; k < s_eff; k++)
+         {
+            col  = i + k;
+            itmp = col * ldh;
+            iter++;
+
+            for (j = 0; j <= col + 1; j++)
+            {
+               rr[itmp + j] = hh[itmp + j];
+            }
+            for (j = 1; j <= col; j++)
+            {
+               t = rr[itmp + j - 1];
+               rr[itmp + j - 1] = s[j - 1] * rr[itmp + j] + c[j - 1] * t;
+               rr[itmp + j] = -s[j - 1] * t + c[j - 1] * rr[itmp + j];
+            }
+            t = rr[itmp + col + 1] * rr[itmp + col + 1];
+            t += rr[itmp + col] * rr[itmp + col];
+            gamma = hypre_sqrt(t);
+            if (gamma == 0.0) { gamma = epsmac; }
+            c[col] = rr[itmp + col] / gamma;
+            s[col] = rr[itmp + col + 1] / gamma;
+            rs[col + 1] = -s[col] * rs[col];
+            rs[col] = c[col] * rs[col];
+            rr[itmp + col] = c[col] * rr[itmp + col] + s[col] * rr[itmp + col + 1];
+
+            r_norm = hypre_abs(rs[col + 1]);
+            if ( logging > 0 || print_level > 0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level > 1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                                  norms[iter], norms[iter] / norms[iter - 1],
+                                  norms[iter] / b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                                  norms[iter] / norms[iter - 1]);
+               }
+            }
+
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               cycle_converged = 1;
+               k++;
+               break;
+            }
+         }
+         i += k;
+      } /*** end of restart cycle ***/
+
+      /* solve the upper triangular system */
+      rs[i - 1] = rs[i - 1] / rr[(i - 1) * ldh + i - 1];
+      for (k = i - 2; k >= 0; k--)
+      {
+         t = rs[k];
+         for (j = k + 1; j < i; j++)
+         {
+            t -= rr[j * ldh + k] * rs[j];
+         }
+         rs[k] = t / rr[k * ldh + k];
+      }
+
+      /* x += M^{-1} V y */
+      (*(cagmres_functions->ClearVector))(r);
+      (*(cagmres_functions->MassAxpy))(rs, p, r, i, unroll);
+      (*(cagmres_functions->ClearVector))(z);
+      precond(precond_data, A, r, z);
+      (*(cagmres_functions->Axpy))(1.0, z, x);
+
+      /* true residual */
+      (*(cagmres_functions->CopyVector))(b, r);
+      (*(cagmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      r_norm = hypre_sqrt((*(cagmres_functions->InnerProd))(r, r));
+
+      if (cycle_converged && !(r_norm <= epsilon))
+      {
+         /* exit if the true residual norm has not decreased */
+         if (r_norm >= real_r_norm_old)
+         {
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            break;
+         }
+         if ( print_level > 0 && my_id == 0)
+         {
+            hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+         }
+      }
+      real_r_norm_old = r_norm;
+   }
+
+   (cagmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+   {
+      (cagmres_data -> rel_residual_norm) = r_norm / b_norm;
+   }
+   if (b_norm == 0.0)
+   {
+      (cagmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) { hypre_error(HYPRE_ERROR_CONV); }
+
+   hypre_TFreeF(hh, cagmres_functions);
+   hypre_TFreeF(rr, cagmres_functions);
+   hypre_TFreeF(rs, cagmres_functions);
+   hypre_TFreeF(c, cagmres_functions);
+   hypre_TFreeF(s, cagmres_functions);
+   hypre_TFreeF(gram, cagmres_functions);
+   hypre_TFreeF(alpha, cagmres_functions);
+   hypre_TFreeF(kin, cagmres_functions);
+   hypre_TFreeF(C1, cagmres_functions);
+   hypre_TFreeF(C2, cagmres_functions);
+   hypre_TFreeF(Ct, cagmres_functions);
+   hypre_TFreeF(R1, cagmres_functions);
+   hypre_TFreeF(R2, cagmres_functions);
+   hypre_TFreeF(Rt, cagmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetKDim, hypre_CAGMRESGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetKDim( void   *cagmres_vdata,
+                      HYPRE_Int   k_dim )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> k_dim) = k_dim;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetKDim( void   *cagmres_vdata,
+                      HYPRE_Int * k_dim )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *k_dim = (cagmres_data -> k_dim);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetSStep, hypre_CAGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetSStep( void   *cagmres_vdata,
+                       HYPRE_Int   s_step )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   if (s_step < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (cagmres_data -> s_step) = s_step;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetSStep( void   *cagmres_vdata,
+                       HYPRE_Int * s_step )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *s_step = (cagmres_data -> s_step);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetUnroll, hypre_CAGMRESGetUnroll
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetUnroll( void   *cagmres_vdata,
+                        HYPRE_Int   unroll )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> unroll) = unroll;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetUnroll( void   *cagmres_vdata,
+                        HYPRE_Int * unroll )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *unroll = (cagmres_data -> unroll);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetTol, hypre_CAGMRESGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetTol( void   *cagmres_vdata,
+                     HYPRE_Real  tol       )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetTol( void   *cagmres_vdata,
+                     HYPRE_Real  * tol      )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *tol = (cagmres_data -> tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetAbsoluteTol, hypre_CAGMRESGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetAbsoluteTol( void   *cagmres_vdata,
+                             HYPRE_Real  a_tol       )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetAbsoluteTol( void   *cagmres_vdata,
+                             HYPRE_Real  * a_tol      )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *a_tol = (cagmres_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetMinIter, hypre_CAGMRESGetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetMinIter( void *cagmres_vdata,
+                         HYPRE_Int   min_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> min_iter) = min_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetMinIter( void *cagmres_vdata,
+                         HYPRE_Int * min_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *min_iter = (cagmres_data -> min_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetMaxIter, hypre_CAGMRESGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetMaxIter( void *cagmres_vdata,
+                         HYPRE_Int   max_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetMaxIter( void *cagmres_vdata,
+                         HYPRE_Int * max_iter  )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *max_iter = (cagmres_data -> max_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetPrecond( void  *cagmres_vdata,
+                         HYPRE_Int  (*precond)(void*, void*, void*, void*),
+                         HYPRE_Int  (*precond_setup)(void*, void*, void*, void*),
+                         void  *precond_data )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+   hypre_CAGMRESFunctions *cagmres_functions = cagmres_data->functions;
+
+   (cagmres_functions -> precond)        = precond;
+   (cagmres_functions -> precond_setup)  = precond_setup;
+   (cagmres_data -> precond_data)   = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetPrecond( void         *cagmres_vdata,
+                         HYPRE_Solver *precond_data_ptr )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *precond_data_ptr = (HYPRE_Solver)(cagmres_data -> precond_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetPrintLevel, hypre_CAGMRESGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetPrintLevel( void *cagmres_vdata,
+                            HYPRE_Int   level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> print_level) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetPrintLevel( void *cagmres_vdata,
+                            HYPRE_Int * level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *level = (cagmres_data -> print_level);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESSetLogging, hypre_CAGMRESGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESSetLogging( void *cagmres_vdata,
+                         HYPRE_Int   level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   (cagmres_data -> logging) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CAGMRESGetLogging( void *cagmres_vdata,
+                         HYPRE_Int * level)
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *level = (cagmres_data -> logging);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetNumIterations( void *cagmres_vdata,
+                               HYPRE_Int  *num_iterations )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *num_iterations = (cagmres_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetConverged( void *cagmres_vdata,
+                           HYPRE_Int  *converged )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *converged = (cagmres_data -> converged);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CAGMRESGetFinalRelativeResidualNorm( void   *cagmres_vdata,
+                                           HYPRE_Real *relative_residual_norm )
+{
+   hypre_CAGMRESData *cagmres_data = (hypre_CAGMRESData *)cagmres_vdata;
+
+   *relative_residual_norm = (cagmres_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
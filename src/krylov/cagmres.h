@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * CAGMRES s-step (communication-avoiding) gmres
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_CAGMRES_HEADER
+#define hypre_KRYLOV_CAGMRES_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic CAGMRES Interface
+ *
+ * s-step GMRES: each block of s Krylov vectors is generated with s successive
+ * preconditioned matvecs and is then orthogonalized against the current basis
+ * with two passes of block classical Gram-Schmidt plus Cholesky QR.  Every
+ * pass needs a single global reduction, so a restart cycle of length k_dim
+ * performs about 2 k_dim / s reductions instead of 2 k_dim.
+ *
+ * @memo A generic s-step GMRES linear solver interface
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESData and hypre_CAGMRESFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name CAGMRES structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_CAGMRESFunctions} object ...
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Int unroll, void *result );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll);
+   HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
+   HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
+
+} hypre_CAGMRESFunctions;
+
+/**
+ * The {\tt hypre\_CAGMRESData} object ...
+ **/
+
+typedef struct
+{
+   HYPRE_Int      k_dim;
+   HYPRE_Int      s_step;
+   HYPRE_Int      unroll;
+   HYPRE_Int      min_iter;
+   HYPRE_Int      max_iter;
+   HYPRE_Int      converged;
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Real   rel_residual_norm;
+
+   void  *A;
+   void  *r;
+   void  *z;
+   void  **p;
+
+   void    *matvec_data;
+   void    *precond_data;
+
+   hypre_CAGMRESFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int      num_iterations;
+
+   HYPRE_Int     print_level; /* printing when print_level>0 */
+   HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   char    *log_file_name;
+
+} hypre_CAGMRESData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic CAGMRES Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_CAGMRESFunctions *
+hypre_CAGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Int unroll, void *result ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+);
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_CAGMRESCreate( hypre_CAGMRESFunctions *cagmres_functions );
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -201,6 +201,7 @@ hypre_GMRESSetup( void *gmres_vdata,
    HYPRE_Int (*precond_setup)(void*, void*, void*, void*) = (gmres_functions->precond_setup);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_SETUP);
 
    (gmres_data -> A) = A;
 
@@ -261,6 +262,7 @@ hypre_GMRESSetup( void *gmres_vdata,
       }
    }
 
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -326,6 +328,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Real            real_r_norm_old, real_r_norm_new;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_SOLVE);
 
    (gmres_data -> converged) = 0;
    /*-----------------------------------------------------------------------
@@ -359,7 +362,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
    (*(gmres_functions->CopyVector))(b, p[0]);
 
    /* compute initial residual */
+   hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_MATVEC);
    (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+   hypre_ProfileEnd();
 
    b_norm = hypre_sqrt((*(gmres_functions->InnerProd))(b, b));
    real_r_norm_old = b_norm;
@@ -386,6 +391,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
          hypre_printf("ERROR detected by Hypre ... END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -416,6 +422,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
          hypre_printf("ERROR detected by Hypre ... END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -492,6 +499,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
          for (i = 0; i < k_dim + 1; i++) { hypre_TFreeF(hh[i], gmres_functions); }
          hypre_TFreeF(hh, gmres_functions);
          (gmres_data -> num_iterations) = iter;
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -505,7 +513,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                            * relative change is on*/
          {
             (*(gmres_functions->CopyVector))(b, r);
+            hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_MATVEC);
             (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            hypre_ProfileEnd();
             r_norm = hypre_sqrt((*(gmres_functions->InnerProd))(r, r));
             if (r_norm  <= epsilon)
             {
@@ -536,8 +546,12 @@ hypre_GMRESSolve(void  *gmres_vdata,
          i++;
          iter++;
          (*(gmres_functions->ClearVector))(r);
+         hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_PRECOND);
          precond(precond_data, A, p[i - 1], r);
+         hypre_ProfileEnd();
+         hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_MATVEC);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
+         hypre_ProfileEnd();
          /* modified Gram_Schmidt */
          for (j = 0; j < i; j++)
          {
@@ -659,7 +673,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                }
                (*(gmres_functions->ClearVector))(r);
                /* find correction (in r) */
+               hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_PRECOND);
                precond(precond_data, A, w, r);
+               hypre_ProfileEnd();
                /* copy current solution (x) to w (don't want to over-write x)*/
                (*(gmres_functions->CopyVector))(x, w);
 
@@ -703,7 +719,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                      (*(gmres_functions->Axpy))(rs_2[i - 1], p[i - 1], w);
                      (*(gmres_functions->ClearVector))(r);
                      /* apply the preconditioner */
+                     hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_PRECOND);
                      precond(precond_data, A, w, r);
+                     hypre_ProfileEnd();
                      /* now r contains x_i - x_i-1 */
                   }
                   /* find the norm of x_i - x_i-1 */
@@ -758,7 +776,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
       (*(gmres_functions->ClearVector))(r);
       /* find correction (in r) */
+      hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_PRECOND);
       precond(precond_data, A, w, r);
+      hypre_ProfileEnd();
 
       /* update current solution x (in x) */
       (*(gmres_functions->Axpy))(1.0, r, x);
@@ -774,7 +794,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
          /* calculate actual residual norm*/
          (*(gmres_functions->CopyVector))(b, r);
+         hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_MATVEC);
          (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         hypre_ProfileEnd();
          real_r_norm_new = r_norm = hypre_sqrt( (*(gmres_functions->InnerProd))(r, r) );
 
          if (r_norm <= epsilon)
@@ -797,7 +819,9 @@ hypre_GMRESSolve(void  *gmres_vdata,
                   (*(gmres_functions->Axpy))(rs[i - 1], p[i - 1], w);
                   (*(gmres_functions->ClearVector))(r);
                   /* apply the preconditioner */
+                  hypre_ProfileBegin(HYPRE_PROFILE_GMRES, 0, HYPRE_PROFILE_PRECOND);
                   precond(precond_data, A, w, r);
+                  hypre_ProfileEnd();
                   /* find the norm of x_i - x_i-1 */
                   w_norm = hypre_sqrt( (*(gmres_functions->InnerProd))(r, r) );
                   relative_error = w_norm / x_norm;
@@ -919,6 +943,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    hypre_TFreeF(hh, gmres_functions);
 
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -688,6 +688,169 @@ extern "C" {
 
 /***********end of KS code *********/
 
+/******************************************************************************
+ *
+ * CAGMRES s-step (communication-avoiding) gmres
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_CAGMRES_HEADER
+#define hypre_KRYLOV_CAGMRES_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic CAGMRES Interface
+ *
+ * s-step GMRES: each block of s Krylov vectors is generated with s successive
+ * preconditioned matvecs and is then orthogonalized against the current basis
+ * with two passes of block classical Gram-Schmidt plus Cholesky QR.  Every
+ * pass needs a single global reduction, so a restart cycle of length k_dim
+ * performs about 2 k_dim / s reductions instead of 2 k_dim.
+ *
+ * @memo A generic s-step GMRES linear solver interface
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_CAGMRESData and hypre_CAGMRESFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name CAGMRES structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_CAGMRESFunctions} object ...
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Int unroll, void *result );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll);
+   HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
+   HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
+
+} hypre_CAGMRESFunctions;
+
+/**
+ * The {\tt hypre\_CAGMRESData} object ...
+ **/
+
+typedef struct
+{
+   HYPRE_Int      k_dim;
+   HYPRE_Int      s_step;
+   HYPRE_Int      unroll;
+   HYPRE_Int      min_iter;
+   HYPRE_Int      max_iter;
+   HYPRE_Int      converged;
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Real   rel_residual_norm;
+
+   void  *A;
+   void  *r;
+   void  *z;
+   void  **p;
+
+   void    *matvec_data;
+   void    *precond_data;
+
+   hypre_CAGMRESFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int      num_iterations;
+
+   HYPRE_Int     print_level; /* printing when print_level>0 */
+   HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   char    *log_file_name;
+
+} hypre_CAGMRESData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic CAGMRES Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_CAGMRESFunctions *
+hypre_CAGMRESFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*BlockInnerProd)( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                   HYPRE_Int unroll, void *result ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
+                                   HYPRE_Int unroll),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+);
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_CAGMRESCreate( hypre_CAGMRESFunctions *cagmres_functions );
+
+#ifdef __cplusplus
+}
+#endif
+#endif
+
 
 
 /******************************************************************************
@@ -1070,6 +1233,23 @@ typedef struct
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
+   /* optional: r = b - A*x fused with a non-blocking reduction of <r,r> */
+   HYPRE_Int    (*ResidualNorm2Begin) ( void *A, void *x, void *b, void *r,
+                                        HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   HYPRE_Int    (*ResidualNorm2End)   ( hypre_MPI_Request *request );
+
+   /* optional: <x[k],y[k]> for k < n, completed by a single non-blocking reduction */
+   HYPRE_Int    (*InnerProdBegin)     ( HYPRE_Int n, void **x, void **y,
+                                        HYPRE_Real *result, hypre_MPI_Request *request );
+   HYPRE_Int    (*InnerProdEnd)       ( hypre_MPI_Request *request );
+
+   /* optional: per-component operations on multicomponent vectors, which
+      are then solved as independent systems in lockstep */
+   HYPRE_Int    (*NumVectors)         ( void *x );
+   HYPRE_Int    (*ComponentInnerProd) ( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ComponentAxpy)      ( HYPRE_Complex *alpha, void *x, void *y );
+   HYPRE_Int    (*ComponentScale)     ( HYPRE_Complex *alpha, void *x );
+
 } hypre_PCGFunctions;
 
 /**
@@ -1105,6 +1285,16 @@ typedef struct
    every "recompute_residual_p" iterations.  This can be expensive and degrade the
    convergence. Use it only if you have seen a problem with the regular residual
    computation.
+   - pipelined means: use the pipelined (Ghysels-Vanroose) variant, which needs a
+   single non-blocking reduction per iteration, overlapped with the preconditioner
+   and the matvec.  It requires the InnerProdBegin/End functions, and ignores
+   rel_change, recompute_residual(_p), rtol, cf_tol, atolf and stop_crit.
+ - multicomponent right-hand sides (when the NumVectors and Component* functions
+are given) are solved as independent systems that share each matvec and
+preconditioner apply.  Every component has its own step lengths and stops being
+updated once it converges; the iteration count and the relative residual norm
+refer to the slowest component.  The same options as for the pipelined variant
+are ignored.
    */
 
 typedef struct
@@ -1122,6 +1312,7 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
 
    void    *A;
    void    *p;
@@ -1129,6 +1320,14 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
 
+   /* additional vectors for the pipelined variant (created on demand) */
+   void    *u; /* C*r */
+   void    *w; /* A*u */
+   void    *m; /* C*w */
+   void    *n; /* A*m */
+   void    *q;
+   void    *z;
+
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
    void    *precond_data;
@@ -1325,6 +1524,38 @@ HYPRE_Int hypre_COGMRESSetModifyPC ( void *fgmres_vdata, HYPRE_Int (*modify_pc )
 
 
 
+/* cagmres.c */
+void *hypre_CAGMRESCreate ( hypre_CAGMRESFunctions *cagmres_functions );
+HYPRE_Int hypre_CAGMRESDestroy ( void *cagmres_vdata );
+HYPRE_Int hypre_CAGMRESGetResidual ( void *cagmres_vdata, void **residual );
+HYPRE_Int hypre_CAGMRESSetup ( void *cagmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_CAGMRESSolve ( void *cagmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_CAGMRESSetKDim ( void *cagmres_vdata, HYPRE_Int k_dim );
+HYPRE_Int hypre_CAGMRESGetKDim ( void *cagmres_vdata, HYPRE_Int *k_dim );
+HYPRE_Int hypre_CAGMRESSetSStep ( void *cagmres_vdata, HYPRE_Int s_step );
+HYPRE_Int hypre_CAGMRESGetSStep ( void *cagmres_vdata, HYPRE_Int *s_step );
+HYPRE_Int hypre_CAGMRESSetUnroll ( void *cagmres_vdata, HYPRE_Int unroll );
+HYPRE_Int hypre_CAGMRESGetUnroll ( void *cagmres_vdata, HYPRE_Int *unroll );
+HYPRE_Int hypre_CAGMRESSetTol ( void *cagmres_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_CAGMRESGetTol ( void *cagmres_vdata, HYPRE_Real *tol );
+HYPRE_Int hypre_CAGMRESSetAbsoluteTol ( void *cagmres_vdata, HYPRE_Real a_tol );
+HYPRE_Int hypre_CAGMRESGetAbsoluteTol ( void *cagmres_vdata, HYPRE_Real *a_tol );
+HYPRE_Int hypre_CAGMRESSetMinIter ( void *cagmres_vdata, HYPRE_Int min_iter );
+HYPRE_Int hypre_CAGMRESGetMinIter ( void *cagmres_vdata, HYPRE_Int *min_iter );
+HYPRE_Int hypre_CAGMRESSetMaxIter ( void *cagmres_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_CAGMRESGetMaxIter ( void *cagmres_vdata, HYPRE_Int *max_iter );
+HYPRE_Int hypre_CAGMRESSetPrecond ( void *cagmres_vdata, HYPRE_Int (*precond )(void*, void*, void*,
+                                                                               void*), HYPRE_Int (*precond_setup )(void*, void*, void*, void*), void *precond_data );
+HYPRE_Int hypre_CAGMRESGetPrecond ( void *cagmres_vdata, HYPRE_Solver *precond_data_ptr );
+HYPRE_Int hypre_CAGMRESSetPrintLevel ( void *cagmres_vdata, HYPRE_Int level );
+HYPRE_Int hypre_CAGMRESGetPrintLevel ( void *cagmres_vdata, HYPRE_Int *level );
+HYPRE_Int hypre_CAGMRESSetLogging ( void *cagmres_vdata, HYPRE_Int level );
+HYPRE_Int hypre_CAGMRESGetLogging ( void *cagmres_vdata, HYPRE_Int *level );
+HYPRE_Int hypre_CAGMRESGetNumIterations ( void *cagmres_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_CAGMRESGetConverged ( void *cagmres_vdata, HYPRE_Int *converged );
+HYPRE_Int hypre_CAGMRESGetFinalRelativeResidualNorm ( void *cagmres_vdata,
+                                                      HYPRE_Real *relative_residual_norm );
+
 /* flexgmres.c */
 void *hypre_FlexGMRESCreate ( hypre_FlexGMRESFunctions *fgmres_functions );
 HYPRE_Int hypre_FlexGMRESDestroy ( void *fgmres_vdata );
@@ -1503,6 +1734,37 @@ HYPRE_Int HYPRE_COGMRESGetConverged ( HYPRE_Solver solver, HYPRE_Int *converged
 HYPRE_Int HYPRE_COGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
 HYPRE_Int HYPRE_COGMRESGetResidual ( HYPRE_Solver solver, void *residual );
 
+/* HYPRE_cagmres.c */
+HYPRE_Int HYPRE_CAGMRESSetup ( HYPRE_Solver solver, HYPRE_Matrix A, HYPRE_Vector b,
+                               HYPRE_Vector x );
+HYPRE_Int HYPRE_CAGMRESSolve ( HYPRE_Solver solver, HYPRE_Matrix A, HYPRE_Vector b,
+                               HYPRE_Vector x );
+HYPRE_Int HYPRE_CAGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
+HYPRE_Int HYPRE_CAGMRESGetKDim ( HYPRE_Solver solver, HYPRE_Int *k_dim );
+HYPRE_Int HYPRE_CAGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_CAGMRESGetSStep ( HYPRE_Solver solver, HYPRE_Int *s_step );
+HYPRE_Int HYPRE_CAGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
+HYPRE_Int HYPRE_CAGMRESGetUnroll ( HYPRE_Solver solver, HYPRE_Int *unroll );
+HYPRE_Int HYPRE_CAGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_CAGMRESGetTol ( HYPRE_Solver solver, HYPRE_Real *tol );
+HYPRE_Int HYPRE_CAGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
+HYPRE_Int HYPRE_CAGMRESGetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real *a_tol );
+HYPRE_Int HYPRE_CAGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
+HYPRE_Int HYPRE_CAGMRESGetMinIter ( HYPRE_Solver solver, HYPRE_Int *min_iter );
+HYPRE_Int HYPRE_CAGMRESSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_CAGMRESGetMaxIter ( HYPRE_Solver solver, HYPRE_Int *max_iter );
+HYPRE_Int HYPRE_CAGMRESSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
+                                    HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_CAGMRESGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_CAGMRESSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_CAGMRESGetPrintLevel ( HYPRE_Solver solver, HYPRE_Int *level );
+HYPRE_Int HYPRE_CAGMRESSetLogging ( HYPRE_Solver solver, HYPRE_Int level );
+HYPRE_Int HYPRE_CAGMRESGetLogging ( HYPRE_Solver solver, HYPRE_Int *level );
+HYPRE_Int HYPRE_CAGMRESGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_CAGMRESGetConverged ( HYPRE_Solver solver, HYPRE_Int *converged );
+HYPRE_Int HYPRE_CAGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+HYPRE_Int HYPRE_CAGMRESGetResidual ( HYPRE_Solver solver, void *residual );
+
 /* HYPRE_flexgmres.c */
 HYPRE_Int HYPRE_FlexGMRESSetup ( HYPRE_Solver solver, HYPRE_Matrix A, HYPRE_Vector b,
                                  HYPRE_Vector x );
@@ -1588,6 +1850,8 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual ( HYPRE_Solver solver, HYPRE_Int recompu
 HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver, HYPRE_Int *recompute_residual );
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver, HYPRE_Int recompute_residual_p );
 HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver, HYPRE_Int *recompute_residual_p );
+HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                 HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -1606,6 +1870,8 @@ HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSolveMulti ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata, HYPRE_Real a_tol );
@@ -1626,6 +1892,8 @@ HYPRE_Int hypre_PCGSetRecomputeResidual ( void *pcg_vdata, HYPRE_Int recompute_r
 HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata, HYPRE_Int *recompute_residual );
 HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata, HYPRE_Int recompute_residual_p );
 HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata, HYPRE_Int *recompute_residual_p );
+HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata, HYPRE_Int stop_crit );
 HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata, HYPRE_Int *stop_crit );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata, HYPRE_Solver *precond_data_ptr );
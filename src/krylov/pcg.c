@@ -101,6 +101,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,12 +112,41 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> q)            = NULL;
+   (pcg_data -> z)            = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGPipelinedVectorsDestroy
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGPipelinedVectorsDestroy( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vecs[6] = { &(pcg_data -> u), &(pcg_data -> w), &(pcg_data -> m),
+                                   &(pcg_data -> n), &(pcg_data -> q), &(pcg_data -> z)
+                                 };
+   HYPRE_Int           k;
+
+   for (k = 0; k < 6; k++)
+   {
+      if (*vecs[k] != NULL)
+      {
+         (*(pcg_functions->DestroyVector))(*vecs[k]);
+         *vecs[k] = NULL;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -161,6 +191,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGPipelinedVectorsDestroy(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -200,6 +231,7 @@ hypre_PCGSetup( void *pcg_vdata,
    void          *precond_data     = (pcg_data -> precond_data);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_SETUP);
 
    (pcg_data -> A) = A;
 
@@ -227,6 +259,9 @@ hypre_PCGSetup( void *pcg_vdata,
    }
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   /* created on demand by hypre_PCGSolvePipelined */
+   hypre_PCGPipelinedVectorsDestroy(pcg_data);
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
    {
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
@@ -256,6 +291,7 @@ hypre_PCGSetup( void *pcg_vdata,
                                                 pcg_functions, HYPRE_MEMORY_HOST );
    }
 
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -334,7 +370,26 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   /* compute r = b - Ax together with <r,r> when the initial norm is needed */
+   HYPRE_Int       fused_i_prod_0 = two_norm && (pcg_functions -> ResidualNorm2Begin) &&
+                                    (logging > 0 || print_level > 0 || cf_tol > 0.0);
+   hypre_MPI_Request i_prod_request;
+
+   if ((pcg_functions -> NumVectors) && (*(pcg_functions->NumVectors))(b) > 1)
+   {
+      return hypre_PCGSolveMulti(pcg_vdata, A, b, x);
+   }
+
+   /* the pipelined variant implements only the default stopping test */
+   if ((pcg_data -> pipelined) && (pcg_functions -> InnerProdBegin) &&
+       !stop_crit && !rel_change && !recompute_residual && !recompute_residual_p &&
+       atolf == 0.0 && cf_tol == 0.0 && rtol == 0.0)
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_SOLVE);
 
    (pcg_data -> converged) = 0;
 
@@ -367,7 +422,9 @@ hypre_PCGSolve( void *pcg_vdata,
    {
       /* bi_prod = <C*b,b> */
       (*(pcg_functions->ClearVector))(p);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
       precond(precond_data, A, b, p);
+      hypre_ProfileEnd();
       bi_prod = (*(pcg_functions->InnerProd))(p, b);
       if (print_level > 1 && my_id == 0)
       {
@@ -394,6 +451,7 @@ hypre_PCGSolve( void *pcg_vdata,
          hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -433,6 +491,7 @@ hypre_PCGSolve( void *pcg_vdata,
          norms[0]     = 0.0;
          rel_norms[i] = 0.0;
       }
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -441,18 +500,35 @@ hypre_PCGSolve( void *pcg_vdata,
    };
 
    /* r = b - Ax */
-   (*(pcg_functions->CopyVector))(b, r);
+   if (fused_i_prod_0)
+   {
+      /* the reduction of <r,r> is overlapped with the preconditioner */
+      (*(pcg_functions->ResidualNorm2Begin))(A, x, b, r, &i_prod_0, &i_prod_request);
+   }
+   else
+   {
+      (*(pcg_functions->CopyVector))(b, r);
 
-   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+      (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      hypre_ProfileEnd();
+   }
 
    //hypre_ParVectorUpdateHost(r);
    /* p = C*r */
    (*(pcg_functions->ClearVector))(p);
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
    precond(precond_data, A, r, p);
+   hypre_ProfileEnd();
 
    /* gamma = <r,p> */
    gamma = (*(pcg_functions->InnerProd))(r, p);
 
+   if (fused_i_prod_0)
+   {
+      (*(pcg_functions->ResidualNorm2End))(&i_prod_request);
+   }
+
    /* Since it is does not diminish performance, attempt to return an error flag
       and notify users when they supply bad input. */
    if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
@@ -472,6 +548,7 @@ hypre_PCGSolve( void *pcg_vdata,
          hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
       }
       hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -482,7 +559,10 @@ hypre_PCGSolve( void *pcg_vdata,
    {
       if (two_norm)
       {
-         i_prod_0 = (*(pcg_functions->InnerProd))(r, r);
+         if (!fused_i_prod_0)
+         {
+            i_prod_0 = (*(pcg_functions->InnerProd))(r, r);
+         }
       }
       else
       {
@@ -529,7 +609,9 @@ hypre_PCGSolve( void *pcg_vdata,
       recompute_true_residual = recompute_residual_p && !(i % recompute_residual_p);
 
       /* s = A*p */
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
       (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+      hypre_ProfileEnd();
 
       /* alpha = gamma / <s,p> */
       sdotp = (*(pcg_functions->InnerProd))(s, p);
@@ -564,7 +646,9 @@ hypre_PCGSolve( void *pcg_vdata,
             hypre_printf("Recomputing the residual...\n");
          }
          (*(pcg_functions->CopyVector))(b, r);
+         hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
          (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         hypre_ProfileEnd();
       }
 
       /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
@@ -584,7 +668,9 @@ hypre_PCGSolve( void *pcg_vdata,
 
       /* s = C*r */
       (*(pcg_functions->ClearVector))(s);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
       precond(precond_data, A, r, s);
+      hypre_ProfileEnd();
 
       /* gamma = <r,s> */
       gamma = (*(pcg_functions->InnerProd))(r, s);
@@ -669,22 +755,33 @@ hypre_PCGSolve( void *pcg_vdata,
             This calculation is coded on the assumption that r's accuracy is only a
             concern for problems where CG takes many iterations. */
       {
-         /* r = b - Ax */
-         (*(pcg_functions->CopyVector))(b, r);
-         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-
-         /* set i_prod for convergence test */
-         if (two_norm)
+         /* r = b - Ax, and set i_prod for convergence test */
+         if (two_norm && pcg_functions->ResidualNorm2Begin)
          {
-            i_prod = (*(pcg_functions->InnerProd))(r, r);
+            (*(pcg_functions->ResidualNorm2Begin))(A, x, b, r, &i_prod, &i_prod_request);
+            (*(pcg_functions->ResidualNorm2End))(&i_prod_request);
          }
          else
          {
-            /* s = C*r */
-            (*(pcg_functions->ClearVector))(s);
-            precond(precond_data, A, r, s);
-            /* iprod = gamma = <r,s> */
-            i_prod = (*(pcg_functions->InnerProd))(r, s);
+            (*(pcg_functions->CopyVector))(b, r);
+            hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            hypre_ProfileEnd();
+
+            if (two_norm)
+            {
+               i_prod = (*(pcg_functions->InnerProd))(r, r);
+            }
+            else
+            {
+               /* s = C*r */
+               (*(pcg_functions->ClearVector))(s);
+               hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+               precond(precond_data, A, r, s);
+               hypre_ProfileEnd();
+               /* iprod = gamma = <r,s> */
+               i_prod = (*(pcg_functions->InnerProd))(r, s);
+            }
          }
          if (i_prod / bi_prod >= eps) { tentatively_converged = 0; }
       }
@@ -794,6 +891,782 @@ hypre_PCGSolve( void *pcg_vdata,
       (pcg_data -> rel_residual_norm) = 0.0;
    }
 
+   hypre_ProfileEnd();
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *--------------------------------------------------------------------------
+ *
+ * Pipelined preconditioned CG (P. Ghysels and W. Vanroose, "Hiding global
+ * synchronization latency in the preconditioned Conjugate Gradient
+ * algorithm", Parallel Computing 40, 2014).  The inner products
+ *
+ *       gamma = <r,u>,  delta = <w,u>  (and <r,r> for the two-norm)
+ *
+ * are combined into a single non-blocking reduction, which is overlapped with
+ * the preconditioner apply m = C*w and the matvec n = A*m.  The recurrences
+ * for u = C*r and w = A*u replace the preconditioner and matvec of the
+ * standard algorithm, at the cost of six extra vectors.  The stopping test is
+ * the same as in hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *u, *w, *m, *n, *q, *z;
+   void           *ip_x[3], *ip_y[3];
+   HYPRE_Real      ip_result[3];
+   HYPRE_Int       num_ip;
+   hypre_MPI_Request ip_request;
+
+   HYPRE_Real      alpha = 0.0, alpha_old, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod = 0.0;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_SOLVE);
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   if ( (pcg_data -> u) == NULL )
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+   }
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   q = (pcg_data -> q);
+   z = (pcg_data -> z);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+      precond(precond_data, A, b, p);
+      hypre_ProfileEnd();
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+   }
+
+   if (bi_prod != bi_prod)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+         hypre_printf("ERROR -- hypre_PCGSolvePipelined: INFs and/or NaNs detected in input.\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_ProfileEnd();
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if (bi_prod > 0.0)
+   {
+      eps = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+   }
+   else
+   {
+      /* the rhs vector b is zero: set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      hypre_ProfileEnd();
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   hypre_ProfileEnd();
+   (*(pcg_functions->ClearVector))(u);
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+   precond(precond_data, A, r, u);
+   hypre_ProfileEnd();
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+   hypre_ProfileEnd();
+
+   ip_x[0] = r; ip_y[0] = u;
+   ip_x[1] = w; ip_y[1] = u;
+   ip_x[2] = r; ip_y[2] = r;
+   num_ip  = two_norm ? 3 : 2;
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   while (1)
+   {
+      /* gamma = <r,u>, delta = <w,u>, and <r,r> in a single reduction */
+      (*(pcg_functions->InnerProdBegin))(num_ip, ip_x, ip_y, ip_result, &ip_request);
+
+      /* overlapped with the reduction: m = C*w, n = A*m */
+      if (i < max_iter)
+      {
+         (*(pcg_functions->ClearVector))(m);
+         hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+         precond(precond_data, A, w, m);
+         hypre_ProfileEnd();
+         hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+         hypre_ProfileEnd();
+      }
+
+      (*(pcg_functions->InnerProdEnd))(&ip_request);
+
+      gamma  = ip_result[0];
+      delta  = ip_result[1];
+      i_prod = two_norm ? ip_result[2] : gamma;
+
+      if (gamma != gamma)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in pipelined PCG");
+         break;
+      }
+
+      /* print norm info */
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = hypre_sqrt(i_prod);
+         rel_norms[i] = hypre_sqrt(i_prod / bi_prod);
+      }
+      if ( print_level > 1 && my_id == 0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i] / norms[i - 1], rel_norms[i] );
+      }
+
+      /* the basic convergence test */
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+
+      /* beta = gamma / gamma_old, alpha = gamma / (delta - beta * gamma / alpha_old) */
+      alpha_old = alpha;
+      if (i > 0)
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha_old;
+      }
+      else
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      if (! (denom > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha     = gamma / denom;
+      gamma_old = gamma;
+
+      /* z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p */
+      if (i > 0)
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+      else
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+
+      /* x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      i++;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   hypre_ProfileEnd();
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolveMulti
+ *--------------------------------------------------------------------------
+ *
+ * Preconditioned CG for multicomponent vectors b and x, whose components are
+ * independent right-hand sides and solutions.  Each component k follows the
+ * recurrences of hypre_PCGSolve with its own alpha_k and beta_k, while the
+ * matvec, the preconditioner and the inner products are applied to all
+ * components at once, so A and the preconditioner are traversed once per
+ * iteration for all right-hand sides.
+ *
+ * The stopping tests of hypre_PCGSolve (including stop_crit, atolf, rel_change,
+ * recompute_residual, rtol and cf_tol) are applied to each component.  A
+ * component that stops is frozen by zeroing its step length.  The iteration
+ * stops when every component has stopped, and is converged when every
+ * component has passed the convergence test.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolveMulti( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Real      cf_tol       = (pcg_data -> cf_tol);
+   HYPRE_Real      rtol         = (pcg_data -> rtol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   HYPRE_Int       num_vectors  = (*(pcg_functions->NumVectors))(b);
+   HYPRE_Real     *bi_prod, *eps, *gamma, *gamma_old, *sdotp, *i_prod;
+   HYPRE_Real     *i_prod_0, *cf_ave_0, *cf_ave_1, *pi_prod, *xi_prod, *ss_prod;
+   HYPRE_Complex  *alpha, *beta;
+   HYPRE_Int      *active, *tentative;
+   HYPRE_Int       num_active, num_converged, num_nonzero;
+   HYPRE_Real      max_rel = 0.0, max_norm;
+   HYPRE_Real      weight, ratio;
+   HYPRE_Int       recompute_true_residual = 0;
+
+   HYPRE_Int       i = 0, k;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_SOLVE);
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   bi_prod   = hypre_CTAllocF(HYPRE_Real, 12 * num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   eps       = bi_prod   + num_vectors;
+   gamma     = eps       + num_vectors;
+   gamma_old = gamma     + num_vectors;
+   sdotp     = gamma_old + num_vectors;
+   i_prod    = sdotp     + num_vectors;
+   i_prod_0  = i_prod    + num_vectors;
+   cf_ave_0  = i_prod_0  + num_vectors;
+   cf_ave_1  = cf_ave_0  + num_vectors;
+   pi_prod   = cf_ave_1  + num_vectors;
+   xi_prod   = pi_prod   + num_vectors;
+   ss_prod   = xi_prod   + num_vectors;
+   alpha     = hypre_CTAllocF(HYPRE_Complex, 2 * num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   beta      = alpha + num_vectors;
+   active    = hypre_CTAllocF(HYPRE_Int, 2 * num_vectors, pcg_functions, HYPRE_MEMORY_HOST);
+   tentative = active + num_vectors;
+
+   /* compute eps for each component */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      (*(pcg_functions->ComponentInnerProd))(b, b, bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+      precond(precond_data, A, b, p);
+      hypre_ProfileEnd();
+      (*(pcg_functions->ComponentInnerProd))(p, b, bi_prod);
+   }
+
+   num_active = 0;
+   for (k = 0; k < num_vectors; k++)
+   {
+      if (bi_prod[k] != bi_prod[k])
+      {
+         if (print_level > 0 || logging > 0)
+         {
+            hypre_printf("ERROR -- hypre_PCGSolveMulti: INFs and/or NaNs detected in input.\n");
+         }
+         hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_TFreeF(bi_prod, pcg_functions);
+         hypre_TFreeF(alpha, pcg_functions);
+         hypre_TFreeF(active, pcg_functions);
+         hypre_ProfileEnd();
+         HYPRE_ANNOTATE_FUNC_END;
+
+         return hypre_error_flag;
+      }
+
+      if (bi_prod[k] > 0.0)
+      {
+         /* as in hypre_PCGSolve */
+         eps[k] = r_tol * r_tol;
+         if ( stop_crit && !rel_change && atolf <= 0 ) /* pure absolute tolerance */
+         {
+            eps[k] = eps[k] / bi_prod[k];
+         }
+         else if ( atolf > 0 ) /* mixed relative and absolute tolerance */
+         {
+            bi_prod[k] += atolf;
+         }
+         else
+         {
+            eps[k] = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod[k]);
+         }
+         active[k] = 1;
+         num_active++;
+         alpha[k]  = 1.0;
+      }
+      else
+      {
+         /* this component of b is zero: set the one of x to zero */
+         alpha[k]  = 0.0;
+      }
+   }
+   num_nonzero   = num_active;
+   num_converged = 0;
+   (*(pcg_functions->ComponentScale))(alpha, x);
+
+   /* r = b - Ax, p = C*r, gamma = <r,p> */
+   (*(pcg_functions->CopyVector))(b, r);
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   hypre_ProfileEnd();
+   (*(pcg_functions->ClearVector))(p);
+   hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+   precond(precond_data, A, r, p);
+   hypre_ProfileEnd();
+   (*(pcg_functions->ComponentInnerProd))(r, p, gamma);
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Iters   max ||r_k||     max ||r_k||/||b_k||   converged\n");
+      hypre_printf("-----   ------------    -------------------   ---------\n");
+   }
+
+   while (1)
+   {
+      /* i_prod = <r,r> or <C*r,r> for each component */
+      if (two_norm)
+      {
+         (*(pcg_functions->ComponentInnerProd))(r, r, i_prod);
+      }
+      else
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            i_prod[k] = gamma[k];
+         }
+      }
+      if (i == 0)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            i_prod_0[k] = i_prod[k];
+         }
+      }
+
+      /* the basic convergence test, for each component */
+      for (k = 0; k < num_vectors; k++)
+      {
+         if (i_prod[k] != i_prod[k])
+         {
+            break;
+         }
+         tentative[k] = active[k] && i_prod[k] / bi_prod[k] < eps[k];
+      }
+      if (k < num_vectors)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in PCG");
+         break;
+      }
+
+      /* At user request, don't trust the convergence test until we've recomputed
+         the residual from scratch.  All components share the matvec, so the
+         residual of every component is recomputed. */
+      if (recompute_residual)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (tentative[k])
+            {
+               break;
+            }
+         }
+         if (k < num_vectors)
+         {
+            (*(pcg_functions->CopyVector))(b, r);
+            hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            hypre_ProfileEnd();
+
+            if (two_norm)
+            {
+               (*(pcg_functions->ComponentInnerProd))(r, r, i_prod);
+            }
+            else
+            {
+               /* s = C*r, i_prod = <r,s> */
+               (*(pcg_functions->ClearVector))(s);
+               hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+               precond(precond_data, A, r, s);
+               hypre_ProfileEnd();
+               (*(pcg_functions->ComponentInnerProd))(r, s, i_prod);
+            }
+            for (k = 0; k < num_vectors; k++)
+            {
+               tentative[k] = tentative[k] && i_prod[k] / bi_prod[k] < eps[k];
+            }
+         }
+      }
+
+      /* At user request, don't treat a component as converged unless its x
+         didn't change much in the last iteration. */
+      if (rel_change)
+      {
+         if (i > 0)
+         {
+            (*(pcg_functions->ComponentInnerProd))(p, p, pi_prod);
+            (*(pcg_functions->ComponentInnerProd))(x, x, xi_prod);
+         }
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (tentative[k] && i_prod[k] > 0.0)
+            {
+               /* there is no change yet to compare with before the first step */
+               ratio = (i > 0) ? alpha[k] * alpha[k] * pi_prod[k] / xi_prod[k] : eps[k];
+               if (ratio >= eps[k]) { tentative[k] = 0; }
+            }
+         }
+      }
+
+      max_rel  = 0.0;
+      max_norm = 0.0;
+      for (k = 0; k < num_vectors; k++)
+      {
+         if (bi_prod[k] > 0.0)
+         {
+            max_rel  = hypre_max(max_rel, hypre_sqrt(i_prod[k] / bi_prod[k]));
+            max_norm = hypre_max(max_norm, hypre_sqrt(i_prod[k]));
+         }
+         if (tentative[k])
+         {
+            /* we've passed all the convergence tests, it's for real */
+            active[k] = 0;
+            num_active--;
+            num_converged++;
+         }
+      }
+
+      /* print norm info */
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[i]     = max_norm;
+         rel_norms[i] = max_rel;
+      }
+      if ( print_level > 1 && my_id == 0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %e          %d/%d\n", i, max_norm, max_rel,
+                      num_converged, num_vectors);
+      }
+
+      if (num_active == 0)
+      {
+         (pcg_data -> converged) = (num_converged == num_nonzero);
+         break;
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /* Optional test to see if adequate progress is being made, as in
+         hypre_PCGSolve.  A component that fails it stops iterating. */
+      if (cf_tol > 0.0 && i > 0)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (!active[k])
+            {
+               continue;
+            }
+            if (! (i_prod_0[k] > HYPRE_REAL_MIN) )
+            {
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal i_prod value in PCG");
+               active[k] = 0;
+               num_active--;
+               continue;
+            }
+            cf_ave_0[k] = cf_ave_1[k];
+            cf_ave_1[k] = hypre_pow( i_prod[k] / i_prod_0[k], 1.0 / (2.0 * i) );
+
+            weight = hypre_abs(cf_ave_1[k] - cf_ave_0[k]);
+            weight = weight / hypre_max(cf_ave_1[k], cf_ave_0[k]);
+            weight = 1.0 - weight;
+            if (weight * cf_ave_1[k] > cf_tol)
+            {
+               active[k] = 0;
+               num_active--;
+            }
+         }
+         if (num_active == 0)
+         {
+            break;
+         }
+      }
+
+      /* p = s + beta p, for the active components */
+      if (i > 0)
+      {
+         if (!recompute_true_residual)
+         {
+            for (k = 0; k < num_vectors; k++)
+            {
+               beta[k] = active[k] ? gamma[k] / gamma_old[k] : 0.0;
+            }
+            (*(pcg_functions->ComponentScale))(beta, p);
+            (*(pcg_functions->Axpy))(1.0, s, p);
+         }
+         else
+         {
+            (*(pcg_functions->CopyVector))(s, p);
+         }
+      }
+
+      /* At user request, periodically recompute the residual from the formula
+         r = b - A x (instead of using the recursive definition). */
+      recompute_true_residual = recompute_residual_p && !((i + 1) % recompute_residual_p);
+
+      /* s = A*p, sdotp = <s,p> */
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+      hypre_ProfileEnd();
+      (*(pcg_functions->ComponentInnerProd))(s, p, sdotp);
+
+      for (k = 0; k < num_vectors; k++)
+      {
+         alpha[k] = 0.0;
+         if (active[k])
+         {
+            if (! (sdotp[k] > HYPRE_REAL_MIN) )
+            {
+               break;
+            }
+            alpha[k] = gamma[k] / sdotp[k];
+         }
+      }
+      if (k < num_vectors)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+
+      /* x = x + alpha p, r = r - alpha s */
+      (*(pcg_functions->ComponentAxpy))(alpha, p, x);
+      if (!recompute_true_residual)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            beta[k] = -alpha[k];
+         }
+         (*(pcg_functions->ComponentAxpy))(beta, s, r);
+      }
+      else
+      {
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         (*(pcg_functions->CopyVector))(b, r);
+         hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_MATVEC);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         hypre_ProfileEnd();
+      }
+
+      /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
+      if (rtol && two_norm)
+      {
+         /* use that r_new-r_old = alpha * s */
+         (*(pcg_functions->ComponentInnerProd))(s, s, ss_prod);
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (active[k] && alpha[k] * alpha[k] * ss_prod[k] / bi_prod[k] < rtol * rtol)
+            {
+               active[k] = 0;
+               num_active--;
+            }
+         }
+      }
+
+      /* s = C*r, gamma = <r,s> */
+      (*(pcg_functions->ClearVector))(s);
+      hypre_ProfileBegin(HYPRE_PROFILE_PCG, 0, HYPRE_PROFILE_PRECOND);
+      precond(precond_data, A, r, s);
+      hypre_ProfileEnd();
+      for (k = 0; k < num_vectors; k++)
+      {
+         gamma_old[k] = gamma[k];
+      }
+      (*(pcg_functions->ComponentInnerProd))(r, s, gamma);
+
+      /* residual-based stopping criteria: ||r_new-r_old||_C < rtol ||b||_C */
+      if (rtol && !two_norm)
+      {
+         /* use that ||r_new-r_old||_C^2 = (r_new ,C r_new) + (r_old, C r_old) */
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (active[k] && (gamma[k] + gamma_old[k]) / bi_prod[k] < rtol * rtol)
+            {
+               active[k] = 0;
+               num_active--;
+            }
+         }
+      }
+
+      i++;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && num_active > 0 && hybrid != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = max_rel;
+
+   hypre_TFreeF(bi_prod, pcg_functions);
+   hypre_TFreeF(alpha, pcg_functions);
+   hypre_TFreeF(active, pcg_functions);
+
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -1065,6 +1938,32 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
@@ -67,6 +67,23 @@ typedef struct
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
+   /* optional: r = b - A*x fused with a non-blocking reduction of <r,r> */
+   HYPRE_Int    (*ResidualNorm2Begin) ( void *A, void *x, void *b, void *r,
+                                        HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+   HYPRE_Int    (*ResidualNorm2End)   ( hypre_MPI_Request *request );
+
+   /* optional: <x[k],y[k]> for k < n, completed by a single non-blocking reduction */
+   HYPRE_Int    (*InnerProdBegin)     ( HYPRE_Int n, void **x, void **y,
+                                        HYPRE_Real *result, hypre_MPI_Request *request );
+   HYPRE_Int    (*InnerProdEnd)       ( hypre_MPI_Request *request );
+
+   /* optional: per-component operations on multicomponent vectors, which
+      are then solved as independent systems in lockstep */
+   HYPRE_Int    (*NumVectors)         ( void *x );
+   HYPRE_Int    (*ComponentInnerProd) ( void *x, void *y, HYPRE_Real *result );
+   HYPRE_Int    (*ComponentAxpy)      ( HYPRE_Complex *alpha, void *x, void *y );
+   HYPRE_Int    (*ComponentScale)     ( HYPRE_Complex *alpha, void *x );
+
 } hypre_PCGFunctions;
 
 /**
@@ -102,6 +119,17 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+- pipelined means: use the pipelined (Ghysels-Vanroose) variant, which needs a
+single non-blocking reduction per iteration, overlapped with the preconditioner
+and the matvec.  It requires the InnerProdBegin/End functions.  If any of
+rel_change, recompute_residual(_p), rtol, cf_tol, atolf or stop_crit is set,
+the standard variant is used instead.
+ - multicomponent right-hand sides (when the NumVectors and Component* functions
+are given) are solved as independent systems that share each matvec and
+preconditioner apply.  Every component has its own step lengths, is subject to
+all of the stopping tests above, and stops being updated once it passes them;
+the iteration count and the relative residual norm refer to the slowest
+component.  A recomputed residual is recomputed for all components.
 */
 
 typedef struct
@@ -119,6 +147,7 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
@@ -126,6 +155,14 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   /* additional vectors for the pipelined variant (created on demand) */
+   void    *u; /* C*r */
+   void    *w; /* A*u */
+   void    *m; /* C*w */
+   void    *n; /* A*m */
+   void    *q;
+   void    *z;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
@@ -195,6 +195,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelaxIF( hypre_ParCSRBlockMatrix *A,
                                         HYPRE_Int           cycle_type,
                                         HYPRE_Real          relax_weight,
                                         HYPRE_Real          omega,
+                                        HYPRE_Real         *diag_inv,
                                         hypre_ParVector    *u,
                                         hypre_ParVector    *Vtemp );
 
@@ -206,9 +207,20 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                                       HYPRE_Int           relax_points,
                                       HYPRE_Real          relax_weight,
                                       HYPRE_Real          omega,
+                                      HYPRE_Real         *diag_inv,
                                       hypre_ParVector    *u,
                                       hypre_ParVector    *Vtemp );
 
+HYPRE_Int  hypre_BoomerAMGBlockRelaxDiagInv( hypre_ParCSRBlockMatrix *A,
+                                             HYPRE_Real             **diag_inv_ptr );
+
+HYPRE_Int  hypre_BoomerAMGBlockRelaxDiagSolve( HYPRE_Real *diag_inv,
+                                               HYPRE_Int   i,
+                                               HYPRE_Real *diag,
+                                               HYPRE_Real *v,
+                                               HYPRE_Real *ov,
+                                               HYPRE_Int   block_size );
+
 HYPRE_Int
 hypre_GetCommPkgBlockRTFromCommPkgBlockA( hypre_ParCSRBlockMatrix *RT,
                                           hypre_ParCSRBlockMatrix *A,
@@ -28,6 +28,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelaxIF( hypre_ParCSRBlockMatrix *A,
                                         HYPRE_Int           cycle_type,
                                         HYPRE_Real          relax_weight,
                                         HYPRE_Real          omega,
+                                        HYPRE_Real         *diag_inv,
                                         hypre_ParVector    *u,
                                         hypre_ParVector    *Vtemp )
 {
@@ -56,6 +57,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelaxIF( hypre_ParCSRBlockMatrix *A,
                                                     relax_points[i],
                                                     relax_weight,
                                                     omega,
+                                                    diag_inv,
                                                     u,
                                                     Vtemp);
       }
@@ -69,6 +71,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelaxIF( hypre_ParCSRBlockMatrix *A,
                                                  0,
                                                  relax_weight,
                                                  omega,
+                                                 diag_inv,
                                                  u,
                                                  Vtemp);
    }
@@ -93,6 +96,7 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                                       HYPRE_Int           relax_points,
                                       HYPRE_Real          relax_weight,
                                       HYPRE_Real          omega,
+                                      HYPRE_Real         *diag_inv,
                                       hypre_ParVector    *u,
                                       hypre_ParVector    *Vtemp )
 
@@ -282,8 +286,8 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                }
 
                /* if diag is singular, then skip this point */
-               if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                       out_vec, block_size) == 0)
+               if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i, &A_diag_data[A_diag_i[i]*bnnz],
+                                                      res_vec, out_vec, block_size) == 0)
                {
                   for (k = 0; k < block_size; k++)
                   {
@@ -334,8 +338,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                   }
 
                   /* if diag is singular, then skip this point */
-                  if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                          out_vec, block_size) == 0)
+                  if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                         &A_diag_data[A_diag_i[i]*bnnz],
+                                                         res_vec, out_vec, block_size) == 0)
                   {
                      for (k = 0; k < block_size; k++)
                      {
@@ -484,8 +489,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -525,8 +531,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                                                         1.0, res_vec, block_size);
                      }
                      /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            res_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -606,8 +613,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            }
                            /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                            /* if diag is singular, then skip this point */
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  res_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -652,8 +661,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -749,8 +759,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -803,8 +814,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                      }
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            tmp_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -897,8 +909,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            {
                               tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                            }
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  tmp_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -959,8 +973,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1108,8 +1123,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1161,8 +1177,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1203,8 +1220,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                                                         1.0, res_vec, block_size);
                      }
                      /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            res_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -1240,8 +1258,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                                                         1.0, res_vec, block_size);
                      }
                      /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            res_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -1322,8 +1341,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            }
                            /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                            /* if diag is singular, then skip this point */
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  res_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -1376,8 +1397,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            }
                            /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                            /* if diag is singular, then skip this point */
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  res_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -1425,8 +1448,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1468,8 +1492,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         }
                         /* u_data[i] = res / A_diag_data[A_diag_i[i]]; */
                         /* if diag is singular, then skip this point */
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], res_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               res_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1571,8 +1596,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1632,8 +1658,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -1686,8 +1713,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                      }
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            tmp_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -1735,8 +1763,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                      {
                         tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                      }
-                     if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                             out_vec, block_size) == 0)
+                     if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                            &A_diag_data[A_diag_i[i]*bnnz],
+                                                            tmp_vec, out_vec, block_size) == 0)
                      {
                         for (k = 0; k < block_size; k++)
                         {
@@ -1831,8 +1860,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            {
                               tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                            }
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  tmp_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -1897,8 +1928,10 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                            {
                               tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                            }
-                           if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                   out_vec, block_size) == 0)
+                           if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                                  &A_diag_data[A_diag_i[i]*bnnz],
+                                                                  tmp_vec, out_vec,
+                                                                  block_size) == 0)
                            {
                               for (k = 0; k < block_size; k++)
                               {
@@ -1956,8 +1989,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -2011,8 +2045,9 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
                         {
                            tmp_vec[k] =  omega * res_vec[k] + res0_vec[k] + one_minus_omega * res2_vec[k];
                         }
-                        if (hypre_CSRBlockMatrixBlockInvMatvec( &A_diag_data[A_diag_i[i]*bnnz], tmp_vec,
-                                                                out_vec, block_size) == 0)
+                        if (hypre_BoomerAMGBlockRelaxDiagSolve(diag_inv, i,
+                                                               &A_diag_data[A_diag_i[i]*bnnz],
+                                                               tmp_vec, out_vec, block_size) == 0)
                         {
                            for (k = 0; k < block_size; k++)
                            {
@@ -2124,6 +2159,113 @@ HYPRE_Int  hypre_BoomerAMGBlockRelax( hypre_ParCSRBlockMatrix *A,
 
 }
 
+/*---------------------------------------------------------------------------
+ * hypre_BoomerAMGBlockRelaxDiagInv
+
+ Inverts the diagonal blocks of A once, so that the block smoothers apply
+ them with a block matvec instead of an elimination per point and sweep.
+ A singular (or missing) diagonal block is stored as zeros.
+
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int  hypre_BoomerAMGBlockRelaxDiagInv( hypre_ParCSRBlockMatrix *A,
+                                             HYPRE_Real             **diag_inv_ptr )
+{
+   hypre_CSRBlockMatrix *A_diag      = hypre_ParCSRBlockMatrixDiag(A);
+   HYPRE_Real           *A_diag_data = hypre_CSRBlockMatrixData(A_diag);
+   HYPRE_Int            *A_diag_i    = hypre_CSRBlockMatrixI(A_diag);
+   HYPRE_Int             block_size  = hypre_CSRBlockMatrixBlockSize(A_diag);
+   HYPRE_Int             bnnz        = block_size * block_size;
+   HYPRE_Int             n           = hypre_CSRBlockMatrixNumRows(A_diag);
+   HYPRE_Real           *diag_inv;
+   HYPRE_Real           *e_vec, *col_vec;
+   HYPRE_Int             i, k, b;
+
+   diag_inv = hypre_CTAlloc(HYPRE_Real, n * bnnz, HYPRE_MEMORY_HOST);
+   e_vec    = hypre_CTAlloc(HYPRE_Real, block_size, HYPRE_MEMORY_HOST);
+   col_vec  = hypre_CTAlloc(HYPRE_Real, block_size, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      if (A_diag_i[i] == A_diag_i[i + 1])
+      {
+         continue;
+      }
+
+      /* column k of the inverse is D^{-1} e_k (same solve as the smoothers) */
+      for (k = 0; k < block_size; k++)
+      {
+         e_vec[k] = 1.0;
+         if (hypre_CSRBlockMatrixBlockInvMatvec(&A_diag_data[A_diag_i[i] * bnnz], e_vec,
+                                                col_vec, block_size) != 0)
+         {
+            e_vec[k] = 0.0;
+            break;
+         }
+         e_vec[k] = 0.0;
+
+         for (b = 0; b < block_size; b++)
+         {
+            diag_inv[i * bnnz + b * block_size + k] = col_vec[b];
+         }
+      }
+
+      if (k < block_size)
+      {
+         for (b = 0; b < bnnz; b++)
+         {
+            diag_inv[i * bnnz + b] = 0.0;
+         }
+      }
+   }
+
+   hypre_TFree(e_vec, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_vec, HYPRE_MEMORY_HOST);
+
+   *diag_inv_ptr = diag_inv;
+
+   return hypre_error_flag;
+}
+
+/*---------------------------------------------------------------------------
+ * hypre_BoomerAMGBlockRelaxDiagSolve
+
+ ov = D^{-1} v for the diagonal block D of point i.  Uses the inverse from
+ hypre_BoomerAMGBlockRelaxDiagInv if diag_inv is given, and otherwise solves
+ with D.  Returns -1 if D is singular.
+
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int  hypre_BoomerAMGBlockRelaxDiagSolve( HYPRE_Real *diag_inv,
+                                               HYPRE_Int   i,
+                                               HYPRE_Real *diag,
+                                               HYPRE_Real *v,
+                                               HYPRE_Real *ov,
+                                               HYPRE_Int   block_size )
+{
+   HYPRE_Int    bnnz = block_size * block_size;
+   HYPRE_Real  *inv;
+   HYPRE_Int    k;
+
+   if (!diag_inv)
+   {
+      return hypre_CSRBlockMatrixBlockInvMatvec(diag, v, ov, block_size);
+   }
+
+   inv = &diag_inv[i * bnnz];
+   for (k = 0; k < bnnz && inv[k] == 0.0; k++)
+   {
+   }
+   if (k == bnnz)
+   {
+      return -1;
+   }
+
+   hypre_BdiagInvMatvec(1, block_size, 1.0, inv, v, 0.0, ov);
+
+   return 0;
+}
+
 /*-------------------------------------------------------------------------
  *
  *                      Gaussian Elimination - with pivoting
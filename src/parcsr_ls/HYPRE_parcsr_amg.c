@@ -2045,6 +2045,50 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNumericResetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNumericResetup (HYPRE_Solver solver,
+                                  HYPRE_Int    numeric_resetup)
+{
+   return (hypre_BoomerAMGSetNumericResetup ( (void *) solver, numeric_resetup ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetNumericResetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNumericResetup (HYPRE_Solver  solver,
+                                  HYPRE_Int    *numeric_resetup)
+{
+   return (hypre_BoomerAMGGetNumericResetup ( (void *) solver, numeric_resetup ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFloatHierarchy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFloatHierarchy (HYPRE_Solver solver,
+                                  HYPRE_Int    float_hierarchy)
+{
+   return (hypre_BoomerAMGSetFloatHierarchy ( (void *) solver, float_hierarchy ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetFloatHierarchy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetFloatHierarchy (HYPRE_Solver  solver,
+                                  HYPRE_Int    *float_hierarchy)
+{
+   return (hypre_BoomerAMGGetFloatHierarchy ( (void *) solver, float_hierarchy ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -105,6 +105,13 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver \e SetPrecond function.
  *
+ * If b and x are multicomponent vectors, the systems for all components are
+ * solved together. A is read once per relaxation sweep for all components
+ * only with relax types 3, 4, 6, 7, 8, 13, 14 and 18; the other smoothers
+ * relax one component at a time. Block mode, mixed precision, additive
+ * cycles, CG, Chebyshev, FCF-Jacobi and multicolor relaxation, and the
+ * agglomerated and SuperLU coarse solves are not supported in this case.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -401,6 +408,18 @@ HYPRE_Int HYPRE_BoomerAMGSetCGCIts (HYPRE_Solver solver,
  *    - 3 : largest element in each block (not absolute value)
  *    - 4 : row-sum norm
  *    - 6 : sum of all values in each block
+ *
+ * Nodal coarsening alone keeps the operators in scalar CSR.  The block
+ * (BSR) execution mode is not selected by this option.  It is used when
+ * a block interpolation (interp_type 10, 11 or 20-24, see
+ * HYPRE_BoomerAMGSetInterpType) or a block smoother (relax_type 20, 23,
+ * 26 or 29, see HYPRE_BoomerAMGSetRelaxType) is chosen; the other one is
+ * then switched to a block option as well, and nodal is set to 1 if it
+ * is 0.  In this mode A, P and R are stored with num_functions x
+ * num_functions blocks on all levels, the cycle uses block matvecs, and
+ * the block smoothers apply the inverted diagonal blocks computed during
+ * setup.  Options that only exist for scalar CSR operators, e.g. the
+ * numeric-only re-setup, are not available in the block mode.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetNodal(HYPRE_Solver solver,
                                   HYPRE_Int    nodal);
@@ -447,6 +466,16 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign(HYPRE_Solver solver,
  *    - 16 : extended interpolation in matrix-matrix form
  *    - 17 : extended+i interpolation in matrix-matrix form
  *    - 18 : extended+e interpolation in matrix-matrix form
+ *    - 20 : classical block interpolation (block mode)
+ *    - 21 : classical block interpolation with diagonalized diagonal blocks
+ *           (block mode)
+ *    - 22 : block interpolation distributing F-connections only to like
+ *           unknowns (block mode)
+ *    - 23 : currently the same as 22
+ *    - 24 : direct block interpolation (block mode)
+ *
+ * Options 10, 11 and 20-24 select the block execution mode, see
+ * HYPRE_BoomerAMGSetNodal.
  *
  * The default is ext+i interpolation (interp_type 6) trunctated to at most 4
  * elements per row. (see HYPRE_BoomerAMGSetPMaxElmts).
@@ -749,6 +778,19 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 20 : block Jacobi (block mode)
+ *    - 23 : block hybrid Gauss-Seidel or SOR (block mode)
+ *    - 24 : multicolor hybrid Gauss-Seidel or SOR, forward solve
+ *    - 25 : multicolor hybrid symmetric Gauss-Seidel or SSOR
+ *    - 26 : block hybrid symmetric Gauss-Seidel or SSOR (block mode)
+ *    - 29 : block Gaussian elimination (block mode, only on coarsest level)
+ *
+ * The block smoothers (20, 23, 26, 29) select the block execution mode, see
+ * HYPRE_BoomerAMGSetNodal.
+ *
+ * The multicolor smoothers (24, 25) color the local matrix during setup and
+ * relax the points of each color in parallel. Unlike 3-6, their result does
+ * not depend on the number of OpenMP threads.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -1274,6 +1316,50 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the strength matrices of the hierarchy are kept
+ * after setup.  A subsequent call to HYPRE_BoomerAMGSetup with a matrix that
+ * has the same sparsity pattern and parallel distribution as the previous one
+ * then reuses the C/F splittings and the sparsity patterns and communication
+ * packages of the interpolation and coarse-grid operators.  Only the
+ * interpolation weights, the Galerkin products and the smoother data are
+ * recomputed.  If a recomputed operator does not fit the kept pattern, it is
+ * replaced for that level.  The default is 0.
+ *
+ * Supported for the classical interpolation types without aggressive
+ * coarsening, nodal coarsening, non-Galerkin coarse grids, additive cycles or
+ * approximate-ideal restriction.  For other settings the second setup is a
+ * full setup.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNumericResetup(HYPRE_Solver solver,
+                                           HYPRE_Int    numeric_resetup);
+
+/**
+ * (Optional) Return whether the numeric-only re-setup is enabled.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetNumericResetup(HYPRE_Solver  solver,
+                                           HYPRE_Int    *numeric_resetup);
+
+/**
+ * (Optional) If set to 1, the values of the interpolation, restriction and
+ * coarse-grid operators are stored in single precision after setup, which
+ * reduces the memory of the hierarchy and the memory traffic of the cycle.
+ * The fine-grid matrix, the vectors and the arithmetic remain in double
+ * precision, so BoomerAMG should be used as a preconditioner in this mode.
+ * A coarse-grid operator is only converted if its level is relaxed with
+ * relaxation type 0, 3, 4, 6, 8, 13, 14 or 18.  The option is ignored on
+ * GPUs, for block relaxation and for additive cycles.  It disables
+ * the numeric-only re-setup.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFloatHierarchy(HYPRE_Solver solver,
+                                           HYPRE_Int    float_hierarchy);
+
+/**
+ * (Optional) Return whether the hierarchy is stored in single precision.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetFloatHierarchy(HYPRE_Solver  solver,
+                                           HYPRE_Int    *float_hierarchy);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2618,6 +2704,15 @@ HYPRE_Int HYPRE_ParCSRPCGSetup(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Solve the system. If b and x are multicomponent vectors, each component is
+ * solved with its own conjugate gradient scalars (not block CG), sharing the
+ * matrix and preconditioner applications and the reductions. The matrix is
+ * read once per iteration for all components; with a BoomerAMG
+ * preconditioner this also requires relax types 3, 4, 6, 7, 8, 13, 14 or 18.
+ * The stopping tests set for the solver are applied to each component, and
+ * the iteration stops when every component has stopped.
+ **/
 HYPRE_Int HYPRE_ParCSRPCGSolve(HYPRE_Solver       solver,
                                HYPRE_ParCSRMatrix A,
                                HYPRE_ParVector    b,
@@ -2861,6 +2956,85 @@ HYPRE_Int HYPRE_ParCSRCOGMRESGetResidual(HYPRE_Solver     solver,
 
 /* end of parCSR CO-GMRES */
 
+/* ParCSR s-step (communication-avoiding) GMRES */
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESCreate(MPI_Comm      comm,
+                                    HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetup(HYPRE_Solver       solver,
+                                   HYPRE_ParCSRMatrix A,
+                                   HYPRE_ParVector    b,
+                                   HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSolve(HYPRE_Solver       solver,
+                                   HYPRE_ParCSRMatrix A,
+                                   HYPRE_ParVector    b,
+                                   HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetKDim(HYPRE_Solver solver,
+                                     HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the number of Krylov vectors generated and orthogonalized
+ * as one block (default is 4).  See \ref HYPRE_CAGMRESSetSStep.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESSetSStep(HYPRE_Solver solver,
+                                      HYPRE_Int    s_step);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetUnroll(HYPRE_Solver solver,
+                                       HYPRE_Int    unroll);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetTol(HYPRE_Solver solver,
+                                    HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetAbsoluteTol(HYPRE_Solver solver,
+                                            HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMinIter(HYPRE_Solver solver,
+                                        HYPRE_Int    min_iter);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMaxIter(HYPRE_Solver solver,
+                                        HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrecond(HYPRE_Solver             solver,
+                                        HYPRE_PtrToParSolverFcn  precond,
+                                        HYPRE_PtrToParSolverFcn  precond_setup,
+                                        HYPRE_Solver             precond_solver);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetPrecond(HYPRE_Solver  solver,
+                                        HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetLogging(HYPRE_Solver solver,
+                                        HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrintLevel(HYPRE_Solver solver,
+                                           HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetNumIterations(HYPRE_Solver  solver,
+                                              HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRCAGMRESGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                          HYPRE_Real   *norm);
+
+/**
+ * Returns the residual.
+ **/
+HYPRE_Int HYPRE_ParCSRCAGMRESGetResidual(HYPRE_Solver     solver,
+                                         HYPRE_ParVector *residual);
+
+/* end of parCSR s-step GMRES */
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -31,6 +31,14 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   pcg_functions->ResidualNorm2Begin = hypre_ParKrylovResidualNorm2Begin;
+   pcg_functions->ResidualNorm2End   = hypre_ParKrylovResidualNorm2End;
+   pcg_functions->InnerProdBegin     = hypre_ParKrylovInnerProdBegin;
+   pcg_functions->InnerProdEnd       = hypre_ParKrylovInnerProdEnd;
+   pcg_functions->NumVectors         = hypre_ParKrylovNumVectors;
+   pcg_functions->ComponentInnerProd = hypre_ParKrylovComponentInnerProd;
+   pcg_functions->ComponentAxpy      = hypre_ParKrylovComponentAxpy;
+   pcg_functions->ComponentScale     = hypre_ParKrylovComponentScale;
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -30,6 +30,25 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrix
+ *
+ * Single precision values of a ParCSR matrix of the AMG hierarchy.  The
+ * ParCSR matrix provides the sparsity pattern and communication package.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix *matrix;
+   float              *diag_data;
+   float              *offd_data;
+
+} hypre_ParAMGFloatMatrix;
+
+#define hypre_ParAMGFloatMatrixMatrix(A_float)   ((A_float) -> matrix)
+#define hypre_ParAMGFloatMatrixDiagData(A_float) ((A_float) -> diag_data)
+#define hypre_ParAMGFloatMatrixOffdData(A_float) ((A_float) -> offd_data)
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -128,10 +147,15 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* rows of each level grouped by color, for multicolor smoothers */
+   hypre_IntArray     **color_ptr_array;
+   hypre_IntArray     **color_rows_array;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
    hypre_ParCSRBlockMatrix **R_block_array;
+   HYPRE_Real              **block_diag_inv;  /* inverted diagonal blocks per level */
 
    HYPRE_Int block_mode;
 
@@ -269,6 +293,20 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* keep strength matrices and product plans for a numeric-only re-setup */
+   HYPRE_Int             numeric_resetup;
+   hypre_ParCSRMatrix  **S_array;
+   hypre_ParCSRRAPPlan **RAP_plan_array;
+   HYPRE_Int             resetup_diag_nnz;
+   HYPRE_Int             resetup_offd_nnz;
+   HYPRE_Int             resetup_num_cols_offd;
+
+   /* single precision storage of the hierarchy */
+   HYPRE_Int                  float_hierarchy;
+   hypre_ParAMGFloatMatrix  **A_float_array;
+   hypre_ParAMGFloatMatrix  **P_float_array;
+   hypre_ParAMGFloatMatrix  **R_float_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -333,6 +371,8 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataColorPtrArray(amg_data)        ((amg_data) -> color_ptr_array)
+#define hypre_ParAMGDataColorRowsArray(amg_data)       ((amg_data) -> color_rows_array)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -437,6 +477,7 @@ typedef struct
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
 #define hypre_ParAMGDataRBlockArray(amg_data) ((amg_data)->R_block_array)
+#define hypre_ParAMGDataBlockDiagInv(amg_data) ((amg_data)->block_diag_inv)
 
 #define hypre_ParAMGDataBlockMode(amg_data) ((amg_data)->block_mode)
 
@@ -527,6 +568,16 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataNumericResetup(amg_data) ((amg_data)->numeric_resetup)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)->S_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->RAP_plan_array)
+#define hypre_ParAMGDataResetupDiagNnz(amg_data) ((amg_data)->resetup_diag_nnz)
+#define hypre_ParAMGDataResetupOffdNnz(amg_data) ((amg_data)->resetup_offd_nnz)
+#define hypre_ParAMGDataResetupNumColsOffd(amg_data) ((amg_data)->resetup_num_cols_offd)
+#define hypre_ParAMGDataFloatHierarchy(amg_data) ((amg_data)->float_hierarchy)
+#define hypre_ParAMGDataAFloatArray(amg_data) ((amg_data)->A_float_array)
+#define hypre_ParAMGDataPFloatArray(amg_data) ((amg_data)->P_float_array)
+#define hypre_ParAMGDataRFloatArray(amg_data) ((amg_data)->R_float_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1969,6 +2020,10 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetNumericResetup ( HYPRE_Solver solver, HYPRE_Int numeric_resetup );
+HYPRE_Int HYPRE_BoomerAMGGetNumericResetup ( HYPRE_Solver solver, HYPRE_Int *numeric_resetup );
+HYPRE_Int HYPRE_BoomerAMGSetFloatHierarchy ( HYPRE_Solver solver, HYPRE_Int float_hierarchy );
+HYPRE_Int HYPRE_BoomerAMGGetFloatHierarchy ( HYPRE_Solver solver, HYPRE_Int *float_hierarchy );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -2126,6 +2181,29 @@ HYPRE_Int HYPRE_ParCSRGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver, H
 HYPRE_Int HYPRE_ParCSRGMRESGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
 
 
+/* HYPRE_parcsr_cagmres.c */
+HYPRE_Int HYPRE_ParCSRCAGMRESCreate ( MPI_Comm comm, HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRCAGMRESDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                     HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRCAGMRESSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                     HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetSStep ( HYPRE_Solver solver, HYPRE_Int s_step );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetUnroll ( HYPRE_Solver solver, HYPRE_Int unroll );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMinIter ( HYPRE_Solver solver, HYPRE_Int min_iter );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToParSolverFcn precond,
+                                          HYPRE_PtrToParSolverFcn precond_setup, HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRCAGMRESGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetLogging ( HYPRE_Solver solver, HYPRE_Int logging );
+HYPRE_Int HYPRE_ParCSRCAGMRESSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRCAGMRESGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRCAGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+HYPRE_Int HYPRE_ParCSRCAGMRESGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
+
 /*HYPRE_parcsr_cogmres.c*/
 HYPRE_Int HYPRE_ParCSRCOGMRESCreate ( MPI_Comm comm, HYPRE_Solver *solver );
 HYPRE_Int HYPRE_ParCSRCOGMRESDestroy ( HYPRE_Solver solver );
@@ -2576,6 +2654,10 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetNumericResetup ( void *data, HYPRE_Int numeric_resetup );
+HYPRE_Int hypre_BoomerAMGGetNumericResetup ( void *data, HYPRE_Int *numeric_resetup );
+HYPRE_Int hypre_BoomerAMGSetFloatHierarchy ( void *data, HYPRE_Int float_hierarchy );
+HYPRE_Int hypre_BoomerAMGGetFloatHierarchy ( void *data, HYPRE_Int *float_hierarchy );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2586,6 +2668,32 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 HYPRE_Int hypre_BoomerAMGSetCumNnzAP ( void *data, HYPRE_Real cum_nnz_AP );
 HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
 
+/* par_amg_float.c */
+hypre_ParAMGFloatMatrix *hypre_ParAMGFloatMatrixCreate ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParAMGFloatMatrixDestroy ( hypre_ParAMGFloatMatrix *A_float );
+HYPRE_Int hypre_ParAMGFloatMatrixMatvecOutOfPlace ( HYPRE_Complex alpha,
+                                                    hypre_ParAMGFloatMatrix *A_float, hypre_ParVector *x, HYPRE_Complex beta,
+                                                    hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParAMGFloatMatrixMatvec ( HYPRE_Complex alpha, hypre_ParAMGFloatMatrix *A_float,
+                                          hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
+HYPRE_Int hypre_ParAMGFloatMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParAMGFloatMatrix *A_float,
+                                           hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
+HYPRE_Int hypre_BoomerAMGFloatRelaxSupported ( HYPRE_Int relax_type );
+HYPRE_Int hypre_BoomerAMGFloatRelax ( hypre_ParAMGFloatMatrix *A_float, hypre_ParVector *f,
+                                      HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight,
+                                      HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp );
+HYPRE_Int hypre_BoomerAMGFloatRelaxIF ( hypre_ParAMGFloatMatrix *A_float, hypre_ParVector *f,
+                                        HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_order, HYPRE_Int cycle_param,
+                                        HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u,
+                                        hypre_ParVector *Vtemp );
+HYPRE_Int hypre_BoomerAMGSetupFloatHierarchy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGDestroyFloatHierarchy ( void *amg_vdata, HYPRE_Int num_levels );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupSupported ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetupCompatible ( void *amg_vdata, hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupLevels ( void *amg_vdata, HYPRE_Int *complete_ptr );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
@@ -3049,6 +3157,10 @@ HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm, HYPRE_Int num_sends,
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                  HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxComponents ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                           HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_points,
+                                           HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms,
+                                           hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
@@ -3112,6 +3224,24 @@ HYPRE_Int hypre_BoomerAMGRelax18WeightedL1Jacobi( hypre_ParCSRMatrix *A, hypre_P
                                                   HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
                                                   hypre_ParVector *u, hypre_ParVector *Vtemp );
 
+HYPRE_Int hypre_BoomerAMGRelaxComputeColors( hypre_ParCSRMatrix *A, hypre_IntArray **color_ptr_ptr,
+                                             hypre_IntArray **color_rows_ptr );
+
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                           HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                           hypre_IntArray *color_ptr, hypre_IntArray *color_rows, hypre_ParVector *u,
+                                                           hypre_ParVector *Vtemp, HYPRE_Int Symm );
+
+HYPRE_Int hypre_BoomerAMGRelax24MulticolorGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                       HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                       hypre_IntArray *color_ptr, hypre_IntArray *color_rows, hypre_ParVector *u,
+                                                       hypre_ParVector *Vtemp );
+
+HYPRE_Int hypre_BoomerAMGRelax25MulticolorSSOR( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                                hypre_IntArray *color_ptr, hypre_IntArray *color_rows, hypre_ParVector *u,
+                                                hypre_ParVector *Vtemp );
+
 HYPRE_Int hypre_BoomerAMGRelax19GaussElim( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                            hypre_ParVector *u );
 
@@ -3157,6 +3287,10 @@ HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HY
                                    HYPRE_Int relax_type, HYPRE_Int relax_order, HYPRE_Int cycle_type, HYPRE_Real relax_weight,
                                    HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp,
                                    hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorIF ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                             HYPRE_Int *cf_marker, HYPRE_Int relax_type, HYPRE_Int relax_order, HYPRE_Int cycle_param,
+                                             HYPRE_Real relax_weight, HYPRE_Real omega, hypre_IntArray *color_ptr,
+                                             hypre_IntArray *color_rows, hypre_ParVector *u, hypre_ParVector *Vtemp );
 
 /* par_relax_more.c */
 HYPRE_Int hypre_ParCSRMaxEigEstimate ( hypre_ParCSRMatrix *A, HYPRE_Int scale, HYPRE_Real *max_eig,
@@ -3336,10 +3470,22 @@ HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovResidualNorm2Begin ( void *A, void *x, void *b, void *r,
+                                              HYPRE_Real *r_norm2, hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovResidualNorm2End ( hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovInnerProdBegin ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                          hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovInnerProdEnd ( hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovNumVectors ( void *x );
+HYPRE_Int hypre_ParKrylovComponentInnerProd ( void *x, void *y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovComponentAxpy ( HYPRE_Complex *alpha, void *x, void *y );
+HYPRE_Int hypre_ParKrylovComponentScale ( HYPRE_Complex *alpha, void *x );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( void **x, HYPRE_Int nx, void **y, HYPRE_Int ny,
+                                         HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
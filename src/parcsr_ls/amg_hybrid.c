@@ -1884,6 +1884,10 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            pcg_functions->ResidualNorm2Begin = hypre_ParKrylovResidualNorm2Begin;
+            pcg_functions->ResidualNorm2End   = hypre_ParKrylovResidualNorm2End;
+            pcg_functions->InnerProdBegin     = hypre_ParKrylovInnerProdBegin;
+            pcg_functions->InnerProdEnd       = hypre_ParKrylovInnerProdEnd;
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
             hypre_PCGSetTol(pcg_solver, tol);
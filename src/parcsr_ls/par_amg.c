@@ -443,10 +443,13 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataPointDofMapArray(amg_data) = NULL;
    hypre_ParAMGDataSmoother(amg_data) = NULL;
    hypre_ParAMGDataL1Norms(amg_data) = NULL;
+   hypre_ParAMGDataColorPtrArray(amg_data) = NULL;
+   hypre_ParAMGDataColorRowsArray(amg_data) = NULL;
 
    hypre_ParAMGDataABlockArray(amg_data) = NULL;
    hypre_ParAMGDataPBlockArray(amg_data) = NULL;
    hypre_ParAMGDataRBlockArray(amg_data) = NULL;
+   hypre_ParAMGDataBlockDiagInv(amg_data) = NULL;
 
    /* this can not be set by the user currently */
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
@@ -500,6 +503,16 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataNumericResetup(amg_data)    = 0;
+   hypre_ParAMGDataSArray(amg_data)            = NULL;
+   hypre_ParAMGDataRAPPlanArray(amg_data)      = NULL;
+   hypre_ParAMGDataResetupDiagNnz(amg_data)    = -1;
+   hypre_ParAMGDataResetupOffdNnz(amg_data)    = -1;
+   hypre_ParAMGDataResetupNumColsOffd(amg_data) = -1;
+   hypre_ParAMGDataFloatHierarchy(amg_data)    = 0;
+   hypre_ParAMGDataAFloatArray(amg_data)       = NULL;
+   hypre_ParAMGDataPFloatArray(amg_data)       = NULL;
+   hypre_ParAMGDataRFloatArray(amg_data)       = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -687,6 +700,26 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataBlockDiagInv(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataBlockDiagInv(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataBlockDiagInv(amg_data), HYPRE_MEMORY_HOST);
+      }
+
+      if (hypre_ParAMGDataColorPtrArray(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorPtrArray(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorRowsArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataColorPtrArray(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorRowsArray(amg_data), HYPRE_MEMORY_HOST);
+      }
+
       if (hypre_ParAMGDataChebyCoefs(amg_data))
       {
          for (i = 0; i < num_levels; i++)
@@ -733,6 +766,23 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataPBlockArray(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataPArray(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data), HYPRE_MEMORY_HOST);
+      if (hypre_ParAMGDataSArray(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_ParCSRMatrixDestroy(hypre_ParAMGDataSArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataSArray(amg_data), HYPRE_MEMORY_HOST);
+      }
+      if (hypre_ParAMGDataRAPPlanArray(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_ParCSRRAPPlanDestroy(hypre_ParAMGDataRAPPlanArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataRAPPlanArray(amg_data), HYPRE_MEMORY_HOST);
+      }
+      hypre_BoomerAMGDestroyFloatHierarchy(amg_data, num_levels);
       hypre_ParVectorDestroy(hypre_ParAMGDataRtemp(amg_data));
       hypre_ParVectorDestroy(hypre_ParAMGDataPtemp(amg_data));
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
@@ -4809,6 +4859,74 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetNumericResetup( void       *data,
+                                  HYPRE_Int   numeric_resetup )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNumericResetup(amg_data) = numeric_resetup;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetNumericResetup( void       *data,
+                                  HYPRE_Int  *numeric_resetup )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *numeric_resetup = hypre_ParAMGDataNumericResetup(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFloatHierarchy( void       *data,
+                                  HYPRE_Int   float_hierarchy )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataFloatHierarchy(amg_data) = float_hierarchy;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetFloatHierarchy( void       *data,
+                                  HYPRE_Int  *float_hierarchy )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *float_hierarchy = hypre_ParAMGDataFloatHierarchy(amg_data);
+
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -12,6 +12,25 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrix
+ *
+ * Single precision values of a ParCSR matrix of the AMG hierarchy.  The
+ * ParCSR matrix provides the sparsity pattern and communication package.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix *matrix;
+   float              *diag_data;
+   float              *offd_data;
+
+} hypre_ParAMGFloatMatrix;
+
+#define hypre_ParAMGFloatMatrixMatrix(A_float)   ((A_float) -> matrix)
+#define hypre_ParAMGFloatMatrixDiagData(A_float) ((A_float) -> diag_data)
+#define hypre_ParAMGFloatMatrixOffdData(A_float) ((A_float) -> offd_data)
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -110,10 +129,15 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* rows of each level grouped by color, for multicolor smoothers */
+   hypre_IntArray     **color_ptr_array;
+   hypre_IntArray     **color_rows_array;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
    hypre_ParCSRBlockMatrix **R_block_array;
+   HYPRE_Real              **block_diag_inv;  /* inverted diagonal blocks per level */
 
    HYPRE_Int block_mode;
 
@@ -251,6 +275,20 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* keep strength matrices and product plans for a numeric-only re-setup */
+   HYPRE_Int             numeric_resetup;
+   hypre_ParCSRMatrix  **S_array;
+   hypre_ParCSRRAPPlan **RAP_plan_array;
+   HYPRE_Int             resetup_diag_nnz;
+   HYPRE_Int             resetup_offd_nnz;
+   HYPRE_Int             resetup_num_cols_offd;
+
+   /* single precision storage of the hierarchy */
+   HYPRE_Int                  float_hierarchy;
+   hypre_ParAMGFloatMatrix  **A_float_array;
+   hypre_ParAMGFloatMatrix  **P_float_array;
+   hypre_ParAMGFloatMatrix  **R_float_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -315,6 +353,8 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataColorPtrArray(amg_data)        ((amg_data) -> color_ptr_array)
+#define hypre_ParAMGDataColorRowsArray(amg_data)       ((amg_data) -> color_rows_array)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -419,6 +459,7 @@ typedef struct
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
 #define hypre_ParAMGDataRBlockArray(amg_data) ((amg_data)->R_block_array)
+#define hypre_ParAMGDataBlockDiagInv(amg_data) ((amg_data)->block_diag_inv)
 
 #define hypre_ParAMGDataBlockMode(amg_data) ((amg_data)->block_mode)
 
@@ -509,6 +550,16 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataNumericResetup(amg_data) ((amg_data)->numeric_resetup)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)->S_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->RAP_plan_array)
+#define hypre_ParAMGDataResetupDiagNnz(amg_data) ((amg_data)->resetup_diag_nnz)
+#define hypre_ParAMGDataResetupOffdNnz(amg_data) ((amg_data)->resetup_offd_nnz)
+#define hypre_ParAMGDataResetupNumColsOffd(amg_data) ((amg_data)->resetup_num_cols_offd)
+#define hypre_ParAMGDataFloatHierarchy(amg_data) ((amg_data)->float_hierarchy)
+#define hypre_ParAMGDataAFloatArray(amg_data) ((amg_data)->A_float_array)
+#define hypre_ParAMGDataPFloatArray(amg_data) ((amg_data)->P_float_array)
+#define hypre_ParAMGDataRFloatArray(amg_data) ((amg_data)->R_float_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -0,0 +1,725 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision storage of the BoomerAMG hierarchy
+ *
+ * After setup, the values of the interpolation and restriction operators and
+ * of the coarse-grid operators are converted to single precision and the
+ * double precision values are released.  The sparsity patterns and the
+ * communication packages of the ParCSR matrices are kept.  The cycle then
+ * calls the kernels below for these operators.  Vectors stay in HYPRE_Real
+ * and the arithmetic is done in HYPRE_Real, so only the matrix storage and
+ * the memory traffic of the cycle are reduced.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrixCreate
+ *
+ * Converts the values of A to single precision.  The values of A (and of
+ * its stored transposes) are freed, so that A only provides the sparsity
+ * pattern and the communication package afterwards.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParAMGFloatMatrix *
+hypre_ParAMGFloatMatrixCreate( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix         *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex           *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Complex           *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int                diag_nnz    = hypre_CSRMatrixNumNonzeros(A_diag);
+   HYPRE_Int                offd_nnz    = hypre_CSRMatrixNumNonzeros(A_offd);
+   hypre_ParAMGFloatMatrix *A_float;
+   HYPRE_Int                i;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   A_float = hypre_CTAlloc(hypre_ParAMGFloatMatrix, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGFloatMatrixMatrix(A_float)   = A;
+   hypre_ParAMGFloatMatrixDiagData(A_float) = hypre_TAlloc(float, diag_nnz, HYPRE_MEMORY_HOST);
+   hypre_ParAMGFloatMatrixOffdData(A_float) = hypre_TAlloc(float, offd_nnz, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < diag_nnz; i++)
+   {
+      hypre_ParAMGFloatMatrixDiagData(A_float)[i] = (float) A_diag_data[i];
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < offd_nnz; i++)
+   {
+      hypre_ParAMGFloatMatrixOffdData(A_float)[i] = (float) A_offd_data[i];
+   }
+
+   hypre_TFree(hypre_CSRMatrixData(A_diag), hypre_CSRMatrixMemoryLocation(A_diag));
+   hypre_TFree(hypre_CSRMatrixData(A_offd), hypre_CSRMatrixMemoryLocation(A_offd));
+
+   /* The kernels below do not use the local transposes */
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(A));
+      hypre_ParCSRMatrixDiagT(A) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(A));
+      hypre_ParCSRMatrixOffdT(A) = NULL;
+   }
+
+   return A_float;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrixDestroy
+ *
+ * The ParCSR matrix is owned by the AMG hierarchy and is not destroyed here.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParAMGFloatMatrixDestroy( hypre_ParAMGFloatMatrix *A_float )
+{
+   if (A_float)
+   {
+      hypre_TFree(hypre_ParAMGFloatMatrixDiagData(A_float), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGFloatMatrixOffdData(A_float), HYPRE_MEMORY_HOST);
+      hypre_TFree(A_float, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrixMatvecOutOfPlace
+ *
+ * y = alpha*A*x + beta*b
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParAMGFloatMatrixMatvecOutOfPlace( HYPRE_Complex            alpha,
+                                         hypre_ParAMGFloatMatrix *A_float,
+                                         hypre_ParVector         *x,
+                                         HYPRE_Complex            beta,
+                                         hypre_ParVector         *b,
+                                         hypre_ParVector         *y )
+{
+   hypre_ParCSRMatrix     *A             = hypre_ParAMGFloatMatrixMatrix(A_float);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   float                  *A_diag_data   = hypre_ParAMGFloatMatrixDiagData(A_float);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   float                  *A_offd_data   = hypre_ParAMGFloatMatrixOffdData(A_float);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Complex          *x_data        = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex          *b_data        = hypre_VectorData(hypre_ParVectorLocalVector(b));
+   HYPRE_Complex          *y_data        = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Complex          *x_buf_data    = NULL;
+   HYPRE_Complex          *x_ext_data    = NULL;
+   hypre_ParCSRCommHandle *comm_handle   = NULL;
+   HYPRE_Complex           res;
+   HYPRE_Int               num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               send_size     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int               i, jj;
+
+   if (send_size)
+   {
+      x_buf_data = hypre_TAlloc(HYPRE_Complex, send_size, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < send_size; i++)
+      {
+         x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+   }
+   if (num_cols_offd)
+   {
+      x_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, x_buf_data, x_ext_data);
+
+   /* Local part, overlapped with the halo exchange */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      res = 0.0;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         res += (HYPRE_Real) A_diag_data[jj] * x_data[A_diag_j[jj]];
+      }
+      y_data[i] = beta * b_data[i] + alpha * res;
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   if (num_cols_offd)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         res = 0.0;
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            res += (HYPRE_Real) A_offd_data[jj] * x_ext_data[A_offd_j[jj]];
+         }
+         y_data[i] += alpha * res;
+      }
+   }
+
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrixMatvec
+ *
+ * y = alpha*A*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParAMGFloatMatrixMatvec( HYPRE_Complex            alpha,
+                               hypre_ParAMGFloatMatrix *A_float,
+                               hypre_ParVector         *x,
+                               HYPRE_Complex            beta,
+                               hypre_ParVector         *y )
+{
+   return hypre_ParAMGFloatMatrixMatvecOutOfPlace(alpha, A_float, x, beta, y, y);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGFloatMatrixMatvecT
+ *
+ * y = alpha*A^T*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParAMGFloatMatrixMatvecT( HYPRE_Complex            alpha,
+                                hypre_ParAMGFloatMatrix *A_float,
+                                hypre_ParVector         *x,
+                                HYPRE_Complex            beta,
+                                hypre_ParVector         *y )
+{
+   hypre_ParCSRMatrix     *A             = hypre_ParAMGFloatMatrixMatrix(A_float);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   float                  *A_diag_data   = hypre_ParAMGFloatMatrixDiagData(A_float);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   float                  *A_offd_data   = hypre_ParAMGFloatMatrixOffdData(A_float);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols      = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int               num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               send_size     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Complex          *x_data        = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex          *y_data        = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Complex          *y_buf_data    = NULL;
+   HYPRE_Complex          *y_ext_data    = NULL;
+   hypre_ParCSRCommHandle *comm_handle   = NULL;
+   HYPRE_Complex           xi;
+   HYPRE_Int               i, jj;
+
+   /* Off-processor contributions are computed first and sent back */
+   if (num_cols_offd)
+   {
+      y_ext_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_rows; i++)
+      {
+         xi = x_data[i];
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            y_ext_data[A_offd_j[jj]] += (HYPRE_Real) A_offd_data[jj] * xi;
+         }
+      }
+   }
+   if (send_size)
+   {
+      y_buf_data = hypre_TAlloc(HYPRE_Complex, send_size, HYPRE_MEMORY_HOST);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, y_ext_data, y_buf_data);
+
+   /* Local part, overlapped with the exchange */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols; i++)
+   {
+      y_data[i] *= beta;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      xi = alpha * x_data[i];
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         y_data[A_diag_j[jj]] += (HYPRE_Real) A_diag_data[jj] * xi;
+      }
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < send_size; i++)
+   {
+      y_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += alpha * y_buf_data[i];
+   }
+
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(y_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFloatRelaxSupported
+ *
+ * Returns 1 if relax_type has a single precision implementation.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFloatRelaxSupported( HYPRE_Int relax_type )
+{
+   switch (relax_type)
+   {
+      case 0:  case 3:  case 4:  case 6:
+      case 8:  case 13: case 14: case 18:
+         return 1;
+
+      default:
+         return 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFloatRelax
+ *
+ * Weighted (l1-)Jacobi and hybrid (l1-)Gauss-Seidel/SOR with a single
+ * precision matrix.  The updates are those of hypre_BoomerAMGRelax for the
+ * supported relaxation types: Jacobi uses the copy of u in Vtemp for all
+ * points, the hybrid smoothers use it outside of the rows of the calling
+ * thread.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFloatRelax( hypre_ParAMGFloatMatrix *A_float,
+                           hypre_ParVector         *f,
+                           HYPRE_Int               *cf_marker,
+                           HYPRE_Int                relax_type,
+                           HYPRE_Int                relax_points,
+                           HYPRE_Real               relax_weight,
+                           HYPRE_Real               omega,
+                           HYPRE_Real              *l1_norms,
+                           hypre_ParVector         *u,
+                           hypre_ParVector         *Vtemp )
+{
+   hypre_ParCSRMatrix     *A             = hypre_ParAMGFloatMatrixMatrix(A_float);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   float                  *A_diag_data   = hypre_ParAMGFloatMatrixDiagData(A_float);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   float                  *A_offd_data   = hypre_ParAMGFloatMatrixOffdData(A_float);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int               num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               send_size     = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Complex          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex          *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex          *v_tmp_data    = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Complex          *v_buf_data    = NULL;
+   HYPRE_Complex          *v_ext_data    = NULL;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Int               jacobi, gs_order, num_sweeps, Skip_diag, non_scale;
+   HYPRE_Int               num_threads, j;
+   HYPRE_Real              prod, one_minus_omega;
+
+   /* Parameters of the corresponding double precision smoother */
+   jacobi     = (relax_type == 0 || relax_type == 18);
+   gs_order   = (relax_type == 4 || relax_type == 14) ? -1 : 1;
+   num_sweeps = (relax_type == 6 || relax_type == 8) ? 2 : 1;
+   switch (relax_type)
+   {
+      case 0:
+         omega = 1.0;
+         l1_norms = NULL;
+         Skip_diag = 1;
+         break;
+
+      case 18:
+         omega = 1.0;
+         Skip_diag = 0;
+         break;
+
+      case 3: case 4: case 6:
+         l1_norms = NULL;
+         Skip_diag = 1;
+         break;
+
+      default:
+         Skip_diag = (relax_weight == 1.0 && omega == 1.0) ? 0 : 1;
+         break;
+   }
+   non_scale       = (relax_weight == 1.0 && omega == 1.0);
+   prod            = 1.0 - relax_weight * omega;
+   one_minus_omega = 1.0 - omega;
+   num_threads     = hypre_NumThreads();
+
+   /*-----------------------------------------------------------------
+    * Halo exchange of u and copy of u into Vtemp
+    *-----------------------------------------------------------------*/
+
+   if (send_size)
+   {
+      v_buf_data = hypre_TAlloc(HYPRE_Complex, send_size, HYPRE_MEMORY_HOST);
+      for (j = 0; j < send_size; j++)
+      {
+         v_buf_data[j] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+   }
+   if (num_cols_offd)
+   {
+      v_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+
+   if (jacobi || num_threads > 1 || !non_scale)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_rows; j++)
+      {
+         v_tmp_data[j] = u_data[j];
+      }
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------
+    * Relax the rows of each thread
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Int     ns, ne, sweep, i, ii, jj;
+      HYPRE_Complex res, res0, res2, di;
+
+      hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend   = iorder > 0 ? ne : ns - 1;
+
+         for (i = ibegin; i != iend; i += iorder)
+         {
+            di = l1_norms ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+
+            if ( (relax_points != 0 && cf_marker[i] != relax_points) || di == 0.0 )
+            {
+               continue;
+            }
+
+            res  = f_data[i];
+            res0 = 0.0;
+            res2 = 0.0;
+            if (jacobi)
+            {
+               for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+               {
+                  res -= (HYPRE_Real) A_diag_data[jj] * v_tmp_data[A_diag_j[jj]];
+               }
+            }
+            else if (non_scale && num_threads == 1)
+            {
+               for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+               {
+                  res0 -= (HYPRE_Real) A_diag_data[jj] * u_data[A_diag_j[jj]];
+               }
+            }
+            else
+            {
+               for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+               {
+                  ii = A_diag_j[jj];
+                  if (ii >= ns && ii < ne)
+                  {
+                     res0 -= (HYPRE_Real) A_diag_data[jj] * u_data[ii];
+                     res2 += (HYPRE_Real) A_diag_data[jj] * v_tmp_data[ii];
+                  }
+                  else
+                  {
+                     res -= (HYPRE_Real) A_diag_data[jj] * v_tmp_data[ii];
+                  }
+               }
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               res -= (HYPRE_Real) A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+            }
+
+            if (non_scale)
+            {
+               res += res0;
+               if (Skip_diag)
+               {
+                  u_data[i] = res / di;
+               }
+               else
+               {
+                  u_data[i] += res / di;
+               }
+            }
+            else
+            {
+               if (Skip_diag)
+               {
+                  u_data[i] *= prod;
+               }
+               u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / di;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+
+   hypre_ParVectorAllZeros(u) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFloatRelaxIF
+ *
+ * Same as hypre_BoomerAMGRelaxIF for a single precision matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFloatRelaxIF( hypre_ParAMGFloatMatrix *A_float,
+                             hypre_ParVector         *f,
+                             HYPRE_Int               *cf_marker,
+                             HYPRE_Int                relax_type,
+                             HYPRE_Int                relax_order,
+                             HYPRE_Int                cycle_param,
+                             HYPRE_Real               relax_weight,
+                             HYPRE_Real               omega,
+                             HYPRE_Real              *l1_norms,
+                             hypre_ParVector         *u,
+                             hypre_ParVector         *Vtemp )
+{
+   HYPRE_Int i, num_points = 1;
+   HYPRE_Int relax_points[2] = {0, 0};
+
+   if (relax_order == 1 && cycle_param < 3)
+   {
+      num_points = 2;
+      if (cycle_param < 2)
+      {
+         /* CF down cycle */
+         relax_points[0] =  1;
+         relax_points[1] = -1;
+      }
+      else
+      {
+         /* FC up cycle */
+         relax_points[0] = -1;
+         relax_points[1] =  1;
+      }
+   }
+
+   for (i = 0; i < num_points; i++)
+   {
+      hypre_BoomerAMGFloatRelax(A_float, f, cf_marker, relax_type, relax_points[i],
+                                relax_weight, omega, l1_norms, u, Vtemp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupFloatHierarchy
+ *
+ * Converts the hierarchy to single precision at the end of the setup.
+ * P and R are converted on all levels.  A coarse-grid operator is converted
+ * if its level is relaxed with a supported smoother and is not handled by a
+ * complex smoother or a coarse-grid solver that uses the matrix values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupFloatHierarchy( void *amg_vdata )
+{
+   hypre_ParAMGData         *amg_data          = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int                 num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix      **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix      **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix      **R_array           = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int                *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int                 smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int                 restri_type       = hypre_ParAMGDataRestriction(amg_data);
+   hypre_ParAMGFloatMatrix **A_float_array;
+   hypre_ParAMGFloatMatrix **P_float_array;
+   hypre_ParAMGFloatMatrix **R_float_array     = NULL;
+   HYPRE_Int                 level, coarse_solve;
+
+   if (!hypre_ParAMGDataFloatHierarchy(amg_data) || num_levels < 2)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Single precision AMG hierarchy is not available for complex values");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_error_flag;
+   }
+
+   /* These cycles and smoothers access the hierarchy directly */
+   if (hypre_ParAMGDataBlockMode(amg_data)        ||
+       hypre_ParAMGDataGridRelaxPoints(amg_data)  ||
+       hypre_ParAMGDataAdditive(amg_data) > -1    ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataSimple(amg_data) > -1)
+   {
+      return hypre_error_flag;
+   }
+
+   coarse_solve = hypre_ParAMGDataParticipate(amg_data) > 0;
+#ifdef HYPRE_USING_DSUPERLU
+   coarse_solve = coarse_solve || hypre_ParAMGDataDSLUSolver(amg_data) != NULL;
+#endif
+
+   A_float_array = hypre_CTAlloc(hypre_ParAMGFloatMatrix *, num_levels, HYPRE_MEMORY_HOST);
+   P_float_array = hypre_CTAlloc(hypre_ParAMGFloatMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
+   if (restri_type)
+   {
+      R_float_array = hypre_CTAlloc(hypre_ParAMGFloatMatrix *, num_levels - 1, HYPRE_MEMORY_HOST);
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      P_float_array[level] = hypre_ParAMGFloatMatrixCreate(P_array[level]);
+      if (restri_type)
+      {
+         R_float_array[level] = hypre_ParAMGFloatMatrixCreate(R_array[level]);
+      }
+   }
+
+   for (level = 1; level < num_levels; level++)
+   {
+      if (level < smooth_num_levels)
+      {
+         continue;
+      }
+
+      if (level < num_levels - 1)
+      {
+         if (!hypre_BoomerAMGFloatRelaxSupported(grid_relax_type[1]) ||
+             !hypre_BoomerAMGFloatRelaxSupported(grid_relax_type[2]))
+         {
+            continue;
+         }
+      }
+      else if (coarse_solve || !hypre_BoomerAMGFloatRelaxSupported(grid_relax_type[3]))
+      {
+         continue;
+      }
+
+      A_float_array[level] = hypre_ParAMGFloatMatrixCreate(A_array[level]);
+   }
+
+   hypre_ParAMGDataAFloatArray(amg_data) = A_float_array;
+   hypre_ParAMGDataPFloatArray(amg_data) = P_float_array;
+   hypre_ParAMGDataRFloatArray(amg_data) = R_float_array;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGDestroyFloatHierarchy
+ *
+ * num_levels is the number of levels of the hierarchy that was converted.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDestroyFloatHierarchy( void      *amg_vdata,
+                                      HYPRE_Int  num_levels )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         level;
+
+   if (hypre_ParAMGDataAFloatArray(amg_data))
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_ParAMGFloatMatrixDestroy(hypre_ParAMGDataAFloatArray(amg_data)[level]);
+      }
+      hypre_TFree(hypre_ParAMGDataAFloatArray(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_ParAMGDataPFloatArray(amg_data))
+   {
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         hypre_ParAMGFloatMatrixDestroy(hypre_ParAMGDataPFloatArray(amg_data)[level]);
+      }
+      hypre_TFree(hypre_ParAMGDataPFloatArray(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_ParAMGDataRFloatArray(amg_data))
+   {
+      for (level = 0; level < num_levels - 1; level++)
+      {
+         hypre_ParAMGFloatMatrixDestroy(hypre_ParAMGDataRFloatArray(amg_data)[level]);
+      }
+      hypre_TFree(hypre_ParAMGDataRFloatArray(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,546 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only re-setup of BoomerAMG
+ *
+ * When the matrix values change but the sparsity pattern does not, the C/F
+ * splittings and strength matrices of a previous setup are reused.  The
+ * interpolation weights and Galerkin products are recomputed and written
+ * into the existing operators, so that their communication packages and the
+ * vectors of the hierarchy remain valid.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupSupported
+ *
+ * Returns 1 if the current parameters allow a numeric-only re-setup, i.e.,
+ * if every interpolation operator is computed from A, S and the C/F
+ * splitting alone, and the coarse-grid operators are Galerkin products.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupSupported( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data      = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int          interp_type   = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int          num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+
+   if (!hypre_ParAMGDataNumericResetup(amg_data))
+   {
+      return 0;
+   }
+
+   if (hypre_ParAMGDataBlockMode(amg_data)              ||
+       hypre_ParAMGDataNodal(amg_data)                  ||
+       hypre_ParAMGDataGSMG(amg_data)                   ||
+       hypre_ParAMGDataAggNumLevels(amg_data) > 0       ||
+       hypre_ParAMGDataPostInterpType(amg_data) > 0     ||
+       hypre_ParAMGInterpRefine(amg_data) > 0           ||
+       hypre_ParAMGInterpVecVariant(amg_data) > 0       ||
+       hypre_ParAMGDataRestriction(amg_data)            ||
+       hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0    ||
+       hypre_ParAMGDataNonGalTolArray(amg_data) != NULL ||
+       hypre_ParAMGDataAdditive(amg_data) > -1          ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1      ||
+       hypre_ParAMGDataSimple(amg_data) > -1            ||
+       hypre_ParAMGDataFloatHierarchy(amg_data))
+   {
+      return 0;
+   }
+
+   switch (interp_type)
+   {
+      case 0:  case 2:  case 3:  case 4:  case 5:  case 6:
+      case 7:  case 8:  case 9:  case 12: case 13: case 14:
+      case 15: case 16: case 17: case 18: case 100:
+         return 1;
+
+      case 19:
+         return (num_functions == 1);
+
+      default:
+         return 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCompatible
+ *
+ * Returns 1 if the hierarchy of a previous setup, including the strength
+ * matrices, is available and matches the parallel layout and the sparsity
+ * pattern (number of nonzeros and off-processor columns) of A.  All
+ * processes return the same value.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupCompatible( void               *amg_vdata,
+                                  hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int             num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **S_array         = hypre_ParAMGDataSArray(amg_data);
+   hypre_IntArray      **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int             compatible_local, compatible;
+   HYPRE_Int             level;
+
+   if (!S_array || !A_array || !P_array || !CF_marker_array || num_levels < 2)
+   {
+      return 0;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (!S_array[level] || !P_array[level] || !A_array[level + 1] ||
+          !CF_marker_array[level])
+      {
+         return 0;
+      }
+   }
+
+   compatible_local =
+      hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumRows(S_array[0]) &&
+      hypre_ParCSRMatrixFirstRowIndex(A) == hypre_ParCSRMatrixFirstRowIndex(S_array[0]) &&
+      hypre_ParCSRMatrixNumRows(A)       == hypre_ParCSRMatrixNumRows(S_array[0])       &&
+      hypre_CSRMatrixNumNonzeros(A_diag) == hypre_ParAMGDataResetupDiagNnz(amg_data)    &&
+      hypre_CSRMatrixNumNonzeros(A_offd) == hypre_ParAMGDataResetupOffdNnz(amg_data)    &&
+      hypre_CSRMatrixNumCols(A_offd)     == hypre_ParAMGDataResetupNumColsOffd(amg_data);
+
+   /* all processes must agree on whether the hierarchy is reused */
+   hypre_MPI_Allreduce(&compatible_local, &compatible, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return compatible;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupSamePattern
+ *
+ * Returns 1 if A and B have the same sparsity pattern on all processes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupSamePatternCSR( hypre_CSRMatrix *A,
+                                      hypre_CSRMatrix *B )
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        nnz      = hypre_CSRMatrixNumNonzeros(A);
+   hypre_CSRMatrix *A_h      = A;
+   hypre_CSRMatrix *B_h      = B;
+   HYPRE_Int        same     = 1;
+   HYPRE_Int        i;
+
+   if (num_rows != hypre_CSRMatrixNumRows(B) ||
+       hypre_CSRMatrixNumCols(A) != hypre_CSRMatrixNumCols(B) ||
+       nnz != hypre_CSRMatrixNumNonzeros(B))
+   {
+      return 0;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      A_h = hypre_CSRMatrixClone_v2(A, 0, HYPRE_MEMORY_HOST);
+      B_h = hypre_CSRMatrixClone_v2(B, 0, HYPRE_MEMORY_HOST);
+   }
+
+   for (i = 0; i <= num_rows && same; i++)
+   {
+      same = (hypre_CSRMatrixI(A_h)[i] == hypre_CSRMatrixI(B_h)[i]);
+   }
+   for (i = 0; i < nnz && same; i++)
+   {
+      same = (hypre_CSRMatrixJ(A_h)[i] == hypre_CSRMatrixJ(B_h)[i]);
+   }
+
+   if (A_h != A)
+   {
+      hypre_CSRMatrixDestroy(A_h);
+      hypre_CSRMatrixDestroy(B_h);
+   }
+
+   return same;
+}
+
+static HYPRE_Int
+hypre_BoomerAMGResetupSamePattern( hypre_ParCSRMatrix *A,
+                                   hypre_ParCSRMatrix *B )
+{
+   MPI_Comm       comm          = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int      num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_BigInt  *col_map_A     = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt  *col_map_B     = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_Int      same_local, same, i;
+
+   same_local = (hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumRows(B) &&
+                 hypre_ParCSRMatrixGlobalNumCols(A) == hypre_ParCSRMatrixGlobalNumCols(B));
+   same_local = same_local &&
+                hypre_BoomerAMGResetupSamePatternCSR(hypre_ParCSRMatrixDiag(A),
+                                                     hypre_ParCSRMatrixDiag(B));
+   same_local = same_local &&
+                hypre_BoomerAMGResetupSamePatternCSR(hypre_ParCSRMatrixOffd(A),
+                                                     hypre_ParCSRMatrixOffd(B));
+   for (i = 0; i < num_cols_offd && same_local; i++)
+   {
+      same_local = (col_map_A[i] == col_map_B[i]);
+   }
+
+   /* all processes must agree on whether the operator is replaced */
+   hypre_MPI_Allreduce(&same_local, &same, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return same;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCopyValues
+ *
+ * Copies the values of B into A, which has the same sparsity pattern.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupCopyValues( hypre_ParCSRMatrix *A,
+                                  hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix       *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix       *A_offd          = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix       *B_diag          = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix       *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_MemoryLocation   memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+
+   hypre_TMemcpy(hypre_CSRMatrixData(A_diag), hypre_CSRMatrixData(B_diag), HYPRE_Complex,
+                 hypre_CSRMatrixNumNonzeros(A_diag), memory_location,
+                 hypre_ParCSRMatrixMemoryLocation(B));
+   hypre_TMemcpy(hypre_CSRMatrixData(A_offd), hypre_CSRMatrixData(B_offd), HYPRE_Complex,
+                 hypre_CSRMatrixNumNonzeros(A_offd), memory_location,
+                 hypre_ParCSRMatrixMemoryLocation(B));
+
+   /* stored transposes and SELL-C-sigma layouts refer to the old values */
+   hypre_CSRMatrixSellDestroy(A_diag);
+   hypre_CSRMatrixSellDestroy(A_offd);
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(A));
+      hypre_ParCSRMatrixDiagT(A) = NULL;
+   }
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(A));
+      hypre_ParCSRMatrixOffdT(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupBuildInterp
+ *
+ * Recomputes the interpolation operator of a level from A, the kept strength
+ * matrix S and the kept C/F splitting, using the same routine as the setup.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupBuildInterp( hypre_ParAMGData    *amg_data,
+                                   hypre_ParCSRMatrix  *A,
+                                   HYPRE_Int           *CF_marker,
+                                   hypre_ParCSRMatrix  *S,
+                                   HYPRE_BigInt        *coarse_pnts_global,
+                                   HYPRE_Int           *dof_func_data,
+                                   hypre_ParCSRMatrix **P_ptr )
+{
+   HYPRE_Int    interp_type   = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int    sep_weight    = hypre_ParAMGDataSepWeight(amg_data);
+   HYPRE_Int    num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int    debug_flag    = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Real   trunc_factor  = hypre_ParAMGDataTruncFactor(amg_data);
+   HYPRE_Int    P_max_elmts   = hypre_ParAMGDataPMaxElmts(amg_data);
+   HYPRE_Int    dbg_flg;
+
+   /* same mapping of interp_type 9 and 5 as in the setup */
+   if (interp_type == 9)
+   {
+      interp_type = 8;
+      sep_weight = 1;
+   }
+   else if (interp_type == 5)
+   {
+      interp_type = 4;
+      sep_weight = 1;
+   }
+
+   switch (interp_type)
+   {
+      case 2:
+         hypre_BoomerAMGBuildInterpHE(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                      dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                      P_ptr);
+         break;
+
+      case 3:
+      case 15:
+         hypre_BoomerAMGBuildDirInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                       interp_type, P_ptr);
+         break;
+
+      case 4:
+         hypre_BoomerAMGBuildMultipass(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                       sep_weight, P_ptr);
+         break;
+
+      case 6:
+         hypre_BoomerAMGBuildExtPIInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                         dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                         P_ptr);
+         break;
+
+      case 7:
+         hypre_BoomerAMGBuildExtPICCInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                           dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                           P_ptr);
+         break;
+
+      case 8:
+         hypre_BoomerAMGBuildStdInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                       sep_weight, P_ptr);
+         break;
+
+      case 12:
+         hypre_BoomerAMGBuildFFInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                      dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                      P_ptr);
+         break;
+
+      case 13:
+         hypre_BoomerAMGBuildFF1Interp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                       P_ptr);
+         break;
+
+      case 14:
+         hypre_BoomerAMGBuildExtInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                       dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                       P_ptr);
+         break;
+
+      case 16:
+         hypre_BoomerAMGBuildModExtInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                          dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                          P_ptr);
+         break;
+
+      case 17:
+         hypre_BoomerAMGBuildModExtPIInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                            dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                            P_ptr);
+         break;
+
+      case 18:
+         hypre_BoomerAMGBuildModExtPEInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                            dof_func_data, debug_flag, trunc_factor, P_max_elmts,
+                                            P_ptr);
+         break;
+
+      case 100:
+         hypre_BoomerAMGBuildInterpOnePnt(A, CF_marker, S, coarse_pnts_global, 1, NULL,
+                                          debug_flag, P_ptr);
+         break;
+
+      default: /* classical interpolation */
+         dbg_flg = debug_flag;
+         if (hypre_ParAMGDataPrintLevel(amg_data)) { dbg_flg = -debug_flag; }
+         hypre_BoomerAMGBuildInterp(A, CF_marker, S, coarse_pnts_global, num_functions,
+                                    dof_func_data, dbg_flg, trunc_factor, P_max_elmts,
+                                    P_ptr);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupLevels
+ *
+ * Updates the interpolation and coarse-grid operators of all levels for the
+ * new values of A_array[0].  An interpolation operator or a coarsest-grid
+ * operator whose recomputed pattern differs from the kept one (e.g., due to
+ * value-based truncation or dropping) is replaced by the recomputed operator.
+ * The strength matrix and C/F splitting of an intermediate level refer to the
+ * pattern and communication package of its operator.  If that pattern
+ * changes, the update stops and *complete_ptr is set to 0, in which case the
+ * caller must discard the hierarchy and perform a full setup.  Otherwise,
+ * *complete_ptr is set to 1.
+ *
+ * When the Galerkin products are computed by the modularized triple product
+ * without dropping of small entries, the full setup keeps a product plan for
+ * each of them.  On levels where neither P nor the fine-grid operator changed
+ * pattern, only the values of the product are recomputed; elsewhere the plan
+ * is rebuilt.  Otherwise, the coarse-grid operators are recomputed with the
+ * same routine as in the full setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupLevels( void      *amg_vdata,
+                              HYPRE_Int *complete_ptr )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int             num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **S_array         = hypre_ParAMGDataSArray(amg_data);
+   hypre_IntArray      **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_IntArray      **dof_func_array  = hypre_ParAMGDataDofFuncArray(amg_data);
+   HYPRE_Int             rap2            = hypre_ParAMGDataRAP2(amg_data);
+   HYPRE_Int             keepTranspose   = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Real            A_drop_tol      = hypre_ParAMGDataADropTol(amg_data);
+   HYPRE_Int             A_drop_type     = hypre_ParAMGDataADropType(amg_data);
+   hypre_ParCSRRAPPlan **RAP_plan_array  = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int             use_plans       = (RAP_plan_array != NULL && A_drop_tol <= 0.0 &&
+                                            !rap2 && hypre_ParAMGDataModularizedMatMat(amg_data));
+
+   hypre_ParCSRMatrix   *P, *A_H, *Q;
+   HYPRE_Int             same_A = 1, same_P;
+   HYPRE_BigInt          coarse_pnts_global[2];
+   HYPRE_Int            *dof_func_data;
+   HYPRE_Int             num_procs;
+   HYPRE_Int             level;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A_array[0]), &num_procs);
+
+   *complete_ptr = 1;
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      /*-----------------------------------------------------------------
+       * Interpolation weights
+       *-----------------------------------------------------------------*/
+
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+
+      coarse_pnts_global[0] = hypre_ParCSRMatrixColStarts(P_array[level])[0];
+      coarse_pnts_global[1] = hypre_ParCSRMatrixColStarts(P_array[level])[1];
+      dof_func_data = dof_func_array[level] ? hypre_IntArrayData(dof_func_array[level]) : NULL;
+
+      P = NULL;
+      hypre_BoomerAMGResetupBuildInterp(amg_data, A_array[level],
+                                        hypre_IntArrayData(CF_marker_array[level]),
+                                        S_array[level], coarse_pnts_global,
+                                        dof_func_data, &P);
+
+      same_P = hypre_BoomerAMGResetupSamePattern(P, P_array[level]);
+      if (same_P)
+      {
+         hypre_BoomerAMGResetupCopyValues(P_array[level], P);
+         hypre_ParCSRMatrixDestroy(P);
+      }
+      else
+      {
+         hypre_ParCSRMatrixDestroy(P_array[level]);
+         P_array[level] = P;
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
+
+      /*-----------------------------------------------------------------
+       * Galerkin product
+       *-----------------------------------------------------------------*/
+
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      if (use_plans && RAP_plan_array[level] && same_A && same_P)
+      {
+         hypre_ParCSRMatrixRAPKTNumeric(RAP_plan_array[level], P_array[level],
+                                        A_array[level], P_array[level], A_array[level + 1]);
+         if (keepTranspose)
+         {
+            hypre_ParCSRMatrixLocalTranspose(P_array[level]);
+         }
+         HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+         continue;
+      }
+
+      if (use_plans)
+      {
+         hypre_ParCSRRAPPlanDestroy(RAP_plan_array[level]);
+         A_H = hypre_ParCSRMatrixRAPKTSetup(P_array[level], A_array[level], P_array[level],
+                                            &RAP_plan_array[level]);
+         if (keepTranspose)
+         {
+            hypre_ParCSRMatrixLocalTranspose(P_array[level]);
+         }
+      }
+      else if (rap2)
+      {
+         if (hypre_ParAMGDataModularizedMatMat(amg_data))
+         {
+            Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keepTranspose);
+         }
+         else
+         {
+            Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParTMatmul(P_array[level], Q);
+         }
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else if (hypre_ParAMGDataModularizedMatMat(amg_data))
+      {
+         A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                       P_array[level], keepTranspose);
+      }
+      else
+      {
+         hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                              P_array[level], keepTranspose, &A_H);
+      }
+
+      hypre_ParCSRMatrixDropSmallEntries(A_H, A_drop_tol, A_drop_type);
+
+      same_A = hypre_BoomerAMGResetupSamePattern(A_H, A_array[level + 1]);
+      if (same_A)
+      {
+         hypre_BoomerAMGResetupCopyValues(A_array[level + 1], A_H);
+         hypre_ParCSRMatrixDestroy(A_H);
+      }
+      else if (level + 1 < num_levels - 1)
+      {
+         /* S_array[level + 1] and CF_marker_array[level + 1] no longer match */
+         hypre_ParCSRMatrixDestroy(A_H);
+         *complete_ptr = 0;
+         HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+         break;
+      }
+      else
+      {
+         if (num_procs > 1 && hypre_ParCSRMatrixCommPkg(A_H) == NULL)
+         {
+            hypre_MatvecCommPkgCreate(A_H);
+         }
+         if (A_drop_tol <= 0.0)
+         {
+            hypre_ParCSRMatrixSetNumNonzeros(A_H);
+            hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+         }
+         hypre_ParCSRMatrixDestroy(A_array[level + 1]);
+         A_array[level + 1] = A_H;
+      }
+      HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
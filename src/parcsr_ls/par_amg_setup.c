@@ -203,6 +203,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_Int       block_mode = 0;
 
+   hypre_ParCSRMatrix **S_array = NULL;
+   HYPRE_Int       keep_S  = 0;
+   HYPRE_Int       resetup = 0;
+
    HYPRE_Int       mult_addlvl = hypre_max(mult_additive, simple);
    HYPRE_Int       addlvl = hypre_max(mult_addlvl, additive);
    HYPRE_Int       rap2 = hypre_ParAMGDataRAP2(amg_data);
@@ -329,6 +333,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, 0, HYPRE_PROFILE_SETUP);
 
    /* change in definition of standard and multipass interpolation, by
       eliminating interp_type 9 and 5 and setting sep_weight instead
@@ -363,7 +368,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   /* block relaxation choosen (24 and 25 are the scalar multicolor smoothers) */
+   if (grid_relax_type[0] >= 20 && grid_relax_type[0] != 24 && grid_relax_type[0] != 25)
    {
 
       if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
@@ -409,13 +415,29 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
 
+   /* numeric-only re-setup: keep the strength matrices of a full setup, and
+      reuse the hierarchy on the next setup if it is compatible with A */
+   keep_S  = hypre_BoomerAMGResetupSupported(amg_data);
+   resetup = keep_S && hypre_BoomerAMGResetupCompatible(amg_data, A) &&
+             hypre_ParVectorNumVectors(hypre_ParAMGDataFArray(amg_data)[1]) == num_vectors;
+   S_array = hypre_ParAMGDataSArray(amg_data);
+
+   /* update the kept levels before the hierarchy is freed below, so that a full
+      setup is done instead if a coarse-grid operator changed its pattern */
+   if (resetup)
+   {
+      A_array[0] = A;
+      hypre_BoomerAMGResetupLevels(amg_data, &resetup);
+   }
+
 
    /* end of systems checks */
 
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!resetup &&
+       (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+        dof_func_array || R_array || R_block_array))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -443,6 +465,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             P_array[j] = NULL;
          }
 
+         if (S_array && S_array[j])
+         {
+            hypre_ParCSRMatrixDestroy(S_array[j]);
+            S_array[j] = NULL;
+         }
+
+         if (hypre_ParAMGDataRAPPlanArray(amg_data))
+         {
+            hypre_ParCSRRAPPlanDestroy(hypre_ParAMGDataRAPPlanArray(amg_data)[j]);
+            hypre_ParAMGDataRAPPlanArray(amg_data)[j] = NULL;
+         }
+
          if (P_block_array[j])
          {
             hypre_ParCSRBlockMatrixDestroy(P_block_array[j]);
@@ -557,6 +591,48 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+
+      if (hypre_ParAMGDataBlockDiagInv(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataBlockDiagInv(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataBlockDiagInv(amg_data), HYPRE_MEMORY_HOST);
+      }
+
+      if (hypre_ParAMGDataColorPtrArray(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorPtrArray(amg_data)[i]);
+            hypre_IntArrayDestroy(hypre_ParAMGDataColorRowsArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataColorPtrArray(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorRowsArray(amg_data), HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoomerAMGDestroyFloatHierarchy(amg_data, old_num_levels);
+
+      /* CG smoothers of relax_type 15 */
+      if (smoother && old_num_levels > 0 &&
+          (grid_relax_type[1] == 15 || grid_relax_type[3] == 15))
+      {
+         if (grid_relax_type[1] == 15)
+         {
+            for (i = 0; i < old_num_levels; i++)
+            {
+               HYPRE_ParCSRPCGDestroy(smoother[i]);
+            }
+         }
+         else
+         {
+            HYPRE_ParCSRPCGDestroy(smoother[old_num_levels - 1]);
+         }
+         hypre_TFree(hypre_ParAMGDataSmoother(amg_data), HYPRE_MEMORY_HOST);
+         smoother = NULL;
+      }
+
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > 1 &&
@@ -675,6 +751,29 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       CF_marker_array = hypre_CTAlloc(hypre_IntArray*, max_levels, HYPRE_MEMORY_HOST);
    }
 
+   if (keep_S && S_array == NULL)
+   {
+      S_array = hypre_CTAlloc(hypre_ParCSRMatrix*, max_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataSArray(amg_data) = S_array;
+   }
+
+   if (keep_S && hypre_ParAMGDataRAPPlanArray(amg_data) == NULL)
+   {
+      hypre_ParAMGDataRAPPlanArray(amg_data) = hypre_CTAlloc(hypre_ParCSRRAPPlan*, max_levels,
+                                                             HYPRE_MEMORY_HOST);
+   }
+
+   /* pattern of the fine-grid matrix of the kept hierarchy */
+   if (keep_S)
+   {
+      hypre_ParAMGDataResetupDiagNnz(amg_data) =
+         hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+      hypre_ParAMGDataResetupOffdNnz(amg_data) =
+         hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+      hypre_ParAMGDataResetupNumColsOffd(amg_data) =
+         hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   }
+
    if (num_C_points_coarse > 0)
    {
 #if defined(HYPRE_USING_GPU)
@@ -892,7 +991,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    F_array = hypre_ParAMGDataFArray(amg_data);
    U_array = hypre_ParAMGDataUArray(amg_data);
 
-   if (F_array != NULL || U_array != NULL)
+   if (!resetup && (F_array != NULL || U_array != NULL))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -953,6 +1052,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Numeric-only re-setup: the kept interpolation and
+    *  coarse-grid operators have been updated above, skip
+    *  the coarsening loop
+    *-----------------------------------------------------*/
+
+   if (resetup)
+   {
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+      hypre_GpuProfilingPopRange();
+      level = old_num_levels - 1;
+      HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
+      hypre_GpuProfilingPushRange(nvtx_name);
+
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -1060,6 +1178,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /**** Get the Strength Matrix ****/
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_STRENGTH);
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1186,8 +1305,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
          }
 
+         hypre_ProfileEnd();
+
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_COARSEN);
 
          if (nodal == 0) /* no nodal coarsening */
          {
@@ -1210,6 +1332,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             {
 #ifdef HYPRE_MIXEDINT
                hypre_error_w_msg(HYPRE_ERROR_GENERIC, "CGC coarsening is not available in mixedint mode!");
+               hypre_ProfileEnd(); /* coarsen */
+               hypre_ProfileEnd(); /* setup */
                return hypre_error_flag;
 #endif
                hypre_BoomerAMGCoarsenCGCb(S, A_array[level], measure_type, coarsen_type,
@@ -1662,6 +1786,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   coarse_dof_func = NULL;
                }
 
+               hypre_ProfileEnd();
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
                break;
             }
@@ -1691,6 +1816,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   Sabs = NULL;
                }
 
+               hypre_ProfileEnd();
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
                break;
             }
@@ -1699,8 +1825,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_GpuProfilingPopRange();
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_INTERP);
 
          if (level < agg_num_levels)
          {
@@ -2469,6 +2597,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             dof_func_array[level + 1] = coarse_dof_func;
          }
 
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
       } /* end of if max_levels > 1 */
 
@@ -2740,6 +2869,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+            hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_RAP);
             if (ns == 1)
             {
                hypre_ParCSRMatrix *Q = NULL;
@@ -2897,6 +3027,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                P_array[level] = Pnew;
                hypre_ParCSRMatrixDestroy(C);
             } /* if (ns == 1) */
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", "RAP");
 
             if (add_P_max_elmts || add_trunc_factor)
@@ -2918,7 +3049,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
-      if (S)
+      if (S && keep_S)
+      {
+         S_array[level] = S;
+      }
+      else if (S)
       {
          hypre_ParCSRMatrixDestroy(S);
       }
@@ -2939,6 +3074,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_RAP);
       if (debug_flag == 1) { wall_time = time_getWallclockSeconds(); }
 
       if (block_mode)
@@ -3039,7 +3175,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            if (hypre_ParAMGDataModularizedMatMat(amg_data) &&
+                keep_S && hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+            {
+               /* same product, with a plan for numeric-only re-setups */
+               A_H = hypre_ParCSRMatrixRAPKTSetup(P_array[level], A_array[level], P_array[level],
+                                                  &hypre_ParAMGDataRAPPlanArray(amg_data)[level]);
+               if (keepTranspose)
+               {
+                  hypre_ParCSRMatrixLocalTranspose(P_array[level]);
+               }
+            }
+            else if (hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
@@ -3071,6 +3218,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParCSRMatrixPrintIJ(P_array[level], 0, 0, file);
 #endif
 
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_REGION_END("%s", "RAP");
       if (debug_flag == 1)
       {
@@ -3125,6 +3273,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
+   hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_COARSE_SETUP);
 
    /* redundant coarse grid solve */
    if ((seq_threshold >= coarse_threshold) &&
@@ -3164,11 +3313,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          grid_relax_type[3] = grid_relax_type[1];
       }
    }
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
    HYPRE_ANNOTATE_MGLEVEL_END(level);
    hypre_GpuProfilingPopRange();
 
-   if (level > 0)
+   if (level > 0 && !resetup)
    {
       if (block_mode)
       {
@@ -3235,6 +3385,21 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataL1Norms(amg_data) = l1_norms;
    }
 
+   /* inverted diagonal blocks for the block smoothers */
+   if (block_mode)
+   {
+      HYPRE_Real **block_diag_inv = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < num_levels; j++)
+      {
+         if (A_block_array[j])
+         {
+            hypre_BoomerAMGBlockRelaxDiagInv(A_block_array[j], &block_diag_inv[j]);
+         }
+      }
+      hypre_ParAMGDataBlockDiagInv(amg_data) = block_diag_inv;
+   }
+
    /* Chebyshev */
    if (grid_relax_type[0] == 16 || grid_relax_type[1] == 16 ||
        grid_relax_type[2] == 16 || grid_relax_type[3] == 16)
@@ -3249,6 +3414,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
    }
 
+   /* Multicolor Gauss-Seidel: color the diagonal blocks once */
+   if (grid_relax_type[0] == 24 || grid_relax_type[1] == 24 ||
+       grid_relax_type[2] == 24 || grid_relax_type[3] == 24 ||
+       grid_relax_type[0] == 25 || grid_relax_type[1] == 25 ||
+       grid_relax_type[2] == 25 || grid_relax_type[3] == 25)
+   {
+      hypre_IntArray **color_ptr_array  = hypre_CTAlloc(hypre_IntArray *, num_levels,
+                                                        HYPRE_MEMORY_HOST);
+      hypre_IntArray **color_rows_array = hypre_CTAlloc(hypre_IntArray *, num_levels,
+                                                        HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < num_levels; j++)
+      {
+         hypre_BoomerAMGRelaxComputeColors(A_array[j], &color_ptr_array[j], &color_rows_array[j]);
+      }
+      hypre_ParAMGDataColorPtrArray(amg_data)  = color_ptr_array;
+      hypre_ParAMGDataColorRowsArray(amg_data) = color_rows_array;
+   }
+
    /* CG */
    if (grid_relax_type[0] == 15 || grid_relax_type[1] == 15 ||
        grid_relax_type[2] == 15 || grid_relax_type[3] == 15)
@@ -3518,6 +3702,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "Schwarz smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3562,6 +3747,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                            "Euclid smoothing is not available in mixedint mode!");
+         hypre_ProfileEnd(); /* setup */
          return hypre_error_flag;
 #endif
 
@@ -3569,6 +3755,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "Euclid smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3598,6 +3785,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "FSAI smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3629,6 +3817,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "ILU smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3656,6 +3845,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                            "ParaSails smoothing is not available in mixedint mode!");
+         hypre_ProfileEnd(); /* setup */
          return hypre_error_flag;
 #endif
 
@@ -3663,6 +3853,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "ParaSails smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3681,6 +3872,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                            "Pilut smoothing is not available in mixedint mode!");
+         hypre_ProfileEnd(); /* setup */
          return hypre_error_flag;
 #endif
 
@@ -3688,6 +3880,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                               "Pilut smoothing doesn't support multicomponent vectors");
+            hypre_ProfileEnd(); /* setup */
             return hypre_error_flag;
          }
 
@@ -3956,6 +4149,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /* Single precision storage of the hierarchy for the solve phase */
+   hypre_BoomerAMGSetupFloatHierarchy(amg_data);
+
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
@@ -68,13 +68,16 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real          relative_resid;
    HYPRE_Real          rhs_norm = 0.0;
    HYPRE_Real          old_resid;
+   HYPRE_Real          resid_nrm2;
+   hypre_MPI_Request   resid_request;
+   hypre_ParVector    *r_vec;
    HYPRE_Real          ieee_check = 0.;
 
    hypre_ParVector    *Vtemp;
    hypre_ParVector    *Rtemp;
    hypre_ParVector    *Ptemp;
    hypre_ParVector    *Ztemp;
-   hypre_ParVector    *Residual;
+   hypre_ParVector    *Residual = NULL;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -118,6 +121,42 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       return hypre_error_flag;
    }
 
+   /* Multicomponent vectors (several right-hand sides solved together) are
+      supported by the multiplicative cycle with pointwise smoothers only */
+   if (num_vectors > 1)
+   {
+      HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+      HYPRE_Int  unsupported     = block_mode ||
+                                   hypre_ParAMGDataAFloatArray(amg_data) ||
+                                   hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+                                   hypre_ParAMGDataParticipate(amg_data) ||
+                                   (additive      >= 0 && additive      < num_levels) ||
+                                   (mult_additive >= 0 && mult_additive < num_levels) ||
+                                   (simple        >= 0 && simple        < num_levels);
+
+#ifdef HYPRE_USING_DSUPERLU
+      unsupported = unsupported || hypre_ParAMGDataDSLUSolver(amg_data) != NULL;
+#endif
+
+      for (j = 0; j < 5 && !unsupported; j++)
+      {
+         HYPRE_Int relax_type = (j < 4) ? grid_relax_type[j] :
+                                hypre_ParAMGDataUserRelaxType(amg_data);
+
+         unsupported = (relax_type == 15 || relax_type == 16 || relax_type == 17 ||
+                        relax_type == 24 || relax_type == 25);
+      }
+
+      if (unsupported)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Unsupported AMG options for multicomponent vectors!\n");
+         return hypre_error_flag;
+      }
+   }
+
+   hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, 0, HYPRE_PROFILE_SOLVE);
+
    /* Update work vectors */
    hypre_ParVectorResize(Vtemp, num_vectors);
    hypre_ParVectorResize(Rtemp, num_vectors);
@@ -169,24 +208,31 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
    {
-      if ( amg_logging > 1 )
+      r_vec = (amg_logging > 1) ? Residual : Vtemp;
+
+      if (tol > 0)
       {
-         hypre_ParVectorCopy(F_array[0], Residual);
-         if (tol > 0)
-         {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Residual);
-         }
-         resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+         /* fused residual and local norm; the global reduction is overlapped
+            with the computation of the rhs norm below */
+         hypre_ParCSRMatrixMatvecNorm2Begin(alpha, A_array[0], U_array[0], beta, F_array[0],
+                                            r_vec, &resid_nrm2, &resid_request);
       }
       else
       {
-         hypre_ParVectorCopy(F_array[0], Vtemp);
-         if (tol > 0)
-         {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
-         }
-         resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+         hypre_ParVectorCopy(F_array[0], r_vec);
+         resid_nrm2 = hypre_ParVectorInnerProd(r_vec, r_vec);
+      }
+
+      if (0 == converge_type)
+      {
+         rhs_norm = hypre_sqrt(hypre_ParVectorInnerProd(f, f));
+      }
+
+      if (tol > 0)
+      {
+         hypre_ParCSRMatrixMatvecNorm2End(&resid_request);
       }
+      resid_nrm = hypre_sqrt(resid_nrm2);
 
       /* Since it is does not diminish performance, attempt to return an error flag
          and notify users when they supply bad input. */
@@ -210,6 +256,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -220,7 +267,6 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
       if (0 == converge_type)
       {
-         rhs_norm = hypre_sqrt(hypre_ParVectorInnerProd(f, f));
          if (rhs_norm)
          {
             relative_resid = resid_nrm_init / rhs_norm;
@@ -280,16 +326,9 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       {
          old_resid = resid_nrm;
 
-         if ( amg_logging > 1 )
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Residual );
-            resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
-         }
-         else
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
-         }
+         r_vec = (amg_logging > 1) ? Residual : Vtemp;
+         resid_nrm = hypre_sqrt(hypre_ParCSRMatrixMatvecNorm2(alpha, A_array[0], U_array[0],
+                                                              beta, F_array[0], r_vec));
 
          if (old_resid)
          {
@@ -416,6 +455,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
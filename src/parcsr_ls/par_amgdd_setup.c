@@ -73,6 +73,8 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
    // If the underlying AMG data structure has not yet been set up, call BoomerAMGSetup()
    if (!hypre_ParAMGDataAArray(amg_data))
    {
+      // The composite grids are built from the double precision hierarchy
+      hypre_ParAMGDataFloatHierarchy(amg_data) = 0;
       hypre_BoomerAMGSetup((void*) amg_data, A, b, x);
    }
 
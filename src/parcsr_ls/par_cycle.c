@@ -42,6 +42,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
    hypre_ParCSRBlockMatrix **R_block_array;
+   HYPRE_Real              **block_diag_inv;
 
    HYPRE_Real      *Ztemp_data;
    HYPRE_Real      *Ptemp_data;
@@ -96,6 +97,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_Vector   *l1_norms_level;
    hypre_Vector  **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
+   hypre_IntArray **color_ptr_array = hypre_ParAMGDataColorPtrArray(amg_data);
+   hypre_IntArray **color_rows_array = hypre_ParAMGDataColorRowsArray(amg_data);
+   hypre_ParAMGFloatMatrix **A_float_array = hypre_ParAMGDataAFloatArray(amg_data);
+   hypre_ParAMGFloatMatrix **P_float_array = hypre_ParAMGDataPFloatArray(amg_data);
+   hypre_ParAMGFloatMatrix **R_float_array = hypre_ParAMGDataRFloatArray(amg_data);
    HYPRE_Int       seq_cg = 0;
    HYPRE_Int       partial_cycle_coarsest_level;
    HYPRE_Int       partial_cycle_control;
@@ -128,6 +134,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    A_block_array     = hypre_ParAMGDataABlockArray(amg_data);
    P_block_array     = hypre_ParAMGDataPBlockArray(amg_data);
    R_block_array     = hypre_ParAMGDataRBlockArray(amg_data);
+   block_diag_inv    = hypre_ParAMGDataBlockDiagInv(amg_data);
    block_mode        = hypre_ParAMGDataBlockMode(amg_data);
 
    num_grid_sweeps     = hypre_ParAMGDataNumGridSweeps(amg_data);
@@ -364,7 +371,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
          hypre_GpuProfilingPushRange("Coarse solve");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_COARSE_SOLVE);
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
          hypre_GpuProfilingPopRange();
       }
@@ -373,7 +382,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
          hypre_GpuProfilingPushRange("Coarse solve");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level, HYPRE_PROFILE_COARSE_SOLVE);
          hypre_SLUDistSolve(hypre_ParAMGDataDSLUSolver(amg_data), Aux_F, Aux_U);
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
          hypre_GpuProfilingPopRange();
       }
@@ -385,6 +396,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          *-----------------------------------------------------------------*/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
          hypre_GpuProfilingPushRange("Relaxation");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, level,
+                            (cycle_param == 3) ? HYPRE_PROFILE_COARSE_SOLVE : HYPRE_PROFILE_RELAX);
 
          for (jj = 0; jj < cg_num_sweep; jj++)
          {
@@ -495,6 +508,21 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   /* Gaussian elimination */
                   hypre_GaussElimSolve(amg_data, level, relax_type);
                }
+               else if (A_float_array && A_float_array[level])
+               {
+                  /* single precision operator */
+                  Solve_err_flag = hypre_BoomerAMGFloatRelaxIF(A_float_array[level],
+                                                               Aux_F,
+                                                               CF_marker,
+                                                               relax_type,
+                                                               relax_order,
+                                                               cycle_param,
+                                                               relax_weight[level],
+                                                               omega[level],
+                                                               l1_norms_level ? hypre_VectorData(l1_norms_level) : NULL,
+                                                               Aux_U,
+                                                               Vtemp);
+               }
                else if (relax_type == 18)
                {
                   /* L1 - Jacobi*/
@@ -549,6 +577,22 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                     Aux_U, Vtemp);
                   }
                }
+               else if ((relax_type == 24 || relax_type == 25) && !old_version && !block_mode)
+               {
+                  /* multicolor Gauss-Seidel with the coloring of this level */
+                  Solve_err_flag = hypre_BoomerAMGRelaxMulticolorIF(A_array[level],
+                                                                    Aux_F,
+                                                                    CF_marker,
+                                                                    relax_type,
+                                                                    relax_local,
+                                                                    cycle_param,
+                                                                    relax_weight[level],
+                                                                    omega[level],
+                                                                    color_ptr_array ? color_ptr_array[level] : NULL,
+                                                                    color_rows_array ? color_rows_array[level] : NULL,
+                                                                    Aux_U,
+                                                                    Vtemp);
+               }
                else if (old_version)
                {
                   Solve_err_flag = hypre_BoomerAMGRelax(A_array[level],
@@ -576,6 +620,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                                   cycle_param,
                                                                   relax_weight[level],
                                                                   omega[level],
+                                                                  block_diag_inv ?
+                                                                  block_diag_inv[level] : NULL,
                                                                   Aux_U,
                                                                   Vtemp);
                   }
@@ -598,6 +644,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  hypre_ProfileEnd();
                   HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
                   HYPRE_ANNOTATE_MGLEVEL_END(level);
                   HYPRE_ANNOTATE_FUNC_END;
@@ -632,6 +679,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
             }
          } /* for (jj = 0; jj < cg_num_sweep; jj++) */
 
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
          hypre_GpuProfilingPopRange();
       }
@@ -662,18 +710,26 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
          hypre_GpuProfilingPushRange("Residual");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, fine_grid, HYPRE_PROFILE_RESIDUAL);
          if (block_mode)
          {
             hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
             hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
                                           beta, Vtemp);
          }
+         else if (A_float_array && A_float_array[fine_grid])
+         {
+            hypre_ParAMGFloatMatrixMatvecOutOfPlace(alpha, A_float_array[fine_grid],
+                                                    U_array[fine_grid], beta,
+                                                    F_array[fine_grid], Vtemp);
+         }
          else
          {
             // JSP: avoid unnecessary copy using out-of-place version of SpMV
             hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
                                                beta, F_array[fine_grid], Vtemp);
          }
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Residual");
          hypre_GpuProfilingPopRange();
 
@@ -682,11 +738,22 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
          hypre_GpuProfilingPushRange("Restriction");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, fine_grid, HYPRE_PROFILE_RESTRICT);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
                                            beta, F_array[coarse_grid]);
          }
+         else if (R_float_array)
+         {
+            hypre_ParAMGFloatMatrixMatvec(alpha, R_float_array[fine_grid], Vtemp,
+                                          beta, F_array[coarse_grid]);
+         }
+         else if (P_float_array)
+         {
+            hypre_ParAMGFloatMatrixMatvecT(alpha, P_float_array[fine_grid], Vtemp,
+                                           beta, F_array[coarse_grid]);
+         }
          else
          {
             if (restri_type)
@@ -701,6 +768,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                          beta, F_array[coarse_grid]);
             }
          }
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
          hypre_GpuProfilingPopRange();
@@ -735,12 +803,19 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
          hypre_GpuProfilingPushRange("Interpolation");
+         hypre_ProfileBegin(HYPRE_PROFILE_BOOMERAMG, fine_grid, HYPRE_PROFILE_INTERP_APPLY);
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
                                           U_array[coarse_grid],
                                           beta, U_array[fine_grid]);
          }
+         else if (P_float_array)
+         {
+            hypre_ParAMGFloatMatrixMatvec(alpha, P_float_array[fine_grid],
+                                          U_array[coarse_grid],
+                                          beta, U_array[fine_grid]);
+         }
          else
          {
             /* printf("Proc %d: level %d, n %d, Interpolation\n", my_id, level, local_size); */
@@ -752,6 +827,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          hypre_ParVectorAllZeros(U_array[fine_grid]) = 0;
 
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
          hypre_GpuProfilingPopRange();
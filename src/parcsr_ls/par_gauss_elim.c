@@ -227,100 +227,108 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level];
       hypre_ParVector *u = hypre_ParAMGDataUArray(amg_data)[level];
       HYPRE_Real *b_vec  = hypre_ParAMGDataBVec(amg_data);
-      HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
-      HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+      HYPRE_Real *f_base = hypre_VectorData(hypre_ParVectorLocalVector(f));
+      HYPRE_Real *u_base = hypre_VectorData(hypre_ParVectorLocalVector(u));
+      HYPRE_Int num_vectors = hypre_ParVectorNumVectors(u);
       HYPRE_Int *comm_info = hypre_ParAMGDataCommInfo(amg_data);
       HYPRE_Int *displs, *info;
       HYPRE_Int n_global = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
       HYPRE_Int new_num_procs;
       HYPRE_Int first_row_index = (HYPRE_Int) hypre_ParCSRMatrixFirstRowIndex(A);
       HYPRE_Int one_i = 1;
+      HYPRE_Int k;
 
       hypre_MPI_Comm_size(new_comm, &new_num_procs);
       info = &comm_info[0];
       displs = &comm_info[new_num_procs];
 
-      HYPRE_Real *f_data_host, *u_data_host;
-
-      if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(f)) != hypre_MEMORY_HOST)
-      {
-         f_data_host = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
-
-         hypre_TMemcpy(f_data_host, f_data, HYPRE_Real, n, HYPRE_MEMORY_HOST,
-                       hypre_ParVectorMemoryLocation(f));
-      }
-      else
-      {
-         f_data_host = f_data;
-      }
-
-      if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(u)) != hypre_MEMORY_HOST)
-      {
-         u_data_host = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
-      }
-      else
-      {
-         u_data_host = u_data;
-      }
-
-      hypre_MPI_Allgatherv (f_data_host, n, HYPRE_MPI_REAL, b_vec, info,
-                            displs, HYPRE_MPI_REAL, new_comm);
-
-      if (f_data_host != f_data)
+      /* Multicomponent vectors are solved one component at a time */
+      for (k = 0; k < num_vectors; k++)
       {
-         hypre_TFree(f_data_host, HYPRE_MEMORY_HOST);
-      }
+         HYPRE_Real *f_data = f_base + k * hypre_VectorVectorStride(hypre_ParVectorLocalVector(f));
+         HYPRE_Real *u_data = u_base + k * hypre_VectorVectorStride(hypre_ParVectorLocalVector(u));
+         HYPRE_Real *f_data_host, *u_data_host;
 
-      if (relax_type == 9 || relax_type == 99)
-      {
-         HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
-         HYPRE_Real *A_tmp;
-         HYPRE_Int   i, my_info;
+         if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(f)) != hypre_MEMORY_HOST)
+         {
+            f_data_host = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
 
-         A_tmp = hypre_CTAlloc(HYPRE_Real, n_global * n_global, HYPRE_MEMORY_HOST);
-         for (i = 0; i < n_global * n_global; i++)
+            hypre_TMemcpy(f_data_host, f_data, HYPRE_Real, n, HYPRE_MEMORY_HOST,
+                          hypre_ParVectorMemoryLocation(f));
+         }
+         else
          {
-            A_tmp[i] = A_mat[i];
+            f_data_host = f_data;
          }
 
-         if (relax_type == 9)
+         if (hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(u)) != hypre_MEMORY_HOST)
          {
-            hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+            u_data_host = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
          }
-         else if (relax_type == 99) /* use pivoting */
+         else
          {
-            HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
-
-            /* write over A with LU */
-            hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+            u_data_host = u_data;
+         }
 
-            /* now b_vec = inv(A)*b_vec */
-            hypre_dgetrs("N", &n_global, &one_i, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
+         hypre_MPI_Allgatherv (f_data_host, n, HYPRE_MPI_REAL, b_vec, info,
+                               displs, HYPRE_MPI_REAL, new_comm);
 
-            hypre_TFree(piv, HYPRE_MEMORY_HOST);
+         if (f_data_host != f_data)
+         {
+            hypre_TFree(f_data_host, HYPRE_MEMORY_HOST);
          }
 
-         for (i = 0; i < n; i++)
+         if (relax_type == 9 || relax_type == 99)
          {
-            u_data_host[i] = b_vec[first_row_index + i];
-         }
+            HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
+            HYPRE_Real *A_tmp;
+            HYPRE_Int   i, my_info;
 
-         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
-      }
-      else if (relax_type == 199)
-      {
-         HYPRE_Real *Ainv = hypre_ParAMGDataAInv(amg_data);
+            A_tmp = hypre_CTAlloc(HYPRE_Real, n_global * n_global, HYPRE_MEMORY_HOST);
+            for (i = 0; i < n_global * n_global; i++)
+            {
+               A_tmp[i] = A_mat[i];
+            }
 
-         char cN = 'N';
-         HYPRE_Real one = 1.0, zero = 0.0;
-         hypre_dgemv(&cN, &n, &n_global, &one, Ainv, &n, b_vec, &one_i, &zero, u_data_host, &one_i);
-      }
+            if (relax_type == 9)
+            {
+               hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+            }
+            else if (relax_type == 99) /* use pivoting */
+            {
+               HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
 
-      if (u_data_host != u_data)
-      {
-         hypre_TMemcpy(u_data, u_data_host, HYPRE_Real, n, hypre_ParVectorMemoryLocation(u),
-                       HYPRE_MEMORY_HOST);
-         hypre_TFree(u_data_host, HYPRE_MEMORY_HOST);
+               /* write over A with LU */
+               hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+
+               /* now b_vec = inv(A)*b_vec */
+               hypre_dgetrs("N", &n_global, &one_i, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
+
+               hypre_TFree(piv, HYPRE_MEMORY_HOST);
+            }
+
+            for (i = 0; i < n; i++)
+            {
+               u_data_host[i] = b_vec[first_row_index + i];
+            }
+
+            hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
+         }
+         else if (relax_type == 199)
+         {
+            HYPRE_Real *Ainv = hypre_ParAMGDataAInv(amg_data);
+
+            char cN = 'N';
+            HYPRE_Real one = 1.0, zero = 0.0;
+            hypre_dgemv(&cN, &n, &n_global, &one, Ainv, &n, b_vec, &one_i, &zero, u_data_host, &one_i);
+         }
+
+         if (u_data_host != u_data)
+         {
+            hypre_TMemcpy(u_data, u_data_host, HYPRE_Real, n, hypre_ParVectorMemoryLocation(u),
+                          HYPRE_MEMORY_HOST);
+            hypre_TFree(u_data_host, HYPRE_MEMORY_HOST);
+         }
       }
    }
 
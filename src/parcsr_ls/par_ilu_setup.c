@@ -129,6 +129,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    /* ----- begin -----*/
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_GpuProfilingPushRange("hypre_ILUSetup");
+   hypre_ProfileBegin(HYPRE_PROFILE_ILU, 0, HYPRE_PROFILE_SETUP);
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -268,6 +269,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    }
 
    /* Factorization */
+   hypre_ProfileBegin(HYPRE_PROFILE_ILU, 0, HYPRE_PROFILE_FACTOR);
    switch (ilu_type)
    {
       case 0:
@@ -511,6 +513,8 @@ hypre_ILUSetup( void               *ilu_vdata,
          break;
    }
 
+   hypre_ProfileEnd();
+
    /* Create additional temporary vector for iterative triangular solve */
    if (!tri_solve)
    {
@@ -609,6 +613,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                {
                   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Schur complement got bad precond!");
                   hypre_GpuProfilingPopRange();
+                  hypre_ProfileEnd();
                   HYPRE_ANNOTATE_FUNC_END;
 
                   return hypre_error_flag;
@@ -684,6 +689,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                {
                   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Schur complement got bad precond!");
                   hypre_GpuProfilingPopRange();
+                  hypre_ProfileEnd();
                   HYPRE_ANNOTATE_FUNC_END;
 
                   return hypre_error_flag;
@@ -821,6 +827,7 @@ hypre_ILUSetup( void               *ilu_vdata,
             {
                hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Schur complement got bad precond!");
                hypre_GpuProfilingPopRange();
+               hypre_ProfileEnd();
                HYPRE_ANNOTATE_FUNC_END;
 
                return hypre_error_flag;
@@ -931,6 +938,7 @@ hypre_ILUSetup( void               *ilu_vdata,
             {
                hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Schur complement got bad precond!");
                hypre_GpuProfilingPopRange();
+               hypre_ProfileEnd();
                HYPRE_ANNOTATE_FUNC_END;
 
                return hypre_error_flag;
@@ -1054,6 +1062,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                {
                   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Schur complement got bad precond!");
                   hypre_GpuProfilingPopRange();
+                  hypre_ProfileEnd();
                   HYPRE_ANNOTATE_FUNC_END;
 
                   return hypre_error_flag;
@@ -1255,6 +1264,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParILUDataRelResNorms(ilu_data) = rel_res_norms;
 
    hypre_GpuProfilingPopRange();
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
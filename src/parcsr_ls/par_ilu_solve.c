@@ -112,6 +112,7 @@ hypre_ILUSolve( void               *ilu_vdata,
 #endif
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_ILU, 0, HYPRE_PROFILE_SOLVE);
 
    if (logging > 1)
    {
@@ -193,6 +194,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -213,6 +215,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             rel_resnorm = 0.0;
             hypre_ParILUDataFinalRelResidualNorm(ilu_data) = rel_resnorm;
          }
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -243,6 +246,7 @@ hypre_ILUSolve( void               *ilu_vdata,
           (iter < max_iter))
    {
       /* Do one solve on LU*e = r */
+      hypre_ProfileBegin(HYPRE_PROFILE_ILU, 0, HYPRE_PROFILE_TRISOLVE);
       switch (ilu_type)
       {
       case 0: case 1: default:
@@ -379,6 +383,7 @@ hypre_ILUSolve( void               *ilu_vdata,
             }
             break;
       }
+      hypre_ProfileEnd();
 
       /*---------------------------------------------------------------
        *    Compute residual and residual norm
@@ -471,6 +476,7 @@ hypre_ILUSolve( void               *ilu_vdata,
       }
    }
 
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -886,6 +892,9 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A,
       /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
       utemp_data[perm[i]] *= D[i];
    }
+   /* the triangular solves stream L and U once */
+   hypre_ProfileAddSpMV((HYPRE_Real) (L_diag_i[nLU] + U_diag_i[nLU]), (HYPRE_Real) nLU,
+                        (HYPRE_Real) nLU, 1);
 
    /* Update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
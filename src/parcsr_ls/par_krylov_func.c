@@ -179,6 +179,127 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovResidualNorm2Begin
+ *
+ * r = b - A*x, and starts the reduction of <r,r> into r_norm2.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovResidualNorm2Begin( void              *A,
+                                   void              *x,
+                                   void              *b,
+                                   void              *r,
+                                   HYPRE_Real        *r_norm2,
+                                   hypre_MPI_Request *request )
+{
+   return ( hypre_ParCSRMatrixMatvecNorm2Begin( -1.0, (hypre_ParCSRMatrix *) A,
+                                                (hypre_ParVector *) x, 1.0,
+                                                (hypre_ParVector *) b,
+                                                (hypre_ParVector *) r,
+                                                r_norm2, request ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovResidualNorm2End
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovResidualNorm2End( hypre_MPI_Request *request )
+{
+   return ( hypre_ParCSRMatrixMatvecNorm2End( request ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdBegin
+ *
+ * Computes the local parts of <x[k],y[k]>, k < n, and starts their global
+ * reduction into result. Completed by hypre_ParKrylovInnerProdEnd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdBegin( HYPRE_Int          n,
+                               void             **x,
+                               void             **y,
+                               HYPRE_Real        *result,
+                               hypre_MPI_Request *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm((hypre_ParVector *) x[0]);
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x[k]),
+                                           hypre_ParVectorLocalVector((hypre_ParVector *) y[k]));
+   }
+
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdEnd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdEnd( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovNumVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovNumVectors( void *x )
+{
+   return ( hypre_ParVectorNumVectors( (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovComponentInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovComponentInnerProd( void       *x,
+                                   void       *y,
+                                   HYPRE_Real *result )
+{
+   return ( hypre_ParVectorComponentInnerProd( (hypre_ParVector *) x,
+                                               (hypre_ParVector *) y, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovComponentAxpy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovComponentAxpy( HYPRE_Complex *alpha,
+                              void          *x,
+                              void          *y )
+{
+   return ( hypre_ParVectorComponentAxpy( alpha, (hypre_ParVector *) x,
+                                          (hypre_ParVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovComponentScale
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovComponentScale( HYPRE_Complex *alpha,
+                               void          *x )
+{
+   return ( hypre_ParVectorComponentScale( alpha, (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -202,6 +323,17 @@ hypre_ParKrylovMassDotpTwo( void *x, void *y,
                                         unroll, (HYPRE_Real *)result_x, (HYPRE_Real *)result_y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( void **x, HYPRE_Int nx,
+                               void **y, HYPRE_Int ny, HYPRE_Int unroll, void *result )
+{
+   return ( hypre_ParVectorBlockInnerProd( (hypre_ParVector **) x, nx, (hypre_ParVector **) y, ny,
+                                           unroll, (HYPRE_Real *) result ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -4270,7 +4270,9 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    //   HYPRE_Int num_threads = hypre_NumThreads();
 
-   res = hypre_CTAlloc(HYPRE_Real,  blk_size, HYPRE_MEMORY_HOST);
+   /* Gauss-Seidel works block by block, Jacobi on all blocks at once */
+   res = hypre_CTAlloc(HYPRE_Real, (method == 1) ? blk_size : n_block * blk_size,
+                       HYPRE_MEMORY_HOST);
 
    if (!comm_pkg)
    {
@@ -4328,56 +4330,60 @@ hypre_MGRBlockRelaxSolve( hypre_ParCSRMatrix *A,
    }
 
    /*-----------------------------------------------------------------
-   * Relax points block by block
+   * Relax points block by block.  For Jacobi, the residual of all blocks
+   * is formed first and the inverted blocks are applied in one batch.
    *-----------------------------------------------------------------*/
-   for (i = 0; i < n_block; i++)
+   if (method == 1)
    {
-      bidxm1 = i * blk_size;
-      for (j = 0; j < blk_size; j++)
+      for (i = 0; i < n_block; i++)
       {
-         bidx = bidxm1 + j;
-         res[j] = f_data[bidx];
-         for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
+         bidxm1 = i * blk_size;
+         for (j = 0; j < blk_size; j++)
          {
-            ii = A_diag_j[jj];
-            if (method == 0)
-            {
-               // Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
-            }
-            else if (method == 1)
+            bidx = bidxm1 + j;
+            res[j] = f_data[bidx];
+            for (jj = A_diag_i[bidx]; jj < A_diag_i[bidx + 1]; jj++)
             {
                // Gauss-Seidel for diagonal part
+               ii = A_diag_j[jj];
                res[j] -= A_diag_data[jj] * u_data[ii];
             }
-            else
+            for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
             {
-               // Default do Jacobi for diagonal part
-               res[j] -= A_diag_data[jj] * Vtemp_data[ii];
+               // always do Jacobi for off-diagonal part
+               ii = A_offd_j[jj];
+               res[j] -= A_offd_data[jj] * Vext_data[ii];
             }
-            //printf("%d: Au= %e * %e =%e\n",ii,A_diag_data[jj],Vtemp_data[ii], res[j]);
          }
-         for (jj = A_offd_i[bidx]; jj < A_offd_i[bidx + 1]; jj++)
+
+         hypre_BdiagInvMatvec(1, blk_size, 1.0, &diaginv[i * nb2], res, 1.0, &u_data[bidxm1]);
+      }
+   }
+   else
+   {
+      // Default do Jacobi for diagonal part
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i,ii,jj) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_block * blk_size; i++)
+      {
+         res[i] = f_data[i];
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res[i] -= A_diag_data[jj] * Vtemp_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
          {
             // always do Jacobi for off-diagonal part
             ii = A_offd_j[jj];
-            res[j] -= A_offd_data[jj] * Vext_data[ii];
+            res[i] -= A_offd_data[jj] * Vext_data[ii];
          }
-         //printf("%d: res = %e\n",bidx,res[j]);
       }
 
-      for (j = 0; j < blk_size; j++)
-      {
-         bidx1 = bidxm1 + j;
-         for (k = 0; k < blk_size; k++)
-         {
-            bidx  = i * nb2 + j * blk_size + k;
-            u_data[bidx1] += res[k] * diaginv[bidx];
-            //printf("u[%d] = %e, diaginv[%d] = %e\n",bidx1,u_data[bidx1],bidx,diaginv[bidx]);
-         }
-         //printf("u[%d] = %e\n",bidx1,u_data[bidx1]);
-      }
+      hypre_BdiagInvMatvec(n_block, blk_size, 1.0, diaginv, res, 1.0, u_data);
    }
+
    if (num_procs > 1)
    {
       hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
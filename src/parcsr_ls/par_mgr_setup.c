@@ -152,6 +152,7 @@ hypre_MGRSetup( void               *mgr_vdata,
    /* ----- begin -----*/
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_GpuProfilingPushRange("MGRSetup");
+   hypre_ProfileBegin(HYPRE_PROFILE_MGR, 0, HYPRE_PROFILE_SETUP);
    hypre_GpuProfilingPushRange("MGRSetup-Init");
 
    block_size = (mgr_data -> block_size);
@@ -219,6 +220,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       cgrid_solver_setup((mgr_data -> coarse_grid_solver), A, f, u);
       (mgr_data -> num_coarse_levels) = 0;
 
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
       hypre_GpuProfilingPopRange();
 
@@ -1017,6 +1019,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_sprintf(region_name, "Global-Relax");
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+      hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_SMOOTHER_SETUP);
       if (level_smooth_iters[lev] > 0)
       {
          /* TODO (VPM): Change option types for block-Jacobi and block-GS to 30 and 31 and
@@ -1078,6 +1081,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          }
       }
       hypre_GpuProfilingPopRange();
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_REGION_END("%s", region_name);
 #if MGR_DEBUG_LEVEL == 2
       wall_time = time_getWallclockSeconds() - wall_time;
@@ -1090,6 +1094,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_sprintf(region_name, "Coarsen");
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+      hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_COARSEN);
       cflag = last_level || setNonCpointToF;
       if (interp_type[lev] == 3 || interp_type[lev] == 5 ||
           interp_type[lev] == 6 || interp_type[lev] == 7 || !cflag)
@@ -1117,6 +1122,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_MGRCoarseParms(comm, nloc, CF_marker_array[lev],
                            coarse_pnts_global, row_starts_fpts);
       hypre_GpuProfilingPopRange();
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
       /* Compute Petrov-Galerkin operators */
@@ -1156,6 +1162,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_sprintf(region_name, "Interp");
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+      hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_INTERP);
       if (interp_type[lev] == 12)
       {
          if (mgr_coarse_grid_method[lev] != 0)
@@ -1178,6 +1185,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                               num_interp_sweeps);
       }
       hypre_GpuProfilingPopRange();
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_REGION_END("%s", region_name);
 #if MGR_DEBUG_LEVEL == 2
       wall_time = time_getWallclockSeconds() - wall_time;
@@ -1195,6 +1203,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       hypre_sprintf(region_name, "F-Relax");
       hypre_GpuProfilingPushRange(region_name);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+      hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_SMOOTHER_SETUP);
 
       if (interp_type[lev] == 12 && (mgr_data -> num_relax_sweeps)[lev] > 0)
       {
@@ -1247,6 +1256,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          hypre_ParVectorInitialize(U_fine_array[lev + 1]);
       }
       hypre_GpuProfilingPopRange();
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
       P_array[lev] = P;
@@ -1273,6 +1283,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          hypre_sprintf(region_name, "Restrict");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_INTERP);
 
          /* for AIR, need absolute value SOC */
          hypre_BoomerAMGCreateSabs(A_array[lev], strong_threshold, 1.0, 1, NULL, &ST);
@@ -1302,6 +1313,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          }
          RT_array[lev] = RT;
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
          /* Use two matrix products to generate A_H */
@@ -1310,6 +1322,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          hypre_sprintf(region_name, "RAP");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_RAP);
          AP      = hypre_ParMatmul(A_array[lev], P_array[lev]);
          RAP_ptr = hypre_ParMatmul(RT, AP);
          if (num_procs > 1)
@@ -1320,6 +1333,7 @@ hypre_MGRSetup( void               *mgr_vdata,
          /* Delete AP */
          hypre_ParCSRMatrixDestroy(AP);
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
       }
       else
@@ -1331,6 +1345,7 @@ hypre_MGRSetup( void               *mgr_vdata,
             hypre_sprintf(region_name, "Restrict");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_INTERP);
             if (block_num_f_points == 1 && restrict_type[lev] == 12)
             {
                restrict_type[lev] = 2;
@@ -1345,6 +1360,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                RT_array[lev] = RT;
             }
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
 #if MGR_DEBUG_LEVEL == 2
@@ -1354,6 +1370,7 @@ hypre_MGRSetup( void               *mgr_vdata,
             hypre_sprintf(region_name, "RAP");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_RAP);
 
 #if defined (HYPRE_USING_GPU)
             if (exec == HYPRE_EXEC_DEVICE)
@@ -1389,6 +1406,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                Wp = NULL;
             }
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
 #if MGR_DEBUG_LEVEL == 2
@@ -1405,6 +1423,7 @@ hypre_MGRSetup( void               *mgr_vdata,
             hypre_sprintf(region_name, "Restrict");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_INTERP);
             if (block_jacobi_bsize == 1 && restrict_type[lev] == 12)
             {
                restrict_type[lev] = 2;
@@ -1417,6 +1436,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                                    num_restrict_sweeps);
             RT_array[lev] = RT;
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
 #if MGR_DEBUG_LEVEL == 2
@@ -1429,8 +1449,10 @@ hypre_MGRSetup( void               *mgr_vdata,
             hypre_sprintf(region_name, "RAP");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, lev, HYPRE_PROFILE_RAP);
             RAP_ptr = hypre_ParCSRMatrixRAPKT(RT, A_array[lev], P, 1);
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
 #if MGR_DEBUG_LEVEL == 2
@@ -1490,6 +1512,7 @@ hypre_MGRSetup( void               *mgr_vdata,
                   {
                      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
                                        "F-relaxation solver has not been setup\n");
+                     hypre_ProfileEnd();
                      HYPRE_ANNOTATE_FUNC_END;
                      hypre_GpuProfilingPopRange();
 
@@ -1784,9 +1807,11 @@ hypre_MGRSetup( void               *mgr_vdata,
    hypre_GpuProfilingPushRange(region_name);
    HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
 
+   hypre_ProfileBegin(HYPRE_PROFILE_MGR, num_c_levels, HYPRE_PROFILE_COARSE_SETUP);
    cgrid_solver_setup((mgr_data -> coarse_grid_solver),
                       RAP_ptr, F_array[num_c_levels],
                       U_array[num_c_levels]);
+   hypre_ProfileEnd();
 
    hypre_GpuProfilingPopRange();
    HYPRE_ANNOTATE_REGION_END("%s", region_name);
@@ -1913,6 +1938,7 @@ hypre_MGRSetup( void               *mgr_vdata,
       (mgr_data -> num_coarse_per_level) = NULL;
    }
 
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
    hypre_GpuProfilingPopRange();
 
@@ -65,6 +65,7 @@ hypre_MGRSolve( void               *mgr_vdata,
                                                     void*) = (mgr_data -> coarse_grid_solver_solve);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
+   hypre_ProfileBegin(HYPRE_PROFILE_MGR, 0, HYPRE_PROFILE_SOLVE);
    if (logging > 1)
    {
       residual = (mgr_data -> residual);
@@ -80,6 +81,7 @@ hypre_MGRSolve( void               *mgr_vdata,
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(cg_solver, &rel_resnorm);
       (mgr_data -> num_iterations) = iter;
       (mgr_data -> final_rel_residual_norm) = rel_resnorm;
+      hypre_ProfileEnd();
       HYPRE_ANNOTATE_FUNC_END;
 
       return hypre_error_flag;
@@ -166,6 +168,7 @@ hypre_MGRSolve( void               *mgr_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -186,6 +189,7 @@ hypre_MGRSolve( void               *mgr_vdata,
             rel_resnorm = fp_zero;
             (mgr_data -> final_rel_residual_norm) = rel_resnorm;
          }
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -289,6 +293,7 @@ hypre_MGRSolve( void               *mgr_vdata,
          //         hypre_printf("                   cycle = %f\n\n\n\n",cycle_cmplxty);
       }
    }
+   hypre_ProfileEnd();
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -640,7 +645,9 @@ hypre_MGRCycle( void              *mgr_vdata,
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
 
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, level, HYPRE_PROFILE_COARSE_SOLVE);
          coarse_grid_solver_solve(cg_solver, RAP, F_array[level], U_array[level]);
+         hypre_ProfileEnd();
          if (use_default_cgrid_solver)
          {
             HYPRE_Real convergence_factor_cg;
@@ -702,6 +709,7 @@ hypre_MGRCycle( void              *mgr_vdata,
             hypre_sprintf(region_name, "Global-Relax");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_RELAX);
 
             if ((level_smooth_type[fine_grid]) == 0 ||
                 (level_smooth_type[fine_grid]) == 1)
@@ -795,6 +803,7 @@ hypre_MGRCycle( void              *mgr_vdata,
             }
 
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
          } /* End global pre-smoothing */
 
@@ -803,6 +812,7 @@ hypre_MGRCycle( void              *mgr_vdata,
          hypre_sprintf(region_name, "F-Relax");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_RELAX);
 
          if (Frelax_type[fine_grid] == 0)
          {
@@ -937,6 +947,7 @@ hypre_MGRCycle( void              *mgr_vdata,
                   /* rhs is zero, return a zero solution */
                   hypre_ParVectorSetZeros(U_array[0]);
 
+                  hypre_ProfileEnd();
                   HYPRE_ANNOTATE_FUNC_END;
                   hypre_GpuProfilingPopRange();
 
@@ -1058,18 +1069,21 @@ hypre_MGRCycle( void              *mgr_vdata,
          }
 
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
          /* Update residual and compute coarse-grid rhs */
          hypre_sprintf(region_name, "Residual");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_RESIDUAL);
 
          hypre_ParCSRMatrixMatvecOutOfPlace(fp_neg_one, A_array[fine_grid],
                                             U_array[fine_grid], fp_one,
                                             F_array[fine_grid], Vtemp);
 
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
          if ((restrict_type[fine_grid] == 4) ||
@@ -1081,6 +1095,7 @@ hypre_MGRCycle( void              *mgr_vdata,
          hypre_sprintf(region_name, "Restrict");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_RESTRICT);
          if (use_air)
          {
             /* no transpose necessary for R */
@@ -1105,6 +1120,7 @@ hypre_MGRCycle( void              *mgr_vdata,
             }
          }
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
          hypre_sprintf(region_name, "%s-%d", "MGR_Level", fine_grid);
@@ -1143,6 +1159,7 @@ hypre_MGRCycle( void              *mgr_vdata,
          hypre_sprintf(region_name, "Prolongate");
          hypre_GpuProfilingPushRange(region_name);
          HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+         hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_INTERP_APPLY);
 
 #if defined(HYPRE_USING_GPU)
          if (interp_type[fine_grid] > 0 || (exec == HYPRE_EXEC_DEVICE))
@@ -1162,6 +1179,7 @@ hypre_MGRCycle( void              *mgr_vdata,
          }
 
          hypre_GpuProfilingPopRange();
+         hypre_ProfileEnd();
          HYPRE_ANNOTATE_REGION_END("%s", region_name);
 
          /* Global post smoothing sweeps */
@@ -1170,6 +1188,7 @@ hypre_MGRCycle( void              *mgr_vdata,
             hypre_sprintf(region_name, "Global-Relax");
             hypre_GpuProfilingPushRange(region_name);
             HYPRE_ANNOTATE_REGION_BEGIN("%s", region_name);
+            hypre_ProfileBegin(HYPRE_PROFILE_MGR, fine_grid, HYPRE_PROFILE_RELAX);
 
             /* Block Jacobi smoother */
             if ((level_smooth_type[fine_grid] == 0) ||
@@ -1258,6 +1277,7 @@ hypre_MGRCycle( void              *mgr_vdata,
             }
 
             hypre_GpuProfilingPopRange();
+            hypre_ProfileEnd();
             HYPRE_ANNOTATE_REGION_END("%s", region_name);
          } /* End post-smoothing */
 
@@ -33,7 +33,31 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                       hypre_ParVector    *Vtemp,
                       hypre_ParVector    *Ztemp )
 {
-   HYPRE_Int relax_error = 0;
+   hypre_ParCSRCommPkg *comm_pkg    = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_vectors = hypre_ParVectorNumVectors(u);
+   HYPRE_Int            relax_error = 0;
+
+   /*---------------------------------------------------------------------------------------
+    * Multicomponent vectors: the hybrid Gauss-Seidel variants and (L1-)Jacobi relax all
+    * components with a single pass over A. Other smoothers relax one component at a time.
+    *-------------------------------------------------------------------------------------*/
+   if (num_vectors > 1)
+   {
+      switch (relax_type)
+      {
+         case 3: case 4: case 6: case 7: case 8: case 13: case 14: case 18:
+            break;
+
+         default:
+            return hypre_BoomerAMGRelaxComponents(A, f, cf_marker, relax_type, relax_points,
+                                                  relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+      }
+   }
+   else if (comm_pkg)
+   {
+      /* The communication package may still be set up for multicomponent vectors */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
+   }
 
    /*---------------------------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
@@ -69,6 +93,9 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 19 -> Direct Solve, (old version)
     *     relax_type = 20 -> Kaczmarz
     *     relax_type = 21 -> the same as 8 except forcing serialization on CPU (#OMP-thread = 1)
+    *     relax_type = 24 -> hybrid: SOR-J mix off-processor, multicolor SOR on-processor
+    *                        (colors in parallel, independent of the number of threads)
+    *     relax_type = 25 -> hybrid: SSOR-J mix off-processor, multicolor SSOR on-processor
     *     relax_type = 29 -> Direct solve: use Gaussian elimination & BLAS
     *                        (with pivoting) (old version)
     *     relax_type = 98 -> Direct solve, Gaussian elimination
@@ -170,11 +197,108 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 24: /* Multicolor hybrid Gauss-Seidel */
+         hypre_BoomerAMGRelax24MulticolorGaussSeidel(A, f, cf_marker, relax_points,
+                                                     relax_weight, omega, NULL, NULL,
+                                                     u, Vtemp);
+         break;
+
+      case 25: /* Multicolor hybrid symmetric Gauss-Seidel */
+         hypre_BoomerAMGRelax25MulticolorSSOR(A, f, cf_marker, relax_points,
+                                              relax_weight, omega, NULL, NULL,
+                                              u, Vtemp);
+         break;
+
       case 98: /* Direct solve: use gaussian elimination & BLAS (with pivoting) */
          relax_error = hypre_BoomerAMGRelax98GaussElimPivot(A, f, u);
          break;
    }
 
+   /* Profiler work estimate: one pass over A per sweep, two for the symmetric
+      variants. Jacobi (7) and two-stage Gauss-Seidel (11, 12) are charged by
+      their matvecs, direct solves are not estimated */
+   if (relax_type != 7 && relax_type != 11 && relax_type != 12 &&
+       relax_type != 19 && relax_type != 98)
+   {
+      hypre_ParCSRMatrixProfileSpMV(A, num_vectors,
+                                    (relax_type == 6 || relax_type == 8 || relax_type == 25) ? 2 : 1);
+   }
+
+   hypre_ParVectorAllZeros(u) = 0;
+
+   return relax_error;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxComponents
+ *
+ * Relaxes each component of the multicomponent vector u separately, using
+ * single-component views of f, u and the temporary vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxComponents( hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *f,
+                                HYPRE_Int          *cf_marker,
+                                HYPRE_Int           relax_type,
+                                HYPRE_Int           relax_points,
+                                HYPRE_Real          relax_weight,
+                                HYPRE_Real          omega,
+                                HYPRE_Real         *l1_norms,
+                                hypre_ParVector    *u,
+                                hypre_ParVector    *Vtemp,
+                                hypre_ParVector    *Ztemp )
+{
+   hypre_ParVector  *vecs[4] = {f, u, Vtemp, Ztemp};
+   hypre_ParVector   par_views[4];
+   hypre_Vector      views[4];
+   HYPRE_Int         num_vectors = hypre_ParVectorNumVectors(u);
+   HYPRE_Int         all_zeros   = hypre_ParVectorAllZeros(u);
+   HYPRE_Int         relax_error = 0;
+   HYPRE_Int         i, k;
+
+   for (i = 0; i < 4; i++)
+   {
+      if (vecs[i])
+      {
+         if (hypre_ParVectorNumVectors(vecs[i]) != num_vectors)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Mismatching number of components in relaxation");
+            return hypre_error_flag;
+         }
+
+         par_views[i] = *vecs[i];
+         views[i]     = *hypre_ParVectorLocalVector(vecs[i]);
+         hypre_VectorNumVectors(&views[i]) = 1;
+         hypre_VectorOwnsData(&views[i])   = 0;
+         hypre_ParVectorLocalVector(&par_views[i]) = &views[i];
+         hypre_ParVectorOwnsData(&par_views[i])    = 0;
+      }
+   }
+
+   for (k = 0; k < num_vectors; k++)
+   {
+      for (i = 0; i < 4; i++)
+      {
+         if (vecs[i])
+         {
+            hypre_VectorData(&views[i]) = hypre_VectorData(hypre_ParVectorLocalVector(vecs[i])) +
+                                          k * hypre_VectorVectorStride(hypre_ParVectorLocalVector(vecs[i]));
+         }
+      }
+      hypre_ParVectorAllZeros(&par_views[1]) = all_zeros;
+
+      relax_error = hypre_BoomerAMGRelax(A, &par_views[0], cf_marker, relax_type, relax_points,
+                                         relax_weight, omega, l1_norms, &par_views[1],
+                                         vecs[2] ? &par_views[2] : NULL,
+                                         vecs[3] ? &par_views[3] : NULL);
+      if (relax_error)
+      {
+         break;
+      }
+   }
+
    hypre_ParVectorAllZeros(u) = 0;
 
    return relax_error;
@@ -351,8 +475,8 @@ hypre_BoomerAMGRelax18WeightedL1Jacobi( hypre_ParCSRMatrix *A,
    else
 #endif
    {
-      /* in the case of non-CF, use relax-7 which is faster */
-      if (relax_points == 0)
+      /* in the case of non-CF or multicomponent vectors, use relax-7 which is faster */
+      if (relax_points == 0 || hypre_ParVectorNumVectors(f) > 1)
       {
          return hypre_BoomerAMGRelax7Jacobi(A, f, cf_marker, relax_points, relax_weight, l1_norms, u, Vtemp);
       }
@@ -693,6 +817,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
    hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
    HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
    hypre_Vector        *Vtemp_local   = Vtemp ? hypre_ParVectorLocalVector(Vtemp) : NULL;
    HYPRE_Complex       *Vtemp_data    = Vtemp_local ? hypre_VectorData(Vtemp_local) : NULL;
    /*
@@ -706,23 +832,24 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
    // JSP: persistent comm can be similarly used for other smoothers
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#else
-   hypre_ParCSRCommHandle           *comm_handle;
+   HYPRE_Int                         persistent = hypre_HandleParCSRPersistentComm(hypre_handle());
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
    HYPRE_Int                         num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-#endif
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
    /* Sanity check */
-   if (hypre_ParVectorNumVectors(f) > 1)
+   if (num_vectors > 1 &&
+       (Topo_order || hypre_VectorNumVectors(f_local) != num_vectors ||
+        hypre_VectorVectorStride(f_local) != vecstride ||
+        (Vtemp_local && hypre_VectorVectorStride(Vtemp_local) != vecstride)))
    {
       hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                        "Hybrid GS relaxation doesn't support multicomponent vectors");
+                        "Unsupported multicomponent vectors in hybrid GS relaxation");
       return hypre_error_flag;
    }
 
@@ -755,17 +882,23 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
 
+      /* Match the send map to the number of vectors of u */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, u);
+
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-      v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-      v_ext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-      v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                 HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+      if (persistent)
+      {
+         persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+         v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         v_ext_data = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      }
+      else
+      {
+         v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                    HYPRE_MEMORY_HOST);
+         v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+      }
 
       HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
       HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
@@ -782,17 +915,16 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
-#endif
-
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
-#else
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+      if (persistent)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
 
 #ifdef HYPRE_PROFILE
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -831,11 +963,43 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 #endif
       for (j = 0; j < num_rows; j++)
       {
-         Vtemp_data[j] = u_data[j];
+         HYPRE_Int k;
+         for (k = 0; k < num_vectors; k++)
+         {
+            Vtemp_data[j + k * vecstride] = u_data[j + k * vecstride];
+         }
       }
    }
 
-   if (num_threads > 1)
+   if (num_vectors > 1)
+   {
+      /* All vectors are relaxed together, reading A once per sweep */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_threads; j++)
+      {
+         HYPRE_Complex *res = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors, HYPRE_MEMORY_HOST);
+         HYPRE_Int ns, ne, sweep;
+         hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+         for (sweep = 0; sweep < num_sweeps; sweep++)
+         {
+            const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+            const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+            const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
+
+            hypre_HybridGaussSeidelMulti(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                         f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                         one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                         num_vectors, vecstride, ns, ne, ibegin, iend, iorder, Skip_diag,
+                                         res);
+         }
+
+         hypre_TFree(res, HYPRE_MEMORY_HOST);
+      }
+   }
+   else if (num_threads > 1)
    {
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
@@ -899,13 +1063,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
    } /* if (num_threads > 1) */
 
-#ifndef HYPRE_USING_PERSISTENT_COMM
-   if (num_procs > 1)
+   if (num_procs > 1 && !persistent)
    {
       hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
       hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
    }
-#endif
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
@@ -1271,6 +1433,354 @@ hypre_BoomerAMGRelax14HybridL1GaussSeidel( hypre_ParCSRMatrix *A,
                                         -1, 0, skip_diag, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxComputeColors
+ *
+ * Greedy coloring of the graph of the (symmetrized) diagonal block of A,
+ * visiting the rows in their natural order. Rows of the same color are not
+ * coupled in A_diag, so they can be relaxed concurrently. The coloring does
+ * not depend on the number of threads.
+ *
+ * On return, the rows of color c are color_rows[color_ptr[c]], ...,
+ * color_rows[color_ptr[c + 1] - 1], in increasing order, and the number of
+ * colors is the size of color_ptr minus one.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxComputeColors( hypre_ParCSRMatrix  *A,
+                                   hypre_IntArray     **color_ptr_ptr,
+                                   hypre_IntArray     **color_rows_ptr )
+{
+   hypre_CSRMatrix  *A_diag     = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int        *A_diag_i   = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int        *A_diag_j   = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int         num_rows   = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix  *AT_diag;
+   HYPRE_Int        *AT_diag_i;
+   HYPRE_Int        *AT_diag_j;
+   hypre_IntArray   *color_ptr;
+   hypre_IntArray   *color_rows;
+   HYPRE_Int        *color_ptr_data;
+   HYPRE_Int        *color_rows_data;
+   HYPRE_Int        *color;
+   HYPRE_Int        *color_marker;
+   HYPRE_Int         num_colors = 0;
+   HYPRE_Int         i, j, jj, c;
+
+   /* the pattern of A_diag^T gives the couplings missing from nonsymmetric A */
+   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   color        = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   color_marker = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows + 1; i++)
+   {
+      color_marker[i] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      /* mark the colors of the neighbors already visited */
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         j = A_diag_j[jj];
+         if (j < i)
+         {
+            color_marker[color[j]] = i;
+         }
+      }
+      for (jj = AT_diag_i[i]; jj < AT_diag_i[i + 1]; jj++)
+      {
+         j = AT_diag_j[jj];
+         if (j < i)
+         {
+            color_marker[color[j]] = i;
+         }
+      }
+
+      /* smallest free color */
+      c = 0;
+      while (color_marker[c] == i)
+      {
+         c++;
+      }
+      color[i]   = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* group the rows by color */
+   color_ptr  = hypre_IntArrayCreate(num_colors + 1);
+   color_rows = hypre_IntArrayCreate(num_rows);
+   hypre_IntArrayInitialize_v2(color_ptr, HYPRE_MEMORY_HOST);
+   hypre_IntArrayInitialize_v2(color_rows, HYPRE_MEMORY_HOST);
+   color_ptr_data  = hypre_IntArrayData(color_ptr);
+   color_rows_data = hypre_IntArrayData(color_rows);
+
+   for (c = 0; c < num_colors + 1; c++)
+   {
+      color_ptr_data[c] = 0;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      color_ptr_data[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_ptr_data[c + 1] += color_ptr_data[c];
+      color_marker[c] = color_ptr_data[c];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      color_rows_data[color_marker[color[i]]++] = i;
+   }
+
+   hypre_CSRMatrixDestroy(AT_diag);
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_marker, HYPRE_MEMORY_HOST);
+
+   *color_ptr_ptr  = color_ptr;
+   *color_rows_ptr = color_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel
+ *
+ * Hybrid Gauss-Seidel/SOR (Jacobi off-processor) in which the rows are
+ * visited color by color, and the rows of a color are relaxed in parallel.
+ * With Symm, a forward sweep over the colors is followed by a backward one.
+ * Since the rows of a color are independent, the result does not depend on
+ * the number of threads. If color_ptr is NULL, a coloring is computed and
+ * freed on return.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel( hypre_ParCSRMatrix *A,
+                                                 hypre_ParVector    *f,
+                                                 HYPRE_Int          *cf_marker,
+                                                 HYPRE_Int           relax_points,
+                                                 HYPRE_Real          relax_weight,
+                                                 HYPRE_Real          omega,
+                                                 hypre_IntArray     *color_ptr,
+                                                 hypre_IntArray     *color_rows,
+                                                 hypre_ParVector    *u,
+                                                 hypre_ParVector    *Vtemp,
+                                                 HYPRE_Int           Symm )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *v_tmp_data    = NULL;
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_IntArray      *local_color_ptr  = NULL;
+   hypre_IntArray      *local_color_rows = NULL;
+   HYPRE_Int           *color_ptr_data;
+   HYPRE_Int           *color_rows_data;
+   HYPRE_Int            num_colors, num_procs, num_sends;
+   HYPRE_Int            sweep, k, c, i, ii, jj, begin, end;
+
+   /* non-scaled update if relax_weight and omega are both 1.0 */
+   const HYPRE_Int      non_scale       = relax_weight == 1.0 && omega == 1.0;
+   const HYPRE_Real     one_minus_omega = 1.0 - omega;
+   const HYPRE_Real     prod            = 1.0 - relax_weight * omega;
+   const HYPRE_Complex  zero            = 0.0;
+
+   /* Sanity check */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multicolor GS relaxation doesn't support multicomponent vectors");
+      return hypre_error_flag;
+   }
+
+   if (!non_scale && !Vtemp)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multicolor SOR relaxation needs a temporary vector");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (!color_ptr || !color_rows)
+   {
+      hypre_BoomerAMGRelaxComputeColors(A, &local_color_ptr, &local_color_rows);
+      color_ptr  = local_color_ptr;
+      color_rows = local_color_rows;
+   }
+   num_colors      = hypre_IntArraySize(color_ptr) - 1;
+   color_ptr_data  = hypre_IntArrayData(color_ptr);
+   color_rows_data = hypre_IntArrayData(color_rows);
+
+   /*-----------------------------------------------------------------
+    * Exchange the off-processor values of u (these are kept fixed)
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_CTAlloc(HYPRE_Complex, end, HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i - begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /* the SOR update also needs the values of u before the sweeps */
+   if (!non_scale)
+   {
+      v_tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         v_tmp_data[i] = u_data[i];
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax the colors in sequence. Relax only C or F points as
+    * determined by relax_points, and skip rows with a zero diagonal.
+    *-----------------------------------------------------------------*/
+
+   for (sweep = 0; sweep < (Symm ? 2 : 1); sweep++)
+   {
+      for (k = 0; k < num_colors; k++)
+      {
+         c = sweep ? num_colors - 1 - k : k;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ii, i, jj) HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = color_ptr_data[c]; ii < color_ptr_data[c + 1]; ii++)
+         {
+            HYPRE_Complex res, res0, res2, diag;
+
+            i = color_rows_data[ii];
+            diag = A_diag_data[A_diag_i[i]];
+
+            if ((relax_points != 0 && cf_marker[i] != relax_points) || diag == zero)
+            {
+               continue;
+            }
+
+            res  = f_data[i];
+            res0 = 0.0;
+            res2 = 0.0;
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+            }
+
+            if (non_scale)
+            {
+               for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
+               {
+                  res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+               }
+               u_data[i] = res / diag;
+            }
+            else
+            {
+               for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
+               {
+                  res0 -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+                  res2 += A_diag_data[jj] * v_tmp_data[A_diag_j[jj]];
+               }
+               u_data[i] *= prod;
+               u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / diag;
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_IntArrayDestroy(local_color_ptr);
+   hypre_IntArrayDestroy(local_color_rows);
+
+   return hypre_error_flag;
+}
+
+/* forward multicolor hybrid G-S */
+HYPRE_Int
+hypre_BoomerAMGRelax24MulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                             hypre_ParVector    *f,
+                                             HYPRE_Int          *cf_marker,
+                                             HYPRE_Int           relax_points,
+                                             HYPRE_Real          relax_weight,
+                                             HYPRE_Real          omega,
+                                             hypre_IntArray     *color_ptr,
+                                             hypre_IntArray     *color_rows,
+                                             hypre_ParVector    *u,
+                                             hypre_ParVector    *Vtemp )
+{
+   return hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel(A, f, cf_marker, relax_points,
+                                                          relax_weight, omega, color_ptr,
+                                                          color_rows, u, Vtemp, 0);
+}
+
+/* symmetric multicolor hybrid G-S */
+HYPRE_Int
+hypre_BoomerAMGRelax25MulticolorSSOR( hypre_ParCSRMatrix *A,
+                                      hypre_ParVector    *f,
+                                      HYPRE_Int          *cf_marker,
+                                      HYPRE_Int           relax_points,
+                                      HYPRE_Real          relax_weight,
+                                      HYPRE_Real          omega,
+                                      hypre_IntArray     *color_ptr,
+                                      hypre_IntArray     *color_rows,
+                                      hypre_ParVector    *u,
+                                      hypre_ParVector    *Vtemp )
+{
+   return hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel(A, f, cf_marker, relax_points,
+                                                          relax_weight, omega, color_ptr,
+                                                          color_rows, u, Vtemp, 1);
+}
+
 HYPRE_Int
 hypre_BoomerAMGRelax19GaussElim( hypre_ParCSRMatrix *A,
                                  hypre_ParVector    *f,
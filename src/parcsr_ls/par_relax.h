@@ -452,6 +452,132 @@ hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
 }
 
 
+/* Multivector version: all vectors are relaxed with a single pass over the
+ * matrix. The vectors of u, f and v_tmp are stored with stride vecstride, while
+ * v_ext holds the num_vectors off-processor values of each column contiguously.
+ * Diagonal columns outside [ns, ne) are taken from v_tmp as in the threaded
+ * versions; res needs room for 3 * num_vectors values. */
+static inline void
+hypre_HybridGaussSeidelMulti( HYPRE_Int     *A_diag_i,
+                              HYPRE_Int     *A_diag_j,
+                              HYPRE_Complex *A_diag_data,
+                              HYPRE_Int     *A_offd_i,
+                              HYPRE_Int     *A_offd_j,
+                              HYPRE_Complex *A_offd_data,
+                              HYPRE_Complex *f_data,
+                              HYPRE_Int     *cf_marker,
+                              HYPRE_Int      relax_points,
+                              HYPRE_Int      non_scale,
+                              HYPRE_Real     relax_weight,
+                              HYPRE_Real     omega,
+                              HYPRE_Real     one_minus_omega,
+                              HYPRE_Real     prod,
+                              HYPRE_Complex *l1_norms,
+                              HYPRE_Complex *u_data,
+                              HYPRE_Complex *v_tmp_data,
+                              HYPRE_Complex *v_ext_data,
+                              HYPRE_Int      num_vectors,
+                              HYPRE_Int      vecstride,
+                              HYPRE_Int      ns,
+                              HYPRE_Int      ne,
+                              HYPRE_Int      ibegin,
+                              HYPRE_Int      iend,
+                              HYPRE_Int      iorder,
+                              HYPRE_Int      Skip_diag,
+                              HYPRE_Complex *res )
+{
+   HYPRE_Complex *res0 = res + num_vectors;
+   HYPRE_Complex *res2 = res + 2 * num_vectors;
+   HYPRE_Int i, k;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      /*-----------------------------------------------------------
+       * Relax only C or F points as determined by relax_points.
+       * If i is of the right type ( C or F or All) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+
+         for (k = 0; k < num_vectors; k++)
+         {
+            res[k]  = f_data[i + k * vecstride];
+            res0[k] = 0.0;
+            res2[k] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_diag_j[jj];
+            const HYPRE_Complex a  = A_diag_data[jj];
+
+            if (ii >= ns && ii < ne)
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res0[k] -= a * u_data[ii + k * vecstride];
+               }
+               if (!non_scale)
+               {
+                  for (k = 0; k < num_vectors; k++)
+                  {
+                     res2[k] += a * v_tmp_data[ii + k * vecstride];
+                  }
+               }
+            }
+            else
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res[k] -= a * v_tmp_data[ii + k * vecstride];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_offd_j[jj];
+            const HYPRE_Complex a  = A_offd_data[jj];
+
+            for (k = 0; k < num_vectors; k++)
+            {
+               res[k] -= a * v_ext_data[ii * num_vectors + k];
+            }
+         }
+
+         for (k = 0; k < num_vectors; k++)
+         {
+            HYPRE_Complex *u_ik = &u_data[i + k * vecstride];
+
+            if (non_scale)
+            {
+               if (Skip_diag)
+               {
+                  *u_ik = (res[k] + res0[k]) / di;
+               }
+               else
+               {
+                  *u_ik += (res[k] + res0[k]) / di;
+               }
+            }
+            else
+            {
+               if (Skip_diag)
+               {
+                  *u_ik *= prod;
+               }
+               *u_ik += relax_weight * (omega * res[k] + res0[k] + one_minus_omega * res2[k]) / di;
+            }
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Ordered Version */
 static inline void
 hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
@@ -63,6 +63,58 @@ hypre_BoomerAMGRelaxIF( hypre_ParCSRMatrix *A,
    return Solve_err_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorIF
+ *
+ * Same as hypre_BoomerAMGRelaxIF for the multicolor smoothers (24, 25),
+ * which use the coloring of A stored with the AMG level.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorIF( hypre_ParCSRMatrix *A,
+                                  hypre_ParVector    *f,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_type,
+                                  HYPRE_Int           relax_order,
+                                  HYPRE_Int           cycle_param,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Real          omega,
+                                  hypre_IntArray     *color_ptr,
+                                  hypre_IntArray     *color_rows,
+                                  hypre_ParVector    *u,
+                                  hypre_ParVector    *Vtemp )
+{
+   HYPRE_Int i, num_points = 1;
+   HYPRE_Int relax_points[2] = {0, 0};
+   HYPRE_Int Symm = (relax_type == 25);
+
+   if (relax_order == 1 && cycle_param < 3)
+   {
+      num_points = 2;
+      if (cycle_param < 2)
+      {
+         /* CF down cycle */
+         relax_points[0] =  1;
+         relax_points[1] = -1;
+      }
+      else
+      {
+         /* FC up cycle */
+         relax_points[0] = -1;
+         relax_points[1] =  1;
+      }
+   }
+
+   for (i = 0; i < num_points; i++)
+   {
+      hypre_BoomerAMGRelaxMulticolorHybridGaussSeidel(A, f, cf_marker, relax_points[i],
+                                                      relax_weight, omega, color_ptr,
+                                                      color_rows, u, Vtemp, Symm);
+   }
+   hypre_ParVectorAllZeros(u) = 0;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRRelax_L1_Jacobi (same as the one in AMS, but this allows CF)
  * u_new = u_old + w D^{-1}(f - A u), where D_ii = ||A(i,:)||_1
@@ -343,6 +343,8 @@ GenerateVarDifConv( MPI_Comm         comm,
    rhs = hypre_ParVectorLocalVector(par_rhs);
    hypre_VectorData(rhs) = rhs_data;
    hypre_VectorMemoryLocation(rhs) = HYPRE_MEMORY_HOST;
+   hypre_VectorVectorStride(rhs) = local_num_rows;
+   hypre_VectorIndexStride(rhs) = 1;
 
    A = hypre_ParCSRMatrixCreate(comm, grid_size, grid_size,
                                 global_part, global_part, num_cols_offd,
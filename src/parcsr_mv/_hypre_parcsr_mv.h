@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,7 +38,6 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -78,9 +76,7 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -494,6 +490,175 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+#endif
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Cached plans for repeated ParCSR matrix products
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PAR_CSR_MATMAT_PLAN_HEADER
+#define hypre_PAR_CSR_MATMAT_PLAN_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Symbolic data of C = A * B. The external rows of B needed by A_offd are
+ * kept with their column indices already mapped to the local columns of C
+ * (nonnegative: column of C_diag, negative: column -(k+1) of C_offd), so a
+ * numeric product only has to exchange the values of those rows.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* element-wise communication package for the values of the external rows */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;
+   HYPRE_Complex        *send_data;
+
+   /* external rows of B (one per column of A_offd) */
+   HYPRE_Int             num_ext_rows;
+   HYPRE_Int            *ext_i;
+   HYPRE_Int            *ext_j;
+   HYPRE_Complex        *ext_data;
+
+   /* maps columns of B_offd to columns of C_offd */
+   HYPRE_Int            *map_B_to_C;
+
+   /* sizes used to check that the operands still match the plan */
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_diag;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             nnz_A_diag;
+   HYPRE_Int             nnz_A_offd;
+   HYPRE_Int             nnz_B_diag;
+   HYPRE_Int             nnz_B_offd;
+   HYPRE_Int             nnz_C_diag;
+   HYPRE_Int             nnz_C_offd;
+
+} hypre_ParCSRMatMatPlan;
+
+#define hypre_ParCSRMatMatPlanCommPkg(plan)       ((plan) -> comm_pkg)
+#define hypre_ParCSRMatMatPlanNumSendRows(plan)   ((plan) -> num_send_rows)
+#define hypre_ParCSRMatMatPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParCSRMatMatPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParCSRMatMatPlanNumExtRows(plan)    ((plan) -> num_ext_rows)
+#define hypre_ParCSRMatMatPlanExtI(plan)          ((plan) -> ext_i)
+#define hypre_ParCSRMatMatPlanExtJ(plan)          ((plan) -> ext_j)
+#define hypre_ParCSRMatMatPlanExtData(plan)       ((plan) -> ext_data)
+#define hypre_ParCSRMatMatPlanMapBToC(plan)       ((plan) -> map_B_to_C)
+#define hypre_ParCSRMatMatPlanNumRows(plan)       ((plan) -> num_rows)
+#define hypre_ParCSRMatMatPlanNumColsDiag(plan)   ((plan) -> num_cols_diag)
+#define hypre_ParCSRMatMatPlanNumColsOffd(plan)   ((plan) -> num_cols_offd)
+#define hypre_ParCSRMatMatPlanNnzADiag(plan)      ((plan) -> nnz_A_diag)
+#define hypre_ParCSRMatMatPlanNnzAOffd(plan)      ((plan) -> nnz_A_offd)
+#define hypre_ParCSRMatMatPlanNnzBDiag(plan)      ((plan) -> nnz_B_diag)
+#define hypre_ParCSRMatMatPlanNnzBOffd(plan)      ((plan) -> nnz_B_offd)
+#define hypre_ParCSRMatMatPlanNnzCDiag(plan)      ((plan) -> nnz_C_diag)
+#define hypre_ParCSRMatMatPlanNnzCOffd(plan)      ((plan) -> nnz_C_offd)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatPlan
+ *
+ * Symbolic data of C = A^T * B. The transposes of A_diag and A_offd are kept
+ * as patterns plus the position of each entry in A, the rows of A_offd^T * B
+ * that are added to other processors are kept with columns in the local
+ * numbering of B (same encoding as above), and the received rows are kept
+ * as positions into C_diag (nonnegative) or C_offd (-(k+1)).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* transposed patterns of A_diag and A_offd */
+   HYPRE_Int            *AT_diag_i;
+   HYPRE_Int            *AT_diag_j;
+   HYPRE_Int            *AT_diag_perm;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_perm;
+
+   /* rows of A_offd^T * B sent to their owners */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_int_rows;
+   HYPRE_Int            *int_i;
+   HYPRE_Int            *int_j;
+   HYPRE_Complex        *int_data;
+
+   /* received rows, added to the rows of C given by the send map of A */
+   HYPRE_Int             num_recv_rows;
+   HYPRE_Int            *recv_i;
+   HYPRE_Int            *recv_pos;
+   HYPRE_Complex        *recv_data;
+
+   /* maps columns of B_offd to columns of C_offd */
+   HYPRE_Int            *map_B_to_C;
+
+   /* sizes used to check that the operands still match the plan */
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_diag;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             nnz_A_diag;
+   HYPRE_Int             nnz_A_offd;
+   HYPRE_Int             nnz_B_diag;
+   HYPRE_Int             nnz_B_offd;
+   HYPRE_Int             nnz_C_diag;
+   HYPRE_Int             nnz_C_offd;
+
+} hypre_ParCSRTMatMatPlan;
+
+#define hypre_ParCSRTMatMatPlanATDiagI(plan)      ((plan) -> AT_diag_i)
+#define hypre_ParCSRTMatMatPlanATDiagJ(plan)      ((plan) -> AT_diag_j)
+#define hypre_ParCSRTMatMatPlanATDiagPerm(plan)   ((plan) -> AT_diag_perm)
+#define hypre_ParCSRTMatMatPlanATOffdI(plan)      ((plan) -> AT_offd_i)
+#define hypre_ParCSRTMatMatPlanATOffdJ(plan)      ((plan) -> AT_offd_j)
+#define hypre_ParCSRTMatMatPlanATOffdPerm(plan)   ((plan) -> AT_offd_perm)
+#define hypre_ParCSRTMatMatPlanCommPkg(plan)      ((plan) -> comm_pkg)
+#define hypre_ParCSRTMatMatPlanNumIntRows(plan)   ((plan) -> num_int_rows)
+#define hypre_ParCSRTMatMatPlanIntI(plan)         ((plan) -> int_i)
+#define hypre_ParCSRTMatMatPlanIntJ(plan)         ((plan) -> int_j)
+#define hypre_ParCSRTMatMatPlanIntData(plan)      ((plan) -> int_data)
+#define hypre_ParCSRTMatMatPlanNumRecvRows(plan)  ((plan) -> num_recv_rows)
+#define hypre_ParCSRTMatMatPlanRecvI(plan)        ((plan) -> recv_i)
+#define hypre_ParCSRTMatMatPlanRecvPos(plan)      ((plan) -> recv_pos)
+#define hypre_ParCSRTMatMatPlanRecvData(plan)     ((plan) -> recv_data)
+#define hypre_ParCSRTMatMatPlanMapBToC(plan)      ((plan) -> map_B_to_C)
+#define hypre_ParCSRTMatMatPlanNumRows(plan)      ((plan) -> num_rows)
+#define hypre_ParCSRTMatMatPlanNumColsDiag(plan)  ((plan) -> num_cols_diag)
+#define hypre_ParCSRTMatMatPlanNumColsOffd(plan)  ((plan) -> num_cols_offd)
+#define hypre_ParCSRTMatMatPlanNnzADiag(plan)     ((plan) -> nnz_A_diag)
+#define hypre_ParCSRTMatMatPlanNnzAOffd(plan)     ((plan) -> nnz_A_offd)
+#define hypre_ParCSRTMatMatPlanNnzBDiag(plan)     ((plan) -> nnz_B_diag)
+#define hypre_ParCSRTMatMatPlanNnzBOffd(plan)     ((plan) -> nnz_B_offd)
+#define hypre_ParCSRTMatMatPlanNnzCDiag(plan)     ((plan) -> nnz_C_diag)
+#define hypre_ParCSRTMatMatPlanNnzCOffd(plan)     ((plan) -> nnz_C_offd)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Plan for C = R^T * A * P, computed as R^T * (A * P). The intermediate
+ * product A * P is kept so that its values can be refreshed in place.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatMatPlan   *AP_plan;
+   hypre_ParCSRMatrix       *AP;
+   hypre_ParCSRTMatMatPlan  *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+#define hypre_ParCSRRAPPlanAPPlan(plan)           ((plan) -> AP_plan)
+#define hypre_ParCSRRAPPlanAP(plan)               ((plan) -> AP)
+#define hypre_ParCSRRAPPlanRAPPlan(plan)          ((plan) -> RAP_plan)
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -921,6 +1086,25 @@ HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_c
                                         hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices,
                                         hypre_ParCSRCommPkg **extend_comm_pkg);
 
+/* par_csr_matmat_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSetup ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                              hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumeric ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRTMatMatPlanDestroy ( hypre_ParCSRTMatMatPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRTMatMatSetup ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                               hypre_ParCSRTMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTMatMatNumeric ( hypre_ParCSRTMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKTSetup ( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                                   hypre_ParCSRMatrix *P,
+                                                   hypre_ParCSRRAPPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPKTNumeric ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *R,
+                                           hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                           hypre_ParCSRMatrix *C );
+
 /* par_csr_matop.c */
 HYPRE_Int hypre_ParCSRMatrixScale(hypre_ParCSRMatrix *A, HYPRE_Complex scalar);
 void hypre_ParMatmul_RowSizes ( HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i,
@@ -1016,7 +1200,6 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
@@ -1026,7 +1209,6 @@ void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *com
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -1035,6 +1217,10 @@ HYPRE_Int hypre_ParcsrGetExternalRowsDeviceInit( hypre_ParCSRMatrix *A, HYPRE_In
                                                  HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
 hypre_CSRMatrix* hypre_ParcsrGetExternalRowsDeviceWait(void *vrequest);
 
+HYPRE_Int hypre_BdiagInvMatvec( HYPRE_Int num_blocks, HYPRE_Int blk_size, HYPRE_Complex alpha,
+                                HYPRE_Complex *bdiaginv, HYPRE_Complex *x, HYPRE_Complex beta,
+                                HYPRE_Complex *y );
+
 HYPRE_Int hypre_ParvecBdiagInvScal( hypre_ParVector *b, HYPRE_Int blockSize, hypre_ParVector **bs,
                                     hypre_ParCSRMatrix *A);
 
@@ -1162,6 +1348,17 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
+// y = alpha*A*x + beta*b and <y,y>
+HYPRE_Int hypre_ParCSRMatrixMatvecNorm2Begin ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                               hypre_ParVector *x, HYPRE_Complex beta,
+                                               hypre_ParVector *b, hypre_ParVector *y,
+                                               HYPRE_Real *y_norm2, hypre_MPI_Request *request );
+HYPRE_Int hypre_ParCSRMatrixMatvecNorm2End ( hypre_MPI_Request *request );
+HYPRE_Int hypre_ParCSRMatrixProfileSpMV ( hypre_ParCSRMatrix *A, HYPRE_Int num_vectors,
+                                          HYPRE_Int num_products );
+HYPRE_Real hypre_ParCSRMatrixMatvecNorm2 ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                           hypre_ParVector *x, HYPRE_Complex beta,
+                                           hypre_ParVector *b, hypre_ParVector *y );
 
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
@@ -1231,6 +1428,13 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( hypre_ParVector **x, HYPRE_Int nx, hypre_ParVector **y,
+                                         HYPRE_Int ny, HYPRE_Int unroll, HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorComponentInnerProd ( hypre_ParVector *x, hypre_ParVector *y,
+                                              HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorComponentAxpy ( HYPRE_Complex *alpha, hypre_ParVector *x,
+                                         hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorComponentScale ( HYPRE_Complex *alpha, hypre_ParVector *y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
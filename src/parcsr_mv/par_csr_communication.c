@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -262,8 +261,15 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
    if (comm_handle)
    {
+      for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+      {
+         hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+      }
+
       hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
       hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -286,12 +292,16 @@ hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_ha
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* callers may pack directly into the persistent send buffer */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -300,6 +310,10 @@ hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_ha
          hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
+
+      hypre_ProfileAddComm(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                           (HYPRE_Real) hypre_ParCSRCommHandleNumSendBytes(comm_handle) +
+                           (HYPRE_Real) hypre_ParCSRCommHandleNumRecvBytes(comm_handle));
    }
 }
 
@@ -326,15 +340,18 @@ hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *comm_han
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* callers may read directly from the persistent receive buffer */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 /*------------------------------------------------------------------
  * hypre_ParCSRCommHandleCreate
@@ -631,6 +648,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
 
+   hypre_ProfileAddComm(num_requests, (HYPRE_Real) num_send_bytes + (HYPRE_Real) num_recv_bytes);
+
    hypre_GpuProfilingPopRange();
 
    return ( comm_handle );
@@ -1021,14 +1040,12 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
    hypre_ParCSRCommPkgBufData(comm_pkg)            = NULL;
    hypre_ParCSRCommPkgMatrixE(comm_pkg)            = NULL;
 #endif
-#if defined(HYPRE_USING_PERSISTENT_COMM)
    HYPRE_Int i;
 
    for (i = 0; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
    {
       comm_pkg->persistent_comm_handles[i] = NULL;
    }
-#endif
 
    /* Set input info */
    hypre_ParCSRCommPkgComm(comm_pkg)          = comm;
@@ -1068,18 +1085,28 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
 
    HYPRE_Int    *send_map_elmts_new;
 
-   HYPRE_Int     i, j;
+   HYPRE_Int     num_elmts, i, j;
 
    hypre_assert(num_components > 0);
 
    if (num_vectors != num_components)
    {
+      /* Cached persistent handles were sized for the old number of components */
+      for (i = 0; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
+      {
+         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
+         comm_pkg->persistent_comm_handles[i] = NULL;
+      }
+
       /* Update number of components in the communication package */
       hypre_ParCSRCommPkgNumComponents(comm_pkg) = num_vectors;
 
+      /* Number of send elements per component */
+      num_elmts = send_map_starts[num_sends] / num_components;
+
       /* Allocate send_maps_elmts */
       send_map_elmts_new = hypre_CTAlloc(HYPRE_Int,
-                                         send_map_starts[num_sends] * num_vectors,
+                                         num_elmts * num_vectors,
                                          HYPRE_MEMORY_HOST);
 
       /* Update send_maps_elmts */
@@ -1087,7 +1114,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       {
          if (num_components == 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_vectors; j++)
                {
@@ -1098,7 +1125,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
          }
          else
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_vectors; j++)
                {
@@ -1113,14 +1140,14 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
          /* num_vectors < num_components */
          if (num_vectors == 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                send_map_elmts_new[i] = send_map_elmts[i * num_components];
             }
          }
          else
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_vectors; j++)
                {
@@ -1143,13 +1170,13 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       /* Update send_map_starts */
       for (i = 0; i < num_sends + 1; i++)
       {
-         send_map_starts[i] *= num_vectors / num_components;
+         send_map_starts[i] = (send_map_starts[i] / num_components) * num_vectors;
       }
 
       /* Update recv_vec_starts */
       for (i = 0; i < num_recvs + 1; i++)
       {
-         recv_vec_starts[i] *= num_vectors / num_components;
+         recv_vec_starts[i] = (recv_vec_starts[i] / num_components) * num_vectors;
       }
    }
 
@@ -1207,7 +1234,6 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -1216,7 +1242,6 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
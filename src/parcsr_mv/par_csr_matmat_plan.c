@@ -0,0 +1,1401 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic/numeric split of the ParCSR matrix products
+ *
+ * The Setup functions compute the product with the regular host kernels and
+ * record its structure in a plan: the communication pattern of the external
+ * rows, their column indices mapped to the local columns of the product and
+ * the column maps between the operands and the result. The Numeric functions
+ * recompute the values of an existing product in place for operands with
+ * unchanged sparsity patterns, exchanging only matrix values.
+ *
+ * Plans are only available for host execution; on device the Setup functions
+ * return the product and a NULL plan.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanCommPkgCreate
+ *
+ * Creates an element-wise communication package with the processor lists of
+ * comm_pkg_A. If reverse is nonzero, the send and receive sides are swapped
+ * as in transpose communication. The package takes ownership of send_starts
+ * and recv_starts and can be freed with hypre_MatvecCommPkgDestroy.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg*
+hypre_ParCSRPlanCommPkgCreate( hypre_ParCSRCommPkg *comm_pkg_A,
+                               HYPRE_Int            reverse,
+                               HYPRE_Int           *send_starts,
+                               HYPRE_Int           *recv_starts )
+{
+   MPI_Comm             comm      = hypre_ParCSRCommPkgComm(comm_pkg_A);
+   HYPRE_Int            num_sends = reverse ? hypre_ParCSRCommPkgNumRecvs(comm_pkg_A) :
+                                    hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   HYPRE_Int            num_recvs = reverse ? hypre_ParCSRCommPkgNumSends(comm_pkg_A) :
+                                    hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   HYPRE_Int           *procs_s   = reverse ? hypre_ParCSRCommPkgRecvProcs(comm_pkg_A) :
+                                    hypre_ParCSRCommPkgSendProcs(comm_pkg_A);
+   HYPRE_Int           *procs_r   = reverse ? hypre_ParCSRCommPkgSendProcs(comm_pkg_A) :
+                                    hypre_ParCSRCommPkgRecvProcs(comm_pkg_A);
+   HYPRE_Int           *send_procs;
+   HYPRE_Int           *recv_procs;
+   hypre_ParCSRCommPkg *comm_pkg = NULL;
+
+   send_procs = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   recv_procs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(send_procs, procs_s, HYPRE_Int, num_sends,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(recv_procs, procs_r, HYPRE_Int, num_recvs,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommPkgCreateAndFill(comm,
+                                    num_recvs, recv_procs, recv_starts,
+                                    num_sends, send_procs, send_starts,
+                                    NULL,
+                                    &comm_pkg);
+
+   return comm_pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanTransposePattern
+ *
+ * Transposes the pattern of a CSR matrix. perm[k] is the position in the
+ * original matrix of the k-th entry of the transpose.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRPlanTransposePattern( hypre_CSRMatrix  *A,
+                                  HYPRE_Int       **AT_i_ptr,
+                                  HYPRE_Int       **AT_j_ptr,
+                                  HYPRE_Int       **AT_perm_ptr )
+{
+   HYPRE_Int   num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int   num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int  *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int  *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int   nnz      = A_i[num_rows];
+
+   HYPRE_Int  *AT_i     = hypre_CTAlloc(HYPRE_Int, num_cols + 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int  *AT_j     = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int  *AT_perm  = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   HYPRE_Int   i, jj, pos;
+
+   for (jj = 0; jj < nnz; jj++)
+   {
+      AT_i[A_j[jj] + 1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i + 1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         pos = AT_i[A_j[jj]]++;
+         AT_j[pos]    = i;
+         AT_perm[pos] = jj;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i - 1];
+   }
+   AT_i[0] = 0;
+
+   *AT_i_ptr    = AT_i;
+   *AT_j_ptr    = AT_j;
+   *AT_perm_ptr = AT_perm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanMapColMap
+ *
+ * Maps the columns of col_map_B to their positions in col_map_C. Columns
+ * not present in col_map_C are mapped to -1. Returns the number of such
+ * columns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRPlanMapColMap( HYPRE_Int      num_cols_B,
+                           HYPRE_BigInt  *col_map_B,
+                           HYPRE_Int      num_cols_C,
+                           HYPRE_BigInt  *col_map_C,
+                           HYPRE_Int    **map_B_to_C_ptr )
+{
+   HYPRE_Int  *map_B_to_C = hypre_TAlloc(HYPRE_Int, num_cols_B, HYPRE_MEMORY_HOST);
+   HYPRE_Int   i, num_missing = 0;
+
+   for (i = 0; i < num_cols_B; i++)
+   {
+      map_B_to_C[i] = hypre_BigBinarySearch(col_map_C, col_map_B[i], num_cols_C);
+      if (map_B_to_C[i] < 0)
+      {
+         num_missing++;
+      }
+   }
+
+   *map_B_to_C_ptr = map_B_to_C;
+
+   return num_missing;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanMarkRow
+ *
+ * Records the position of each entry of row i of C in the column markers.
+ * If zero is nonzero, the values of the row are also set to zero.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRPlanMarkRow( HYPRE_Int        i,
+                         hypre_CSRMatrix *C_diag,
+                         hypre_CSRMatrix *C_offd,
+                         HYPRE_Int       *marker_diag,
+                         HYPRE_Int       *marker_offd,
+                         HYPRE_Int        zero )
+{
+   HYPRE_Int      *C_diag_i    = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int      *C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex  *C_diag_data = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int      *C_offd_i    = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int      *C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex  *C_offd_data = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int       jj;
+
+   for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+   {
+      marker_diag[C_diag_j[jj]] = jj;
+   }
+   if (C_offd_i)
+   {
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker_offd[C_offd_j[jj]] = jj;
+      }
+   }
+
+   if (zero)
+   {
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         C_diag_data[jj] = 0.0;
+      }
+      if (C_offd_i)
+      {
+         for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+         {
+            C_offd_data[jj] = 0.0;
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanUnmarkRow
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRPlanUnmarkRow( HYPRE_Int        i,
+                           hypre_CSRMatrix *C_diag,
+                           hypre_CSRMatrix *C_offd,
+                           HYPRE_Int       *marker_diag,
+                           HYPRE_Int       *marker_offd )
+{
+   HYPRE_Int  *C_diag_i = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int  *C_diag_j = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Int  *C_offd_i = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int  *C_offd_j = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Int   jj;
+
+   for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+   {
+      marker_diag[C_diag_j[jj]] = -1;
+   }
+   if (C_offd_i)
+   {
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         marker_offd[C_offd_j[jj]] = -1;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRPlanAddRowProduct
+ *
+ * Adds a * (row k of [B_diag B_offd]) to the row of C whose entries are
+ * recorded in the markers. Columns of B_offd are mapped to C_offd through
+ * map_B_to_C; columns outside of the pattern of C are ignored.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRPlanAddRowProduct( HYPRE_Complex    a,
+                               HYPRE_Int        k,
+                               hypre_CSRMatrix *B_diag,
+                               hypre_CSRMatrix *B_offd,
+                               HYPRE_Int       *map_B_to_C,
+                               HYPRE_Int       *marker_diag,
+                               HYPRE_Int       *marker_offd,
+                               HYPRE_Complex   *C_diag_data,
+                               HYPRE_Complex   *C_offd_data )
+{
+   HYPRE_Int      *B_diag_i    = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int      *B_diag_j    = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex  *B_diag_data = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int      *B_offd_i    = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int      *B_offd_j    = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex  *B_offd_data = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int       kk, col, pos;
+
+   for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+   {
+      pos = marker_diag[B_diag_j[kk]];
+      if (pos >= 0)
+      {
+         C_diag_data[pos] += a * B_diag_data[kk];
+      }
+   }
+   if (B_offd_i)
+   {
+      for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+      {
+         col = map_B_to_C[B_offd_j[kk]];
+         pos = (col >= 0) ? marker_offd[col] : -1;
+         if (pos >= 0)
+         {
+            C_offd_data[pos] += a * B_offd_data[kk];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   if (plan)
+   {
+      if (hypre_ParCSRMatMatPlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRMatMatPlanCommPkg(plan));
+      }
+      hypre_TFree(hypre_ParCSRMatMatPlanSendRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanExtI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanExtJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanExtData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatMatPlanMapBToC(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSetup
+ *
+ * Computes C = A * B and returns in plan_ptr the data needed to recompute
+ * the values of C with hypre_ParCSRMatMatNumeric.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatMatSetup( hypre_ParCSRMatrix      *A,
+                         hypre_ParCSRMatrix      *B,
+                         hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   MPI_Comm                comm           = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix        *A_diag         = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd         = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag         = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd         = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int              *B_diag_i       = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int              *B_diag_j       = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int              *B_offd_i       = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int              *B_offd_j       = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int               num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt           *col_map_offd_B = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt            first_col_B    = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_Int               num_cols_B     = hypre_CSRMatrixNumCols(B_diag);
+
+   hypre_ParCSRMatrix     *C;
+   hypre_CSRMatrix        *C_diag;
+   hypre_CSRMatrix        *C_offd;
+   HYPRE_BigInt           *col_map_offd_C;
+   HYPRE_Int               num_cols_offd_C;
+
+   hypre_ParCSRMatMatPlan *plan;
+   hypre_ParCSRCommPkg    *comm_pkg_A;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_procs;
+   HYPRE_Int               num_missing = 0;
+
+   *plan_ptr = NULL;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(A),
+                                                      hypre_ParCSRMatrixMemoryLocation(B) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_ParCSRMatMat(A, B);
+   }
+#endif
+
+   C = hypre_ParCSRMatMatHost(A, B);
+   if (!C)
+   {
+      return NULL;
+   }
+
+   C_diag          = hypre_ParCSRMatrixDiag(C);
+   C_offd          = hypre_ParCSRMatrixOffd(C);
+   col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   num_cols_offd_C = hypre_CSRMatrixNumCols(C_offd);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+
+   num_missing += hypre_ParCSRPlanMapColMap(num_cols_offd_B, col_map_offd_B,
+                                            num_cols_offd_C, col_map_offd_C,
+                                            &hypre_ParCSRMatMatPlanMapBToC(plan));
+
+   if (num_procs > 1)
+   {
+      HYPRE_Int      num_sends, num_recvs, num_send_rows, num_ext_rows;
+      HYPRE_Int     *send_map_starts, *send_map_elmts, *recv_vec_starts;
+      HYPRE_Int     *send_rows, *send_rownnz, *ext_i, *ext_j;
+      HYPRE_Int     *send_starts, *recv_starts;
+      HYPRE_BigInt  *send_bigj, *ext_bigj;
+      HYPRE_BigInt   big_col;
+      HYPRE_Int      i, jj, cnt, row;
+
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+      num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+      send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+      recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+      num_send_rows   = send_map_starts[num_sends];
+      num_ext_rows    = recv_vec_starts[num_recvs];
+
+      /* rows of B requested by the neighbors and their lengths */
+      send_rows   = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      send_rownnz = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_send_rows; i++)
+      {
+         row = send_map_elmts[i];
+         send_rows[i]   = row;
+         send_rownnz[i] = B_diag_i[row + 1] - B_diag_i[row] +
+                          B_offd_i[row + 1] - B_offd_i[row];
+      }
+
+      ext_i = hypre_TAlloc(HYPRE_Int, num_ext_rows + 1, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg_A, send_rownnz, ext_i + 1);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      ext_i[0] = 0;
+      for (i = 0; i < num_ext_rows; i++)
+      {
+         ext_i[i + 1] += ext_i[i];
+      }
+
+      /* element-wise communication package */
+      send_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      send_starts[0] = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         send_starts[i + 1] = send_starts[i];
+         for (jj = send_map_starts[i]; jj < send_map_starts[i + 1]; jj++)
+         {
+            send_starts[i + 1] += send_rownnz[jj];
+         }
+      }
+      for (i = 0; i <= num_recvs; i++)
+      {
+         recv_starts[i] = ext_i[recv_vec_starts[i]];
+      }
+
+      hypre_ParCSRMatMatPlanCommPkg(plan) =
+         hypre_ParCSRPlanCommPkgCreate(comm_pkg_A, 0, send_starts, recv_starts);
+
+      /* global column indices of the external rows, diag part first */
+      send_bigj = hypre_TAlloc(HYPRE_BigInt, send_starts[num_sends], HYPRE_MEMORY_HOST);
+      ext_bigj  = hypre_TAlloc(HYPRE_BigInt, ext_i[num_ext_rows], HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_send_rows; i++)
+      {
+         row = send_rows[i];
+         for (jj = B_diag_i[row]; jj < B_diag_i[row + 1]; jj++)
+         {
+            send_bigj[cnt++] = first_col_B + (HYPRE_BigInt) B_diag_j[jj];
+         }
+         for (jj = B_offd_i[row]; jj < B_offd_i[row + 1]; jj++)
+         {
+            send_bigj[cnt++] = col_map_offd_B[B_offd_j[jj]];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(21, hypre_ParCSRMatMatPlanCommPkg(plan),
+                                                 send_bigj, ext_bigj);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      /* map to the local columns of C */
+      ext_j = hypre_TAlloc(HYPRE_Int, ext_i[num_ext_rows], HYPRE_MEMORY_HOST);
+      for (jj = 0; jj < ext_i[num_ext_rows]; jj++)
+      {
+         big_col = ext_bigj[jj];
+         if (big_col >= first_col_B && big_col < first_col_B + (HYPRE_BigInt) num_cols_B)
+         {
+            ext_j[jj] = (HYPRE_Int) (big_col - first_col_B);
+         }
+         else
+         {
+            cnt = hypre_BigBinarySearch(col_map_offd_C, big_col, num_cols_offd_C);
+            if (cnt < 0)
+            {
+               num_missing++;
+            }
+            ext_j[jj] = -cnt - 1;
+         }
+      }
+
+      hypre_ParCSRMatMatPlanNumSendRows(plan) = num_send_rows;
+      hypre_ParCSRMatMatPlanSendRows(plan)    = send_rows;
+      hypre_ParCSRMatMatPlanSendData(plan)    = hypre_TAlloc(HYPRE_Complex, send_starts[num_sends],
+                                                             HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatMatPlanNumExtRows(plan)  = num_ext_rows;
+      hypre_ParCSRMatMatPlanExtI(plan)        = ext_i;
+      hypre_ParCSRMatMatPlanExtJ(plan)        = ext_j;
+      hypre_ParCSRMatMatPlanExtData(plan)     = hypre_TAlloc(HYPRE_Complex, ext_i[num_ext_rows],
+                                                             HYPRE_MEMORY_HOST);
+
+      hypre_TFree(send_rownnz, HYPRE_MEMORY_HOST);
+      hypre_TFree(send_bigj, HYPRE_MEMORY_HOST);
+      hypre_TFree(ext_bigj, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParCSRMatMatPlanNumRows(plan)     = hypre_CSRMatrixNumRows(C_diag);
+   hypre_ParCSRMatMatPlanNumColsDiag(plan) = hypre_CSRMatrixNumCols(C_diag);
+   hypre_ParCSRMatMatPlanNumColsOffd(plan) = num_cols_offd_C;
+   hypre_ParCSRMatMatPlanNnzADiag(plan)    = hypre_CSRMatrixNumNonzeros(A_diag);
+   hypre_ParCSRMatMatPlanNnzAOffd(plan)    = hypre_CSRMatrixNumNonzeros(A_offd);
+   hypre_ParCSRMatMatPlanNnzBDiag(plan)    = hypre_CSRMatrixNumNonzeros(B_diag);
+   hypre_ParCSRMatMatPlanNnzBOffd(plan)    = hypre_CSRMatrixNumNonzeros(B_offd);
+   hypre_ParCSRMatMatPlanNnzCDiag(plan)    = hypre_CSRMatrixNumNonzeros(C_diag);
+   hypre_ParCSRMatMatPlanNnzCOffd(plan)    = hypre_CSRMatrixNumNonzeros(C_offd);
+
+   /* every column reached by the product must be a column of C */
+   if (num_missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Inconsistent column maps in product plan!\n");
+      hypre_ParCSRMatMatPlanDestroy(plan);
+      plan = NULL;
+   }
+
+   *plan_ptr = plan;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumeric
+ *
+ * Recomputes the values of C = A * B in place, where C was returned by
+ * hypre_ParCSRMatMatSetup together with plan and the patterns of A and B
+ * have not changed since.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumeric( hypre_ParCSRMatMatPlan *plan,
+                           hypre_ParCSRMatrix     *A,
+                           hypre_ParCSRMatrix     *B,
+                           hypre_ParCSRMatrix     *C )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag      = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd      = hypre_ParCSRMatrixOffd(B);
+   hypre_CSRMatrix        *C_diag      = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd      = hypre_ParCSRMatrixOffd(C);
+
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               num_rows;
+   HYPRE_Int               num_cols_diag;
+   HYPRE_Int               num_cols_offd;
+   HYPRE_Int              *map_B_to_C;
+
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   num_rows      = hypre_ParCSRMatMatPlanNumRows(plan);
+   num_cols_diag = hypre_ParCSRMatMatPlanNumColsDiag(plan);
+   num_cols_offd = hypre_ParCSRMatMatPlanNumColsOffd(plan);
+   map_B_to_C    = hypre_ParCSRMatMatPlanMapBToC(plan);
+   comm_pkg      = hypre_ParCSRMatMatPlanCommPkg(plan);
+
+   if (hypre_CSRMatrixNumNonzeros(A_diag) != hypre_ParCSRMatMatPlanNnzADiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(A_offd) != hypre_ParCSRMatMatPlanNnzAOffd(plan) ||
+       hypre_CSRMatrixNumNonzeros(B_diag) != hypre_ParCSRMatMatPlanNnzBDiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(B_offd) != hypre_ParCSRMatMatPlanNnzBOffd(plan) ||
+       hypre_CSRMatrixNumNonzeros(C_diag) != hypre_ParCSRMatMatPlanNnzCDiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(C_offd) != hypre_ParCSRMatMatPlanNnzCOffd(plan) ||
+       hypre_CSRMatrixNumRows(C_diag) != num_rows ||
+       hypre_CSRMatrixNumCols(C_offd) != num_cols_offd)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrices do not match the product plan!\n");
+      return hypre_error_flag;
+   }
+
+   /* the SELL-C-sigma layouts of C refer to the old values */
+   hypre_CSRMatrixSellDestroy(C_diag);
+   hypre_CSRMatrixSellDestroy(C_offd);
+
+   /* start the exchange of the external rows of B */
+   if (comm_pkg)
+   {
+      HYPRE_Int      *send_rows   = hypre_ParCSRMatMatPlanSendRows(plan);
+      HYPRE_Complex  *send_data   = hypre_ParCSRMatMatPlanSendData(plan);
+      HYPRE_Int      *B_diag_i    = hypre_CSRMatrixI(B_diag);
+      HYPRE_Complex  *B_diag_data = hypre_CSRMatrixData(B_diag);
+      HYPRE_Int      *B_offd_i    = hypre_CSRMatrixI(B_offd);
+      HYPRE_Complex  *B_offd_data = hypre_CSRMatrixData(B_offd);
+      HYPRE_Int       i, jj, row, cnt = 0;
+
+      for (i = 0; i < hypre_ParCSRMatMatPlanNumSendRows(plan); i++)
+      {
+         row = send_rows[i];
+         for (jj = B_diag_i[row]; jj < B_diag_i[row + 1]; jj++)
+         {
+            send_data[cnt++] = B_diag_data[jj];
+         }
+         for (jj = B_offd_i[row]; jj < B_offd_i[row + 1]; jj++)
+         {
+            send_data[cnt++] = B_offd_data[jj];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data,
+                                                 hypre_ParCSRMatMatPlanExtData(plan));
+   }
+
+   /* C = A_diag * B, overlapped with communication */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *A_diag_i    = hypre_CSRMatrixI(A_diag);
+      HYPRE_Int      *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+      HYPRE_Complex  *A_diag_data = hypre_CSRMatrixData(A_diag);
+      HYPRE_Complex  *C_diag_data = hypre_CSRMatrixData(C_diag);
+      HYPRE_Complex  *C_offd_data = hypre_CSRMatrixData(C_offd);
+      HYPRE_Int      *marker_diag;
+      HYPRE_Int      *marker_offd;
+      HYPRE_Int       i, jj, ns, ne;
+
+      marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag, HYPRE_MEMORY_HOST);
+      marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_diag; i++)
+      {
+         marker_diag[i] = -1;
+      }
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         marker_offd[i] = -1;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      for (i = ns; i < ne; i++)
+      {
+         hypre_ParCSRPlanMarkRow(i, C_diag, C_offd, marker_diag, marker_offd, 1);
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            hypre_ParCSRPlanAddRowProduct(A_diag_data[jj], A_diag_j[jj], B_diag, B_offd,
+                                          map_B_to_C, marker_diag, marker_offd,
+                                          C_diag_data, C_offd_data);
+         }
+         hypre_ParCSRPlanUnmarkRow(i, C_diag, C_offd, marker_diag, marker_offd);
+      }
+
+      hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+   }
+
+   if (!comm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* C += A_offd * B_ext */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *A_offd_i    = hypre_CSRMatrixI(A_offd);
+      HYPRE_Int      *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+      HYPRE_Complex  *A_offd_data = hypre_CSRMatrixData(A_offd);
+      HYPRE_Complex  *C_diag_data = hypre_CSRMatrixData(C_diag);
+      HYPRE_Complex  *C_offd_data = hypre_CSRMatrixData(C_offd);
+      HYPRE_Int      *ext_i       = hypre_ParCSRMatMatPlanExtI(plan);
+      HYPRE_Int      *ext_j       = hypre_ParCSRMatMatPlanExtJ(plan);
+      HYPRE_Complex  *ext_data    = hypre_ParCSRMatMatPlanExtData(plan);
+      HYPRE_Int      *marker_diag;
+      HYPRE_Int      *marker_offd;
+      HYPRE_Complex   a;
+      HYPRE_Int       i, jj, kk, k, col, pos, ns, ne;
+
+      marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag, HYPRE_MEMORY_HOST);
+      marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_diag; i++)
+      {
+         marker_diag[i] = -1;
+      }
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         marker_offd[i] = -1;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      for (i = ns; i < ne; i++)
+      {
+         if (A_offd_i[i + 1] == A_offd_i[i])
+         {
+            continue;
+         }
+
+         hypre_ParCSRPlanMarkRow(i, C_diag, C_offd, marker_diag, marker_offd, 0);
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            k = A_offd_j[jj];
+            a = A_offd_data[jj];
+            for (kk = ext_i[k]; kk < ext_i[k + 1]; kk++)
+            {
+               col = ext_j[kk];
+               pos = (col >= 0) ? marker_diag[col] : marker_offd[-col - 1];
+               if (pos < 0)
+               {
+                  continue;
+               }
+               if (col >= 0)
+               {
+                  C_diag_data[pos] += a * ext_data[kk];
+               }
+               else
+               {
+                  C_offd_data[pos] += a * ext_data[kk];
+               }
+            }
+         }
+         hypre_ParCSRPlanUnmarkRow(i, C_diag, C_offd, marker_diag, marker_offd);
+      }
+
+      hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTMatMatPlanDestroy( hypre_ParCSRTMatMatPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_ParCSRTMatMatPlanATDiagI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanATDiagJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanATDiagPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanATOffdI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanATOffdJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanATOffdPerm(plan), HYPRE_MEMORY_HOST);
+      if (hypre_ParCSRTMatMatPlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRTMatMatPlanCommPkg(plan));
+      }
+      hypre_TFree(hypre_ParCSRTMatMatPlanIntI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanIntJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanIntData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanRecvI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanRecvPos(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanRecvData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTMatMatPlanMapBToC(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatSetup
+ *
+ * Computes C = A^T * B and returns in plan_ptr the data needed to recompute
+ * the values of C with hypre_ParCSRTMatMatNumeric.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRTMatMatSetup( hypre_ParCSRMatrix       *A,
+                          hypre_ParCSRMatrix       *B,
+                          hypre_ParCSRTMatMatPlan **plan_ptr )
+{
+   MPI_Comm                 comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix         *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *A_offd          = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix         *B_diag          = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix         *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int               *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int               *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int               *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int                num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int                num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt            *col_map_offd_B  = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt             first_col_B     = hypre_ParCSRMatrixFirstColDiag(B);
+
+   hypre_ParCSRMatrix      *C;
+   hypre_CSRMatrix         *C_diag;
+   hypre_CSRMatrix         *C_offd;
+   HYPRE_BigInt            *col_map_offd_C;
+   HYPRE_Int                num_cols_offd_C;
+
+   hypre_ParCSRTMatMatPlan *plan;
+   hypre_ParCSRCommPkg     *comm_pkg_A;
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Int                num_procs;
+   HYPRE_Int                num_missing = 0;
+
+   *plan_ptr = NULL;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(A),
+                                                      hypre_ParCSRMatrixMemoryLocation(B) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_ParCSRTMatMatKT(A, B, 0);
+   }
+#endif
+
+   C = hypre_ParCSRTMatMatKTHost(A, B, 0);
+   if (!C)
+   {
+      return NULL;
+   }
+
+   C_diag          = hypre_ParCSRMatrixDiag(C);
+   C_offd          = hypre_ParCSRMatrixOffd(C);
+   col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   num_cols_offd_C = hypre_CSRMatrixNumCols(C_offd);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRTMatMatPlan, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRPlanTransposePattern(A_diag,
+                                    &hypre_ParCSRTMatMatPlanATDiagI(plan),
+                                    &hypre_ParCSRTMatMatPlanATDiagJ(plan),
+                                    &hypre_ParCSRTMatMatPlanATDiagPerm(plan));
+
+   num_missing += hypre_ParCSRPlanMapColMap(num_cols_offd_B, col_map_offd_B,
+                                            num_cols_offd_C, col_map_offd_C,
+                                            &hypre_ParCSRTMatMatPlanMapBToC(plan));
+
+   if (num_procs > 1)
+   {
+      HYPRE_Int      num_sends, num_recvs, num_int_rows, num_recv_rows;
+      HYPRE_Int     *send_map_starts, *send_map_elmts, *recv_vec_starts;
+      HYPRE_Int     *AT_offd_i, *AT_offd_j;
+      HYPRE_Int     *int_i, *int_j, *int_rownnz, *marker_diag, *marker_offd;
+      HYPRE_Int     *recv_i, *recv_pos;
+      HYPRE_Int     *send_starts, *recv_starts;
+      HYPRE_Int     *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j;
+      HYPRE_BigInt  *int_bigj, *recv_bigj;
+      HYPRE_BigInt   big_col;
+      HYPRE_BigInt   first_col_C = first_col_B;
+      HYPRE_Int      i, jj, kk, k, col, cnt, row, found;
+
+      hypre_ParCSRPlanTransposePattern(A_offd,
+                                       &hypre_ParCSRTMatMatPlanATOffdI(plan),
+                                       &hypre_ParCSRTMatMatPlanATOffdJ(plan),
+                                       &hypre_ParCSRTMatMatPlanATOffdPerm(plan));
+      AT_offd_i = hypre_ParCSRTMatMatPlanATOffdI(plan);
+      AT_offd_j = hypre_ParCSRTMatMatPlanATOffdJ(plan);
+
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+      num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+      send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+      recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+      num_int_rows    = recv_vec_starts[num_recvs];
+      num_recv_rows   = send_map_starts[num_sends];
+
+      /*-----------------------------------------------------------------------
+       * Pattern of A_offd^T * B in the local column numbering of B
+       *-----------------------------------------------------------------------*/
+
+      marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag_B, HYPRE_MEMORY_HOST);
+      marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_diag_B; i++)
+      {
+         marker_diag[i] = -1;
+      }
+      for (i = 0; i < num_cols_offd_B; i++)
+      {
+         marker_offd[i] = -1;
+      }
+
+      int_i = hypre_CTAlloc(HYPRE_Int, num_int_rows + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_int_rows; i++)
+      {
+         cnt = 0;
+         for (jj = AT_offd_i[i]; jj < AT_offd_i[i + 1]; jj++)
+         {
+            k = AT_offd_j[jj];
+            for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+            {
+               if (marker_diag[B_diag_j[kk]] != i)
+               {
+                  marker_diag[B_diag_j[kk]] = i;
+                  cnt++;
+               }
+            }
+            for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+            {
+               if (marker_offd[B_offd_j[kk]] != i)
+               {
+                  marker_offd[B_offd_j[kk]] = i;
+                  cnt++;
+               }
+            }
+         }
+         int_i[i + 1] = int_i[i] + cnt;
+      }
+
+      for (i = 0; i < num_cols_diag_B; i++)
+      {
+         marker_diag[i] = -1;
+      }
+      for (i = 0; i < num_cols_offd_B; i++)
+      {
+         marker_offd[i] = -1;
+      }
+
+      int_j    = hypre_TAlloc(HYPRE_Int, int_i[num_int_rows], HYPRE_MEMORY_HOST);
+      int_bigj = hypre_TAlloc(HYPRE_BigInt, int_i[num_int_rows], HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_int_rows; i++)
+      {
+         for (jj = AT_offd_i[i]; jj < AT_offd_i[i + 1]; jj++)
+         {
+            k = AT_offd_j[jj];
+            for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+            {
+               col = B_diag_j[kk];
+               if (marker_diag[col] != i)
+               {
+                  marker_diag[col] = i;
+                  int_j[cnt]       = col;
+                  int_bigj[cnt++]  = first_col_B + (HYPRE_BigInt) col;
+               }
+            }
+            for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+            {
+               col = B_offd_j[kk];
+               if (marker_offd[col] != i)
+               {
+                  marker_offd[col] = i;
+                  int_j[cnt]       = -col - 1;
+                  int_bigj[cnt++]  = col_map_offd_B[col];
+               }
+            }
+         }
+      }
+
+      hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------------
+       * Send the rows to their owners (transpose communication)
+       *-----------------------------------------------------------------------*/
+
+      int_rownnz = hypre_TAlloc(HYPRE_Int, num_int_rows, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_int_rows; i++)
+      {
+         int_rownnz[i] = int_i[i + 1] - int_i[i];
+      }
+
+      recv_i = hypre_TAlloc(HYPRE_Int, num_recv_rows + 1, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg_A, int_rownnz, recv_i + 1);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(int_rownnz, HYPRE_MEMORY_HOST);
+
+      recv_i[0] = 0;
+      for (i = 0; i < num_recv_rows; i++)
+      {
+         recv_i[i + 1] += recv_i[i];
+      }
+
+      send_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      recv_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_recvs; i++)
+      {
+         send_starts[i] = int_i[recv_vec_starts[i]];
+      }
+      for (i = 0; i <= num_sends; i++)
+      {
+         recv_starts[i] = recv_i[send_map_starts[i]];
+      }
+
+      hypre_ParCSRTMatMatPlanCommPkg(plan) =
+         hypre_ParCSRPlanCommPkgCreate(comm_pkg_A, 1, send_starts, recv_starts);
+
+      recv_bigj = hypre_TAlloc(HYPRE_BigInt, recv_i[num_recv_rows], HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(21, hypre_ParCSRTMatMatPlanCommPkg(plan),
+                                                 int_bigj, recv_bigj);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      /*-----------------------------------------------------------------------
+       * Positions of the received entries in C
+       *-----------------------------------------------------------------------*/
+
+      C_diag_i  = hypre_CSRMatrixI(C_diag);
+      C_diag_j  = hypre_CSRMatrixJ(C_diag);
+      C_offd_i  = hypre_CSRMatrixI(C_offd);
+      C_offd_j  = hypre_CSRMatrixJ(C_offd);
+      recv_pos  = hypre_TAlloc(HYPRE_Int, recv_i[num_recv_rows], HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_recv_rows; i++)
+      {
+         row = send_map_elmts[i];
+         for (jj = recv_i[i]; jj < recv_i[i + 1]; jj++)
+         {
+            big_col = recv_bigj[jj];
+            found   = 0;
+            if (big_col >= first_col_C && big_col < first_col_C + (HYPRE_BigInt) num_cols_diag_B)
+            {
+               col = (HYPRE_Int) (big_col - first_col_C);
+               for (kk = C_diag_i[row]; kk < C_diag_i[row + 1]; kk++)
+               {
+                  if (C_diag_j[kk] == col)
+                  {
+                     recv_pos[jj] = kk;
+                     found = 1;
+                     break;
+                  }
+               }
+            }
+            else
+            {
+               col = hypre_BigBinarySearch(col_map_offd_C, big_col, num_cols_offd_C);
+               for (kk = C_offd_i[row]; col >= 0 && kk < C_offd_i[row + 1]; kk++)
+               {
+                  if (C_offd_j[kk] == col)
+                  {
+                     recv_pos[jj] = -kk - 1;
+                     found = 1;
+                     break;
+                  }
+               }
+            }
+            if (!found)
+            {
+               recv_pos[jj] = 0;
+               num_missing++;
+            }
+         }
+      }
+
+      hypre_ParCSRTMatMatPlanNumIntRows(plan)  = num_int_rows;
+      hypre_ParCSRTMatMatPlanIntI(plan)        = int_i;
+      hypre_ParCSRTMatMatPlanIntJ(plan)        = int_j;
+      hypre_ParCSRTMatMatPlanIntData(plan)     = hypre_TAlloc(HYPRE_Complex, int_i[num_int_rows],
+                                                              HYPRE_MEMORY_HOST);
+      hypre_ParCSRTMatMatPlanNumRecvRows(plan) = num_recv_rows;
+      hypre_ParCSRTMatMatPlanRecvI(plan)       = recv_i;
+      hypre_ParCSRTMatMatPlanRecvPos(plan)     = recv_pos;
+      hypre_ParCSRTMatMatPlanRecvData(plan)    = hypre_TAlloc(HYPRE_Complex, recv_i[num_recv_rows],
+                                                              HYPRE_MEMORY_HOST);
+
+      hypre_TFree(int_bigj, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_bigj, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParCSRTMatMatPlanNumRows(plan)     = hypre_CSRMatrixNumRows(C_diag);
+   hypre_ParCSRTMatMatPlanNumColsDiag(plan) = hypre_CSRMatrixNumCols(C_diag);
+   hypre_ParCSRTMatMatPlanNumColsOffd(plan) = num_cols_offd_C;
+   hypre_ParCSRTMatMatPlanNnzADiag(plan)    = hypre_CSRMatrixNumNonzeros(A_diag);
+   hypre_ParCSRTMatMatPlanNnzAOffd(plan)    = hypre_CSRMatrixNumNonzeros(A_offd);
+   hypre_ParCSRTMatMatPlanNnzBDiag(plan)    = hypre_CSRMatrixNumNonzeros(B_diag);
+   hypre_ParCSRTMatMatPlanNnzBOffd(plan)    = hypre_CSRMatrixNumNonzeros(B_offd);
+   hypre_ParCSRTMatMatPlanNnzCDiag(plan)    = hypre_CSRMatrixNumNonzeros(C_diag);
+   hypre_ParCSRTMatMatPlanNnzCOffd(plan)    = hypre_CSRMatrixNumNonzeros(C_offd);
+
+   if (num_missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Inconsistent column maps in product plan!\n");
+      hypre_ParCSRTMatMatPlanDestroy(plan);
+      plan = NULL;
+   }
+
+   *plan_ptr = plan;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatNumeric
+ *
+ * Recomputes the values of C = A^T * B in place, where C was returned by
+ * hypre_ParCSRTMatMatSetup together with plan and the patterns of A and B
+ * have not changed since.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTMatMatNumeric( hypre_ParCSRTMatMatPlan *plan,
+                            hypre_ParCSRMatrix      *A,
+                            hypre_ParCSRMatrix      *B,
+                            hypre_ParCSRMatrix      *C )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag      = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd      = hypre_ParCSRMatrixOffd(B);
+   hypre_CSRMatrix        *C_diag      = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd      = hypre_ParCSRMatrixOffd(C);
+
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               num_rows;
+   HYPRE_Int               num_cols_diag;
+   HYPRE_Int               num_cols_offd;
+   HYPRE_Int              *map_B_to_C;
+
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   num_rows      = hypre_ParCSRTMatMatPlanNumRows(plan);
+   num_cols_diag = hypre_ParCSRTMatMatPlanNumColsDiag(plan);
+   num_cols_offd = hypre_ParCSRTMatMatPlanNumColsOffd(plan);
+   map_B_to_C    = hypre_ParCSRTMatMatPlanMapBToC(plan);
+   comm_pkg      = hypre_ParCSRTMatMatPlanCommPkg(plan);
+
+   if (hypre_CSRMatrixNumNonzeros(A_diag) != hypre_ParCSRTMatMatPlanNnzADiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(A_offd) != hypre_ParCSRTMatMatPlanNnzAOffd(plan) ||
+       hypre_CSRMatrixNumNonzeros(B_diag) != hypre_ParCSRTMatMatPlanNnzBDiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(B_offd) != hypre_ParCSRTMatMatPlanNnzBOffd(plan) ||
+       hypre_CSRMatrixNumNonzeros(C_diag) != hypre_ParCSRTMatMatPlanNnzCDiag(plan) ||
+       hypre_CSRMatrixNumNonzeros(C_offd) != hypre_ParCSRTMatMatPlanNnzCOffd(plan) ||
+       hypre_CSRMatrixNumRows(C_diag) != num_rows ||
+       hypre_CSRMatrixNumCols(C_offd) != num_cols_offd)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrices do not match the product plan!\n");
+      return hypre_error_flag;
+   }
+
+   /* the SELL-C-sigma layouts of C refer to the old values */
+   hypre_CSRMatrixSellDestroy(C_diag);
+   hypre_CSRMatrixSellDestroy(C_offd);
+
+   /* compute A_offd^T * B and start sending it to the owners */
+   if (comm_pkg)
+   {
+      HYPRE_Int       num_int_rows = hypre_ParCSRTMatMatPlanNumIntRows(plan);
+      HYPRE_Int       num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+      HYPRE_Int       num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+      HYPRE_Complex  *int_data = hypre_ParCSRTMatMatPlanIntData(plan);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel
+#endif
+      {
+         HYPRE_Int      *AT_offd_i   = hypre_ParCSRTMatMatPlanATOffdI(plan);
+         HYPRE_Int      *AT_offd_j   = hypre_ParCSRTMatMatPlanATOffdJ(plan);
+         HYPRE_Int      *AT_offd_p   = hypre_ParCSRTMatMatPlanATOffdPerm(plan);
+         HYPRE_Int      *int_i       = hypre_ParCSRTMatMatPlanIntI(plan);
+         HYPRE_Int      *int_j       = hypre_ParCSRTMatMatPlanIntJ(plan);
+         HYPRE_Complex  *A_offd_data = hypre_CSRMatrixData(A_offd);
+         HYPRE_Int      *B_diag_i    = hypre_CSRMatrixI(B_diag);
+         HYPRE_Int      *B_diag_j    = hypre_CSRMatrixJ(B_diag);
+         HYPRE_Complex  *B_diag_data = hypre_CSRMatrixData(B_diag);
+         HYPRE_Int      *B_offd_i    = hypre_CSRMatrixI(B_offd);
+         HYPRE_Int      *B_offd_j    = hypre_CSRMatrixJ(B_offd);
+         HYPRE_Complex  *B_offd_data = hypre_CSRMatrixData(B_offd);
+         HYPRE_Int      *marker_diag;
+         HYPRE_Int      *marker_offd;
+         HYPRE_Complex   a;
+         HYPRE_Int       i, jj, kk, k, col, ns, ne;
+
+         marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag_B, HYPRE_MEMORY_HOST);
+         marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+
+         hypre_GetSimpleThreadPartition(&ns, &ne, num_int_rows);
+
+         for (i = ns; i < ne; i++)
+         {
+            for (jj = int_i[i]; jj < int_i[i + 1]; jj++)
+            {
+               col = int_j[jj];
+               if (col >= 0)
+               {
+                  marker_diag[col] = jj;
+               }
+               else
+               {
+                  marker_offd[-col - 1] = jj;
+               }
+               int_data[jj] = 0.0;
+            }
+
+            for (jj = AT_offd_i[i]; jj < AT_offd_i[i + 1]; jj++)
+            {
+               k = AT_offd_j[jj];
+               a = A_offd_data[AT_offd_p[jj]];
+               for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+               {
+                  int_data[marker_diag[B_diag_j[kk]]] += a * B_diag_data[kk];
+               }
+               for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+               {
+                  int_data[marker_offd[B_offd_j[kk]]] += a * B_offd_data[kk];
+               }
+            }
+         }
+
+         hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+         hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, int_data,
+                                                 hypre_ParCSRTMatMatPlanRecvData(plan));
+   }
+
+   /* C = A_diag^T * B, overlapped with communication */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      *AT_diag_i   = hypre_ParCSRTMatMatPlanATDiagI(plan);
+      HYPRE_Int      *AT_diag_j   = hypre_ParCSRTMatMatPlanATDiagJ(plan);
+      HYPRE_Int      *AT_diag_p   = hypre_ParCSRTMatMatPlanATDiagPerm(plan);
+      HYPRE_Complex  *A_diag_data = hypre_CSRMatrixData(A_diag);
+      HYPRE_Complex  *C_diag_data = hypre_CSRMatrixData(C_diag);
+      HYPRE_Complex  *C_offd_data = hypre_CSRMatrixData(C_offd);
+      HYPRE_Int      *marker_diag;
+      HYPRE_Int      *marker_offd;
+      HYPRE_Int       i, jj, ns, ne;
+
+      marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_diag, HYPRE_MEMORY_HOST);
+      marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_diag; i++)
+      {
+         marker_diag[i] = -1;
+      }
+      for (i = 0; i < num_cols_offd; i++)
+      {
+         marker_offd[i] = -1;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      for (i = ns; i < ne; i++)
+      {
+         hypre_ParCSRPlanMarkRow(i, C_diag, C_offd, marker_diag, marker_offd, 1);
+         for (jj = AT_diag_i[i]; jj < AT_diag_i[i + 1]; jj++)
+         {
+            hypre_ParCSRPlanAddRowProduct(A_diag_data[AT_diag_p[jj]], AT_diag_j[jj],
+                                          B_diag, B_offd, map_B_to_C,
+                                          marker_diag, marker_offd,
+                                          C_diag_data, C_offd_data);
+         }
+         hypre_ParCSRPlanUnmarkRow(i, C_diag, C_offd, marker_diag, marker_offd);
+      }
+
+      hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+   }
+
+   /* add the rows received from the neighbors */
+   if (comm_pkg)
+   {
+      HYPRE_Int      *recv_i      = hypre_ParCSRTMatMatPlanRecvI(plan);
+      HYPRE_Int      *recv_pos    = hypre_ParCSRTMatMatPlanRecvPos(plan);
+      HYPRE_Complex  *recv_data   = hypre_ParCSRTMatMatPlanRecvData(plan);
+      HYPRE_Complex  *C_diag_data = hypre_CSRMatrixData(C_diag);
+      HYPRE_Complex  *C_offd_data = hypre_CSRMatrixData(C_offd);
+      HYPRE_Int       i, jj, pos;
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (i = 0; i < hypre_ParCSRTMatMatPlanNumRecvRows(plan); i++)
+      {
+         for (jj = recv_i[i]; jj < recv_i[i + 1]; jj++)
+         {
+            pos = recv_pos[jj];
+            if (pos >= 0)
+            {
+               C_diag_data[pos] += recv_data[jj];
+            }
+            else
+            {
+               C_offd_data[-pos - 1] += recv_data[jj];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRMatMatPlanDestroy(hypre_ParCSRRAPPlanAPPlan(plan));
+      hypre_ParCSRMatrixDestroy(hypre_ParCSRRAPPlanAP(plan));
+      hypre_ParCSRTMatMatPlanDestroy(hypre_ParCSRRAPPlanRAPPlan(plan));
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTSetup
+ *
+ * Computes C = R^T * A * P as R^T * (A * P) and returns in plan_ptr the data
+ * needed to recompute the values of C with hypre_ParCSRMatrixRAPKTNumeric.
+ * As in hypre_ParCSRMatrixRAPKT, the communication package of C is created.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTSetup( hypre_ParCSRMatrix   *R,
+                              hypre_ParCSRMatrix   *A,
+                              hypre_ParCSRMatrix   *P,
+                              hypre_ParCSRRAPPlan **plan_ptr )
+{
+   hypre_ParCSRMatMatPlan  *AP_plan  = NULL;
+   hypre_ParCSRTMatMatPlan *RAP_plan = NULL;
+   hypre_ParCSRRAPPlan     *plan;
+   hypre_ParCSRMatrix      *AP;
+   hypre_ParCSRMatrix      *C;
+   HYPRE_Int                num_procs;
+
+   *plan_ptr = NULL;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(R),
+                                                      hypre_ParCSRMatrixMemoryLocation(A) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      return hypre_ParCSRMatrixRAPKT(R, A, P, 0);
+   }
+#endif
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   AP = hypre_ParCSRMatMatSetup(A, P, &AP_plan);
+   C  = hypre_ParCSRTMatMatSetup(R, AP, &RAP_plan);
+
+   if (AP_plan && RAP_plan)
+   {
+      plan = hypre_TAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRRAPPlanAPPlan(plan)  = AP_plan;
+      hypre_ParCSRRAPPlanAP(plan)      = AP;
+      hypre_ParCSRRAPPlanRAPPlan(plan) = RAP_plan;
+      *plan_ptr = plan;
+   }
+   else
+   {
+      hypre_ParCSRMatMatPlanDestroy(AP_plan);
+      hypre_ParCSRTMatMatPlanDestroy(RAP_plan);
+      hypre_ParCSRMatrixDestroy(AP);
+   }
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+   if (C && num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(C);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTNumeric
+ *
+ * Recomputes the values of C = R^T * A * P in place, where C was returned by
+ * hypre_ParCSRMatrixRAPKTSetup together with plan and the patterns of R, A
+ * and P have not changed since.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPKTNumeric( hypre_ParCSRRAPPlan *plan,
+                                hypre_ParCSRMatrix  *R,
+                                hypre_ParCSRMatrix  *A,
+                                hypre_ParCSRMatrix  *P,
+                                hypre_ParCSRMatrix  *C )
+{
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_ParCSRMatMatNumeric(hypre_ParCSRRAPPlanAPPlan(plan), A, P,
+                             hypre_ParCSRRAPPlanAP(plan));
+   hypre_ParCSRTMatMatNumeric(hypre_ParCSRRAPPlanRAPPlan(plan), R,
+                              hypre_ParCSRRAPPlanAP(plan), C);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Cached plans for repeated ParCSR matrix products
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PAR_CSR_MATMAT_PLAN_HEADER
+#define hypre_PAR_CSR_MATMAT_PLAN_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Symbolic data of C = A * B. The external rows of B needed by A_offd are
+ * kept with their column indices already mapped to the local columns of C
+ * (nonnegative: column of C_diag, negative: column -(k+1) of C_offd), so a
+ * numeric product only has to exchange the values of those rows.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* element-wise communication package for the values of the external rows */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_send_rows;
+   HYPRE_Int            *send_rows;
+   HYPRE_Complex        *send_data;
+
+   /* external rows of B (one per column of A_offd) */
+   HYPRE_Int             num_ext_rows;
+   HYPRE_Int            *ext_i;
+   HYPRE_Int            *ext_j;
+   HYPRE_Complex        *ext_data;
+
+   /* maps columns of B_offd to columns of C_offd */
+   HYPRE_Int            *map_B_to_C;
+
+   /* sizes used to check that the operands still match the plan */
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_diag;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             nnz_A_diag;
+   HYPRE_Int             nnz_A_offd;
+   HYPRE_Int             nnz_B_diag;
+   HYPRE_Int             nnz_B_offd;
+   HYPRE_Int             nnz_C_diag;
+   HYPRE_Int             nnz_C_offd;
+
+} hypre_ParCSRMatMatPlan;
+
+#define hypre_ParCSRMatMatPlanCommPkg(plan)       ((plan) -> comm_pkg)
+#define hypre_ParCSRMatMatPlanNumSendRows(plan)   ((plan) -> num_send_rows)
+#define hypre_ParCSRMatMatPlanSendRows(plan)      ((plan) -> send_rows)
+#define hypre_ParCSRMatMatPlanSendData(plan)      ((plan) -> send_data)
+#define hypre_ParCSRMatMatPlanNumExtRows(plan)    ((plan) -> num_ext_rows)
+#define hypre_ParCSRMatMatPlanExtI(plan)          ((plan) -> ext_i)
+#define hypre_ParCSRMatMatPlanExtJ(plan)          ((plan) -> ext_j)
+#define hypre_ParCSRMatMatPlanExtData(plan)       ((plan) -> ext_data)
+#define hypre_ParCSRMatMatPlanMapBToC(plan)       ((plan) -> map_B_to_C)
+#define hypre_ParCSRMatMatPlanNumRows(plan)       ((plan) -> num_rows)
+#define hypre_ParCSRMatMatPlanNumColsDiag(plan)   ((plan) -> num_cols_diag)
+#define hypre_ParCSRMatMatPlanNumColsOffd(plan)   ((plan) -> num_cols_offd)
+#define hypre_ParCSRMatMatPlanNnzADiag(plan)      ((plan) -> nnz_A_diag)
+#define hypre_ParCSRMatMatPlanNnzAOffd(plan)      ((plan) -> nnz_A_offd)
+#define hypre_ParCSRMatMatPlanNnzBDiag(plan)      ((plan) -> nnz_B_diag)
+#define hypre_ParCSRMatMatPlanNnzBOffd(plan)      ((plan) -> nnz_B_offd)
+#define hypre_ParCSRMatMatPlanNnzCDiag(plan)      ((plan) -> nnz_C_diag)
+#define hypre_ParCSRMatMatPlanNnzCOffd(plan)      ((plan) -> nnz_C_offd)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatPlan
+ *
+ * Symbolic data of C = A^T * B. The transposes of A_diag and A_offd are kept
+ * as patterns plus the position of each entry in A, the rows of A_offd^T * B
+ * that are added to other processors are kept with columns in the local
+ * numbering of B (same encoding as above), and the received rows are kept
+ * as positions into C_diag (nonnegative) or C_offd (-(k+1)).
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* transposed patterns of A_diag and A_offd */
+   HYPRE_Int            *AT_diag_i;
+   HYPRE_Int            *AT_diag_j;
+   HYPRE_Int            *AT_diag_perm;
+   HYPRE_Int            *AT_offd_i;
+   HYPRE_Int            *AT_offd_j;
+   HYPRE_Int            *AT_offd_perm;
+
+   /* rows of A_offd^T * B sent to their owners */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_int_rows;
+   HYPRE_Int            *int_i;
+   HYPRE_Int            *int_j;
+   HYPRE_Complex        *int_data;
+
+   /* received rows, added to the rows of C given by the send map of A */
+   HYPRE_Int             num_recv_rows;
+   HYPRE_Int            *recv_i;
+   HYPRE_Int            *recv_pos;
+   HYPRE_Complex        *recv_data;
+
+   /* maps columns of B_offd to columns of C_offd */
+   HYPRE_Int            *map_B_to_C;
+
+   /* sizes used to check that the operands still match the plan */
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_cols_diag;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             nnz_A_diag;
+   HYPRE_Int             nnz_A_offd;
+   HYPRE_Int             nnz_B_diag;
+   HYPRE_Int             nnz_B_offd;
+   HYPRE_Int             nnz_C_diag;
+   HYPRE_Int             nnz_C_offd;
+
+} hypre_ParCSRTMatMatPlan;
+
+#define hypre_ParCSRTMatMatPlanATDiagI(plan)      ((plan) -> AT_diag_i)
+#define hypre_ParCSRTMatMatPlanATDiagJ(plan)      ((plan) -> AT_diag_j)
+#define hypre_ParCSRTMatMatPlanATDiagPerm(plan)   ((plan) -> AT_diag_perm)
+#define hypre_ParCSRTMatMatPlanATOffdI(plan)      ((plan) -> AT_offd_i)
+#define hypre_ParCSRTMatMatPlanATOffdJ(plan)      ((plan) -> AT_offd_j)
+#define hypre_ParCSRTMatMatPlanATOffdPerm(plan)   ((plan) -> AT_offd_perm)
+#define hypre_ParCSRTMatMatPlanCommPkg(plan)      ((plan) -> comm_pkg)
+#define hypre_ParCSRTMatMatPlanNumIntRows(plan)   ((plan) -> num_int_rows)
+#define hypre_ParCSRTMatMatPlanIntI(plan)         ((plan) -> int_i)
+#define hypre_ParCSRTMatMatPlanIntJ(plan)         ((plan) -> int_j)
+#define hypre_ParCSRTMatMatPlanIntData(plan)      ((plan) -> int_data)
+#define hypre_ParCSRTMatMatPlanNumRecvRows(plan)  ((plan) -> num_recv_rows)
+#define hypre_ParCSRTMatMatPlanRecvI(plan)        ((plan) -> recv_i)
+#define hypre_ParCSRTMatMatPlanRecvPos(plan)      ((plan) -> recv_pos)
+#define hypre_ParCSRTMatMatPlanRecvData(plan)     ((plan) -> recv_data)
+#define hypre_ParCSRTMatMatPlanMapBToC(plan)      ((plan) -> map_B_to_C)
+#define hypre_ParCSRTMatMatPlanNumRows(plan)      ((plan) -> num_rows)
+#define hypre_ParCSRTMatMatPlanNumColsDiag(plan)  ((plan) -> num_cols_diag)
+#define hypre_ParCSRTMatMatPlanNumColsOffd(plan)  ((plan) -> num_cols_offd)
+#define hypre_ParCSRTMatMatPlanNnzADiag(plan)     ((plan) -> nnz_A_diag)
+#define hypre_ParCSRTMatMatPlanNnzAOffd(plan)     ((plan) -> nnz_A_offd)
+#define hypre_ParCSRTMatMatPlanNnzBDiag(plan)     ((plan) -> nnz_B_diag)
+#define hypre_ParCSRTMatMatPlanNnzBOffd(plan)     ((plan) -> nnz_B_offd)
+#define hypre_ParCSRTMatMatPlanNnzCDiag(plan)     ((plan) -> nnz_C_diag)
+#define hypre_ParCSRTMatMatPlanNnzCOffd(plan)     ((plan) -> nnz_C_offd)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlan
+ *
+ * Plan for C = R^T * A * P, computed as R^T * (A * P). The intermediate
+ * product A * P is kept so that its values can be refreshed in place.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatMatPlan   *AP_plan;
+   hypre_ParCSRMatrix       *AP;
+   hypre_ParCSRTMatMatPlan  *RAP_plan;
+
+} hypre_ParCSRRAPPlan;
+
+#define hypre_ParCSRRAPPlanAPPlan(plan)           ((plan) -> AP_plan)
+#define hypre_ParCSRRAPPlanAP(plan)               ((plan) -> AP)
+#define hypre_ParCSRRAPPlanRAPPlan(plan)          ((plan) -> RAP_plan)
+
+#endif
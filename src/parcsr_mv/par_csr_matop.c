@@ -4167,6 +4167,110 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BdiagInvMatvecFixed
+ *
+ * Kernel of hypre_BdiagInvMatvec.  Called with a literal block size, so that
+ * the block loops are unrolled and vectorized by the compiler.  The smoothers
+ * also call it per block (num_blocks = 1), so the block loop only forks a
+ * thread team when there are enough blocks to pay for it.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_BDIAGINV_OMP_MIN_BLOCKS 64
+
+static inline void
+hypre_BdiagInvMatvecFixed( HYPRE_Int            num_blocks,
+                           const HYPRE_Int      bs,
+                           HYPRE_Complex        alpha,
+                           const HYPRE_Complex *bdiaginv,
+                           const HYPRE_Complex *x,
+                           HYPRE_Complex        beta,
+                           HYPRE_Complex       *y )
+{
+   HYPRE_Int i, r, c;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,r,c) HYPRE_SMP_SCHEDULE \
+   if (num_blocks > HYPRE_BDIAGINV_OMP_MIN_BLOCKS)
+#endif
+   for (i = 0; i < num_blocks; i++)
+   {
+      const HYPRE_Complex *inv = bdiaginv + i * bs * bs;
+      const HYPRE_Complex *xb  = x + i * bs;
+      HYPRE_Complex       *yb  = y + i * bs;
+      HYPRE_Complex        t[8];
+
+      for (r = 0; r < bs; r++)
+      {
+         t[r] = 0.0;
+      }
+      for (c = 0; c < bs; c++)
+      {
+         for (r = 0; r < bs; r++)
+         {
+            t[r] += inv[r * bs + c] * xb[c];
+         }
+      }
+      for (r = 0; r < bs; r++)
+      {
+         yb[r] = (beta == 0.0) ? alpha * t[r] : alpha * t[r] + beta * yb[r];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BdiagInvMatvec
+ *
+ * y = alpha * B^{-1} x + beta * y, where B^{-1} is a block diagonal matrix
+ * given by num_blocks contiguous row-major blocks of size blk_size.  Block
+ * sizes 2 to 8 use kernels specialized to the block size.  x and y must not
+ * overlap.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BdiagInvMatvec( HYPRE_Int      num_blocks,
+                      HYPRE_Int      blk_size,
+                      HYPRE_Complex  alpha,
+                      HYPRE_Complex *bdiaginv,
+                      HYPRE_Complex *x,
+                      HYPRE_Complex  beta,
+                      HYPRE_Complex *y )
+{
+   HYPRE_Int      bs2 = blk_size * blk_size;
+   HYPRE_Int      i, r, c;
+   HYPRE_Complex  t;
+
+   switch (blk_size)
+   {
+      case 2: hypre_BdiagInvMatvecFixed(num_blocks, 2, alpha, bdiaginv, x, beta, y); break;
+      case 3: hypre_BdiagInvMatvecFixed(num_blocks, 3, alpha, bdiaginv, x, beta, y); break;
+      case 4: hypre_BdiagInvMatvecFixed(num_blocks, 4, alpha, bdiaginv, x, beta, y); break;
+      case 5: hypre_BdiagInvMatvecFixed(num_blocks, 5, alpha, bdiaginv, x, beta, y); break;
+      case 6: hypre_BdiagInvMatvecFixed(num_blocks, 6, alpha, bdiaginv, x, beta, y); break;
+      case 7: hypre_BdiagInvMatvecFixed(num_blocks, 7, alpha, bdiaginv, x, beta, y); break;
+      case 8: hypre_BdiagInvMatvecFixed(num_blocks, 8, alpha, bdiaginv, x, beta, y); break;
+
+      default:
+         /* generic path, also used for blk_size = 1 */
+         for (i = 0; i < num_blocks; i++)
+         {
+            for (r = 0; r < blk_size; r++)
+            {
+               t = 0.0;
+               for (c = 0; c < blk_size; c++)
+               {
+                  t += bdiaginv[i * bs2 + r * blk_size + c] * x[i * blk_size + c];
+               }
+               y[i * blk_size + r] = (beta == 0.0) ? alpha * t :
+                                     alpha * t + beta * y[i * blk_size + r];
+            }
+         }
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParvecBdiagInvScal
  *--------------------------------------------------------------------------*/
@@ -4232,7 +4336,19 @@ hypre_ParvecBdiagInvScal( hypre_ParVector     *b,
    /* ... */
    hypre_ParCSRCommHandleDestroy(comm_handle);
 
-   for (block_start = first_row_block; block_start < end_row_block; block_start += blockSize)
+   /* whole local blocks are applied at once */
+   block_start = first_row_block;
+   if (first_row_block == first_row)
+   {
+      HYPRE_Int num_whole_blocks = (HYPRE_Int)((end_row - first_row) / (HYPRE_BigInt)blockSize);
+
+      hypre_BdiagInvMatvec(num_whole_blocks, blockSize, 1.0, dense, b_local_data,
+                           0.0, bnew_local_data);
+      block_start += (HYPRE_BigInt)num_whole_blocks * (HYPRE_BigInt)blockSize;
+      dense += num_whole_blocks * blockSize * blockSize;
+   }
+
+   for (; block_start < end_row_block; block_start += blockSize)
    {
       HYPRE_BigInt big_i;
       block_end = hypre_min(block_start + (HYPRE_BigInt)blockSize, nrow_global);
@@ -4252,7 +4368,7 @@ hypre_ParvecBdiagInvScal( hypre_ParVector     *b,
          for (j = 0; j < s; j++)
          {
             HYPRE_BigInt global_rid = block_start + (HYPRE_BigInt)j;
-            HYPRE_Complex val = dense[block_i + j * blockSize];
+            HYPRE_Complex val = dense[block_i * blockSize + j];
             if (val == 0.0)
             {
                continue;
@@ -4887,7 +5003,20 @@ hypre_ParcsrBdiagInvScal( hypre_ParCSRMatrix   *A,
       hypre_TFree(dense_all, HYPRE_MEMORY_HOST);
    }
    */
-   /* save diagonal blocks in A */
+   /* save diagonal blocks in A, row-major as expected by hypre_BdiagInvMatvec */
+   for (k = 0; k < num_blocks; k++)
+   {
+      dense = dense_all + k * blockSize * blockSize;
+      for (i = 0; i < blockSize; i++)
+      {
+         for (j = i + 1; j < blockSize; j++)
+         {
+            HYPRE_Complex t = dense[j + i * blockSize];
+            dense[j + i * blockSize] = dense[i + j * blockSize];
+            dense[i + j * blockSize] = t;
+         }
+      }
+   }
    A->bdiag_size = blockSize;
    A->bdiaginv = dense_all;
 
@@ -6282,6 +6411,10 @@ hypre_ParCSRMatrixDiagScaleHost( hypre_ParCSRMatrix *par_A,
    hypre_Vector          *rdbuf;
    HYPRE_Complex         *recv_rdbuf_data;
    HYPRE_Complex         *send_rdbuf_data;
+   HYPRE_Int              persistent = hypre_HandleParCSRPersistentComm(hypre_handle());
+
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
 
    /*---------------------------------------------------------------------
     * Communication phase
@@ -6300,28 +6433,29 @@ hypre_ParCSRMatrixDiagScaleHost( hypre_ParCSRMatrix *par_A,
    send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
    send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandle *comm_handle =
-      hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-
-   hypre_VectorData(rdbuf) = (HYPRE_Complex *)
-                             hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
-   hypre_SeqVectorSetDataOwner(rdbuf, 0);
+   if (persistent)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
 
-#else
-   hypre_ParCSRCommHandle *comm_handle;
-#endif
+      hypre_VectorData(rdbuf) = (HYPRE_Complex *)
+                                hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(rdbuf, 0);
+   }
 
    /* Initialize rdbuf */
    hypre_SeqVectorInitialize_v2(rdbuf, HYPRE_MEMORY_HOST);
    recv_rdbuf_data = hypre_VectorData(rdbuf);
 
    /* Allocate send buffer for rdbuf */
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   send_rdbuf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
-#else
-   send_rdbuf_data = hypre_TAlloc(HYPRE_Complex, send_map_starts[num_sends], HYPRE_MEMORY_HOST);
-#endif
+   if (persistent)
+   {
+      send_rdbuf_data = (HYPRE_Complex *)
+                        hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      send_rdbuf_data = hypre_TAlloc(HYPRE_Complex, send_map_starts[num_sends], HYPRE_MEMORY_HOST);
+   }
 
    /* Pack send data */
 #if defined(HYPRE_USING_OPENMP)
@@ -6333,14 +6467,17 @@ hypre_ParCSRMatrixDiagScaleHost( hypre_ParCSRMatrix *par_A,
    }
 
    /* Non-blocking communication starts */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, send_rdbuf_data);
-
-#else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
-                                                 HYPRE_MEMORY_HOST, send_rdbuf_data,
-                                                 HYPRE_MEMORY_HOST, recv_rdbuf_data);
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                            send_rdbuf_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, send_rdbuf_data,
+                                                    HYPRE_MEMORY_HOST, recv_rdbuf_data);
+   }
 
    /*---------------------------------------------------------------------
     * Computation phase
@@ -6350,20 +6487,25 @@ hypre_ParCSRMatrixDiagScaleHost( hypre_ParCSRMatrix *par_A,
    hypre_CSRMatrixDiagScale(A_diag, ld, rd);
 
    /* Non-blocking communication ends */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, recv_rdbuf_data);
-#else
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST,
+                                           recv_rdbuf_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
 
    /* A_offd = diag(ld) * A_offd * diag(rd) */
    hypre_CSRMatrixDiagScale(A_offd, ld, rdbuf);
 
    /* Free memory */
    hypre_SeqVectorDestroy(rdbuf);
-#if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(send_rdbuf_data, HYPRE_MEMORY_HOST);
-#endif
+   if (!persistent)
+   {
+      hypre_TFree(send_rdbuf_data, HYPRE_MEMORY_HOST);
+   }
 
    return hypre_error_flag;
 }
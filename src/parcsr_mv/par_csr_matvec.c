@@ -15,6 +15,9 @@
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecOutOfPlaceHost
+ *
+ * If y_norm2 is not NULL, the local squared 2-norm of y is also computed,
+ * fused with the last pass over y (single vectors only).
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -23,7 +26,8 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
                                         hypre_ParVector    *x,
                                         HYPRE_Complex       beta,
                                         hypre_ParVector    *b,
-                                        hypre_ParVector    *y )
+                                        hypre_ParVector    *y,
+                                        HYPRE_Real         *y_norm2 )
 {
    hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
 
@@ -52,6 +56,11 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    HYPRE_Complex           *x_tmp_data;
    HYPRE_Complex           *x_buf_data;
 
+   /* persistent MPI requests cached in the comm pkg (see HYPRE_SetParCSRPersistentComm) */
+   HYPRE_Int                         persistent = hypre_HandleParCSRPersistentComm(hypre_handle());
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    /*---------------------------------------------------------------------
@@ -121,23 +130,22 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle =
-      hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#else
-   hypre_ParCSRCommHandle *comm_handle;
-#endif
+   if (persistent)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+   }
 
    /*---------------------------------------------------------------------
     * Allocate (during hypre_SeqVectorInitialize_v2) or retrieve
     * persistent receive data buffer for x_tmp (if persistent is enabled).
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_VectorData(x_tmp) = (HYPRE_Complex *)
-                             hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-   hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
+   if (persistent)
+   {
+      hypre_VectorData(x_tmp) = (HYPRE_Complex *)
+                                hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(x_tmp, 0);
+   }
 
    hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
    x_tmp_data = hypre_VectorData(x_tmp);
@@ -146,14 +154,16 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
     * Allocate data send buffer
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-
-#else
-   x_buf_data = hypre_TAlloc(HYPRE_Complex,
-                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                             HYPRE_MEMORY_HOST);
-#endif
+   if (persistent)
+   {
+      x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   }
 
    /* The assert is because this code has been tested for column-wise vector storage only. */
    hypre_assert(idxstride == 1);
@@ -178,32 +188,45 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication starts */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle,
-                                         HYPRE_MEMORY_HOST, x_buf_data);
-#else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
-                                                 HYPRE_MEMORY_HOST, x_buf_data,
-                                                 HYPRE_MEMORY_HOST, x_tmp_data);
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle,
+                                            HYPRE_MEMORY_HOST, x_buf_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, x_buf_data,
+                                                    HYPRE_MEMORY_HOST, x_tmp_data);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
 #endif
 
    /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+   if (y_norm2 && !num_cols_offd)
+   {
+      hypre_CSRMatrixMatvecNorm2Host(alpha, diag, x_local, beta, b_local, y_local, y_norm2);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
    /* Non-blocking communication ends */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, x_tmp_data);
-#else
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, x_tmp_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -212,7 +235,14 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    /* computation offd part */
    if (num_cols_offd)
    {
-      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+      if (y_norm2)
+      {
+         hypre_CSRMatrixMatvecNorm2Host(alpha, offd, x_tmp, 1.0, y_local, y_local, y_norm2);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+      }
    }
 
    /*---------------------------------------------------------------------
@@ -220,15 +250,48 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
     *--------------------------------------------------------------------*/
    hypre_SeqVectorDestroy(x_tmp);
 
-#if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
-#endif
+   if (!persistent)
+   {
+      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   }
 
    HYPRE_ANNOTATE_FUNC_END;
 
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixProfileSpMV
+ *
+ * Charge the work of num_products products with the local part of A and
+ * num_vectors vectors to the open profiler regions (see utilities/profile.c).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixProfileSpMV( hypre_ParCSRMatrix *A,
+                               HYPRE_Int           num_vectors,
+                               HYPRE_Int           num_products )
+{
+   hypre_CSRMatrix *A_diag;
+   hypre_CSRMatrix *A_offd;
+   HYPRE_Real       count = (HYPRE_Real) num_products;
+
+   if (!hypre_ProfileActive() || !A)
+   {
+      return hypre_error_flag;
+   }
+
+   A_diag = hypre_ParCSRMatrixDiag(A);
+   A_offd = hypre_ParCSRMatrixOffd(A);
+
+   return hypre_ProfileAddSpMV(count * (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(A_diag) +
+                                                     hypre_CSRMatrixNumNonzeros(A_offd)),
+                               count * (HYPRE_Real) hypre_CSRMatrixNumRows(A_diag),
+                               count * (HYPRE_Real) (hypre_CSRMatrixNumCols(A_diag) +
+                                                     hypre_CSRMatrixNumCols(A_offd)),
+                               num_vectors);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecOutOfPlace
  *
@@ -256,9 +319,11 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    else
 #endif
    {
-      ierr = hypre_ParCSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y);
+      ierr = hypre_ParCSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, NULL);
    }
 
+   hypre_ParCSRMatrixProfileSpMV(A, hypre_ParVectorNumVectors(x), 1);
+
    return ierr;
 }
 
@@ -278,6 +343,111 @@ hypre_ParCSRMatrixMatvec( HYPRE_Complex       alpha,
    return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecNorm2Begin
+ *
+ * Performs y <- alpha * A * x + beta * b together with the local part of
+ * <y,y>, and starts a non-blocking global reduction of the latter into
+ * y_norm2. With alpha = -1 and beta = 1, this is the residual b - A*x and
+ * its squared norm. On the host, the local norm is fused with the last pass
+ * of the matvec over y. The reduction must be completed with
+ * hypre_ParCSRMatrixMatvecNorm2End before y_norm2 is used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecNorm2Begin( HYPRE_Complex       alpha,
+                                    hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *x,
+                                    HYPRE_Complex       beta,
+                                    hypre_ParVector    *b,
+                                    hypre_ParVector    *y,
+                                    HYPRE_Real         *y_norm2,
+                                    hypre_MPI_Request  *request )
+{
+   MPI_Comm      comm    = hypre_ParCSRMatrixComm(A);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(A),
+                                                      hypre_ParVectorMemoryLocation(x) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlaceDevice(alpha, A, x, beta, b, y);
+      hypre_ParCSRMatrixProfileSpMV(A, 1, 1);
+      *y_norm2 = hypre_SeqVectorInnerProd(y_local, y_local);
+   }
+   else
+#endif
+   if (hypre_VectorNumVectors(y_local) > 1 || x == y)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, b, y);
+      *y_norm2 = hypre_SeqVectorInnerProd(y_local, y_local);
+   }
+   else
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, y_norm2);
+      hypre_ParCSRMatrixProfileSpMV(A, 1, 1);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, y_norm2, 1, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecNorm2End
+ *
+ * Completes the reduction started by hypre_ParCSRMatrixMatvecNorm2Begin.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecNorm2End( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(request, &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecNorm2
+ *
+ * Blocking version of hypre_ParCSRMatrixMatvecNorm2Begin/End.
+ * Performs y <- alpha * A * x + beta * b and returns <y,y>.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParCSRMatrixMatvecNorm2( HYPRE_Complex       alpha,
+                               hypre_ParCSRMatrix *A,
+                               hypre_ParVector    *x,
+                               HYPRE_Complex       beta,
+                               hypre_ParVector    *b,
+                               hypre_ParVector    *y )
+{
+   HYPRE_Real        y_norm2;
+   hypre_MPI_Request request;
+
+   hypre_ParCSRMatrixMatvecNorm2Begin(alpha, A, x, beta, b, y, &y_norm2, &request);
+   hypre_ParCSRMatrixMatvecNorm2End(&request);
+
+   return y_norm2;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecTHost
  *--------------------------------------------------------------------------*/
@@ -316,6 +486,10 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
    HYPRE_Int                i;
    HYPRE_Int                ierr = 0;
 
+   HYPRE_Int                         persistent = hypre_HandleParCSRPersistentComm(hypre_handle());
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    /*---------------------------------------------------------------------
@@ -382,23 +556,22 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle =
-      hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#else
-   hypre_ParCSRCommHandle *comm_handle;
-#endif
+   if (persistent)
+   {
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
+   }
 
    /*---------------------------------------------------------------------
     * Allocate (during hypre_SeqVectorInitialize_v2) or retrieve
     * persistent send data buffer for y_tmp (if persistent is enabled).
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_VectorData(y_tmp) = (HYPRE_Complex *)
-                             hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-   hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
+   if (persistent)
+   {
+      hypre_VectorData(y_tmp) = (HYPRE_Complex *)
+                                hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(y_tmp, 0);
+   }
 
    hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
    y_tmp_data = hypre_VectorData(y_tmp);
@@ -407,14 +580,16 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
     * Allocate receive data buffer
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   y_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-
-#else
-   y_buf_data = hypre_TAlloc(HYPRE_Complex,
-                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                             HYPRE_MEMORY_HOST);
-#endif
+   if (persistent)
+   {
+      y_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
@@ -439,14 +614,16 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication starts */
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, y_tmp_data);
-
-#else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(2, comm_pkg,
-                                                 HYPRE_MEMORY_HOST, y_tmp_data,
-                                                 HYPRE_MEMORY_HOST, y_buf_data );
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, y_tmp_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(2, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, y_tmp_data,
+                                                    HYPRE_MEMORY_HOST, y_buf_data );
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -468,12 +645,15 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication ends */
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle,
-                                        HYPRE_MEMORY_HOST, y_buf_data);
-#else
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+   if (persistent)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle,
+                                           HYPRE_MEMORY_HOST, y_buf_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -496,9 +676,10 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
     *--------------------------------------------------------------------*/
    hypre_SeqVectorDestroy(y_tmp);
 
-#if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
-#endif
+   if (!persistent)
+   {
+      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   }
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -538,6 +719,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
       ierr = hypre_ParCSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
 
+   hypre_ParCSRMatrixProfileSpMV(A, hypre_ParVectorNumVectors(x), 1);
+
    return ierr;
 }
 
@@ -136,3 +136,120 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProd
+ *
+ * Computes result[i * ny + j] = <x[i], y[j]> for i < nx, j < ny with a
+ * single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProd( hypre_ParVector **x,
+                               HYPRE_Int         nx,
+                               hypre_ParVector **y,
+                               HYPRE_Int         ny,
+                               HYPRE_Int         unroll,
+                               HYPRE_Real       *result )
+{
+   MPI_Comm       comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Real    *local_result;
+   HYPRE_Int      i;
+   hypre_Vector **y_local;
+
+   y_local = hypre_TAlloc(hypre_Vector *, ny, HYPRE_MEMORY_HOST);
+   for (i = 0; i < ny; i++)
+   {
+      y_local[i] = hypre_ParVectorLocalVector(y[i]);
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nx * ny, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < nx; i++)
+   {
+      hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector(x[i]), y_local, ny, unroll,
+                                   &local_result[i * ny]);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, nx * ny, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(y_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorComponentInnerProd
+ *
+ * Computes result[k] = <x_k, y_k> for each component k of the
+ * multicomponent vectors x and y with a single global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorComponentInnerProd( hypre_ParVector *x,
+                                   hypre_ParVector *y,
+                                   HYPRE_Real      *result )
+{
+   MPI_Comm    comm        = hypre_ParVectorComm(x);
+   HYPRE_Int   num_vectors = hypre_ParVectorNumVectors(x);
+   HYPRE_Real *local_result;
+
+   if (hypre_ParVectorNumVectors(y) != num_vectors)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Mismatching number of vector components");
+      return hypre_error_flag;
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   hypre_SeqVectorComponentInnerProd(hypre_ParVectorLocalVector(x),
+                                     hypre_ParVectorLocalVector(y), local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorComponentAxpy
+ *
+ * Computes y_k = y_k + alpha[k] * x_k for each component k.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorComponentAxpy( HYPRE_Complex   *alpha,
+                              hypre_ParVector *x,
+                              hypre_ParVector *y )
+{
+   return hypre_SeqVectorComponentAxpy(alpha, hypre_ParVectorLocalVector(x),
+                                       hypre_ParVectorLocalVector(y));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorComponentScale
+ *
+ * Computes y_k = alpha[k] * y_k for each component k.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorComponentScale( HYPRE_Complex   *alpha,
+                               hypre_ParVector *y )
+{
+   return hypre_SeqVectorComponentScale(alpha, hypre_ParVectorLocalVector(y));
+}
@@ -268,6 +268,25 @@ HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_c
                                         hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices,
                                         hypre_ParCSRCommPkg **extend_comm_pkg);
 
+/* par_csr_matmat_plan.c */
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSetup ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                              hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumeric ( hypre_ParCSRMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRTMatMatPlanDestroy ( hypre_ParCSRTMatMatPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRTMatMatSetup ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                               hypre_ParCSRTMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTMatMatNumeric ( hypre_ParCSRTMatMatPlan *plan, hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKTSetup ( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                                   hypre_ParCSRMatrix *P,
+                                                   hypre_ParCSRRAPPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPKTNumeric ( hypre_ParCSRRAPPlan *plan, hypre_ParCSRMatrix *R,
+                                           hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                           hypre_ParCSRMatrix *C );
+
 /* par_csr_matop.c */
 HYPRE_Int hypre_ParCSRMatrixScale(hypre_ParCSRMatrix *A, HYPRE_Complex scalar);
 void hypre_ParMatmul_RowSizes ( HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i,
@@ -363,7 +382,6 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
@@ -373,7 +391,6 @@ void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *com
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -382,6 +399,10 @@ HYPRE_Int hypre_ParcsrGetExternalRowsDeviceInit( hypre_ParCSRMatrix *A, HYPRE_In
                                                  HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
 hypre_CSRMatrix* hypre_ParcsrGetExternalRowsDeviceWait(void *vrequest);
 
+HYPRE_Int hypre_BdiagInvMatvec( HYPRE_Int num_blocks, HYPRE_Int blk_size, HYPRE_Complex alpha,
+                                HYPRE_Complex *bdiaginv, HYPRE_Complex *x, HYPRE_Complex beta,
+                                HYPRE_Complex *y );
+
 HYPRE_Int hypre_ParvecBdiagInvScal( hypre_ParVector *b, HYPRE_Int blockSize, hypre_ParVector **bs,
                                     hypre_ParCSRMatrix *A);
 
@@ -509,6 +530,17 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
+// y = alpha*A*x + beta*b and <y,y>
+HYPRE_Int hypre_ParCSRMatrixMatvecNorm2Begin ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                               hypre_ParVector *x, HYPRE_Complex beta,
+                                               hypre_ParVector *b, hypre_ParVector *y,
+                                               HYPRE_Real *y_norm2, hypre_MPI_Request *request );
+HYPRE_Int hypre_ParCSRMatrixMatvecNorm2End ( hypre_MPI_Request *request );
+HYPRE_Int hypre_ParCSRMatrixProfileSpMV ( hypre_ParCSRMatrix *A, HYPRE_Int num_vectors,
+                                          HYPRE_Int num_products );
+HYPRE_Real hypre_ParCSRMatrixMatvecNorm2 ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                           hypre_ParVector *x, HYPRE_Complex beta,
+                                           hypre_ParVector *b, hypre_ParVector *y );
 
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
@@ -578,6 +610,13 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( hypre_ParVector **x, HYPRE_Int nx, hypre_ParVector **y,
+                                         HYPRE_Int ny, HYPRE_Int unroll, HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorComponentInnerProd ( hypre_ParVector *x, hypre_ParVector *y,
+                                              HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorComponentAxpy ( HYPRE_Complex *alpha, hypre_ParVector *x,
+                                         hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorComponentScale ( HYPRE_Complex *alpha, hypre_ParVector *y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
@@ -652,6 +652,103 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Row accumulators for hypre_CSRMatrixMultiplyHost
+ *
+ * A dense marker array over the columns of B is used when it is small
+ * enough to stay in cache. For wider B, each row of C picks its accumulator
+ * from an upper bound on its number of nonzeros (the total length of the
+ * rows of B it touches): a row of A with a single nonzero copies the scaled
+ * row of B, a row with a small bound uses an open-addressing hash table
+ * sized to the bound, and the remaining rows use the dense marker array.
+ * All accumulators give the same column ordering and summation order.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SPGEMM_HOST_DENSE        0
+#define HYPRE_SPGEMM_HOST_HASH         1
+#define HYPRE_SPGEMM_HOST_COPY         2
+
+/* thresholds are set with HYPRE_SetSpGemmHostAccumulator */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHostRowAlgo( HYPRE_Int row_nnz_A,
+                                    HYPRE_Int row_ub,
+                                    HYPRE_Int ncols_B,
+                                    HYPRE_Int dense_ncols,
+                                    HYPRE_Int hash_max )
+{
+   if (ncols_B <= dense_ncols)
+   {
+      return HYPRE_SPGEMM_HOST_DENSE;
+   }
+   else if (row_nnz_A == 1)
+   {
+      return HYPRE_SPGEMM_HOST_COPY;
+   }
+   else if (row_ub <= hash_max)
+   {
+      return HYPRE_SPGEMM_HOST_HASH;
+   }
+
+   return HYPRE_SPGEMM_HOST_DENSE;
+}
+
+/* smallest power of two that is at least twice the number of keys */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHostHashSize( HYPRE_Int num_keys )
+{
+   HYPRE_Int m = 16;
+
+   while (m < 2 * num_keys)
+   {
+      m <<= 1;
+   }
+
+   return m;
+}
+
+static inline void
+hypre_CSRMatrixMultiplyHostHashAlloc( HYPRE_Int   m,
+                                      HYPRE_Int  *hash_size,
+                                      HYPRE_Int **hash_key,
+                                      HYPRE_Int **hash_pos,
+                                      HYPRE_Int **hash_stamp )
+{
+   HYPRE_Int h;
+
+   if (m > *hash_size)
+   {
+      hypre_TFree(*hash_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(*hash_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(*hash_stamp, HYPRE_MEMORY_HOST);
+      *hash_key   = hypre_TAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+      *hash_pos   = hypre_TAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+      *hash_stamp = hypre_TAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+      for (h = 0; h < m; h++)
+      {
+         (*hash_stamp)[h] = -1;
+      }
+      *hash_size = m;
+   }
+}
+
+/* slot holding key in the current row (stamp), or the free slot for it */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHostHashSlot( HYPRE_Int *hash_key,
+                                     HYPRE_Int *hash_stamp,
+                                     HYPRE_Int  m,
+                                     HYPRE_Int  key,
+                                     HYPRE_Int  stamp )
+{
+   HYPRE_Int h = key & (m - 1);
+
+   while (hash_stamp[h] == stamp && hash_key[h] != key)
+   {
+      h = (h + 1) & (m - 1);
+   }
+
+   return h;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMultiplyHost
  *
@@ -695,6 +792,8 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    HYPRE_Complex         a_entry, b_entry;
    HYPRE_Int             allsquare = 0;
    HYPRE_Int            *twspace;
+   HYPRE_Int             dense_ncols = hypre_HandleSpGemmHostDenseNCols(hypre_handle());
+   HYPRE_Int             hash_max    = hypre_HandleSpGemmHostHashMax(hypre_handle());
 
    /* RL: TODO cannot guarantee, maybe should never assert
    hypre_assert(memory_location_A == memory_location_B);
@@ -735,20 +834,18 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 #endif
    {
       HYPRE_Int  *B_marker = NULL;
+      HYPRE_Int  *hash_key = NULL;
+      HYPRE_Int  *hash_pos = NULL;
+      HYPRE_Int  *hash_stamp = NULL;
+      HYPRE_Int   hash_size = 0;
       HYPRE_Int   ns, ne, ii, jj;
       HYPRE_Int   num_threads;
-      HYPRE_Int   i1, iic;
+      HYPRE_Int   i1, iic, diag, algo, row_ub, m, h;
 
       ii = hypre_GetThreadNum();
       num_threads = hypre_NumActiveThreads();
       hypre_partition1D(nnzrows_A, num_threads, ii, &ns, &ne);
 
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
-      for (ib = 0; ib < ncols_B; ib++)
-      {
-         B_marker[ib] = -1;
-      }
-
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
 
       /* First pass: compute sizes of C rows. */
@@ -757,30 +854,94 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       {
          if (rownnz_A)
          {
-            iic = rownnz_A[ic];
-            C_i[iic] = num_nonzeros;
+            iic  = rownnz_A[ic];
+            diag = 0;
          }
          else
          {
-            iic = ic;
-            C_i[iic] = num_nonzeros;
-            if (allsquare)
-            {
-               B_marker[iic] = iic;
-               num_nonzeros++;
-            }
+            iic  = ic;
+            diag = allsquare;
          }
+         C_i[iic] = num_nonzeros;
 
+         row_ub = 0;
          for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
          {
             ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+            row_ub += B_i[ja + 1] - B_i[ja];
+         }
+         algo = hypre_CSRMatrixMultiplyHostRowAlgo(A_i[iic + 1] - A_i[iic], row_ub, ncols_B,
+                                                   dense_ncols, hash_max);
+
+         if (algo == HYPRE_SPGEMM_HOST_COPY)
+         {
+            ja = A_j[A_i[iic]];
+            num_nonzeros += B_i[ja + 1] - B_i[ja];
+            if (diag)
             {
-               jb = B_j[ib];
-               if (B_marker[jb] != iic)
+               num_nonzeros++;
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
                {
-                  B_marker[jb] = iic;
-                  num_nonzeros++;
+                  if (B_j[ib] == iic)
+                  {
+                     num_nonzeros--;
+                  }
+               }
+            }
+         }
+         else if (algo == HYPRE_SPGEMM_HOST_HASH)
+         {
+            m = hypre_CSRMatrixMultiplyHostHashSize(row_ub + diag);
+            hypre_CSRMatrixMultiplyHostHashAlloc(m, &hash_size, &hash_key, &hash_pos, &hash_stamp);
+            if (diag)
+            {
+               h = hypre_CSRMatrixMultiplyHostHashSlot(hash_key, hash_stamp, m, iic, iic);
+               hash_stamp[h] = iic;
+               hash_key[h]   = iic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  h  = hypre_CSRMatrixMultiplyHostHashSlot(hash_key, hash_stamp, m, jb, iic);
+                  if (hash_stamp[h] != iic)
+                  {
+                     hash_stamp[h] = iic;
+                     hash_key[h]   = jb;
+                     num_nonzeros++;
+                  }
+               }
+            }
+         }
+         else
+         {
+            if (!B_marker)
+            {
+               B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+               for (ib = 0; ib < ncols_B; ib++)
+               {
+                  B_marker[ib] = -1;
+               }
+            }
+            if (diag)
+            {
+               B_marker[iic] = iic;
+               num_nonzeros++;
+            }
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  if (B_marker[jb] != iic)
+                  {
+                     B_marker[jb] = iic;
+                     num_nonzeros++;
+                  }
                }
             }
          }
@@ -859,9 +1020,16 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 
       /* Second pass: Fill in C_data and C_j. */
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
-      for (ib = 0; ib < ncols_B; ib++)
+      if (B_marker)
       {
-         B_marker[ib] = -1;
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
+      }
+      for (h = 0; h < hash_size; h++)
+      {
+         hash_stamp[h] = -1;
       }
 
       counter = rownnz_A ? C_i[rownnz_A[ns]] : C_i[ns];
@@ -869,38 +1037,120 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       {
          if (rownnz_A)
          {
-            iic = rownnz_A[ic];
+            iic  = rownnz_A[ic];
+            diag = 0;
          }
          else
          {
-            iic = ic;
-            if (allsquare)
-            {
-               B_marker[ic] = counter;
-               C_data[counter] = 0;
-               C_j[counter] = ic;
-               counter++;
-            }
+            iic  = ic;
+            diag = allsquare;
          }
 
+         row_ub = 0;
          for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
          {
+            ja = A_j[ia];
+            row_ub += B_i[ja + 1] - B_i[ja];
+         }
+         algo = hypre_CSRMatrixMultiplyHostRowAlgo(A_i[iic + 1] - A_i[iic], row_ub, ncols_B,
+                                                   dense_ncols, hash_max);
+
+         if (algo == HYPRE_SPGEMM_HOST_COPY)
+         {
+            /* the scaled row of B, with the diagonal moved to the front */
+            i1 = counter;
+            if (diag)
+            {
+               C_data[counter] = 0;
+               C_j[counter] = iic;
+               counter++;
+            }
+            ia = A_i[iic];
             ja = A_j[ia];
             a_entry = A_data[ia];
             for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
             {
                jb = B_j[ib];
                b_entry = B_data[ib];
-               if (B_marker[jb] < C_i[iic])
+               if (diag && jb == iic)
                {
-                  B_marker[jb] = counter;
-                  C_j[B_marker[jb]] = jb;
-                  C_data[B_marker[jb]] = a_entry * b_entry;
-                  counter++;
+                  C_data[i1] += a_entry * b_entry;
                }
                else
                {
-                  C_data[B_marker[jb]] += a_entry * b_entry;
+                  C_j[counter] = jb;
+                  C_data[counter] = a_entry * b_entry;
+                  counter++;
+               }
+            }
+         }
+         else if (algo == HYPRE_SPGEMM_HOST_HASH)
+         {
+            m = hypre_CSRMatrixMultiplyHostHashSize(row_ub + diag);
+            if (diag)
+            {
+               h = hypre_CSRMatrixMultiplyHostHashSlot(hash_key, hash_stamp, m, iic, iic);
+               hash_stamp[h] = iic;
+               hash_key[h]   = iic;
+               hash_pos[h]   = counter;
+               C_data[counter] = 0;
+               C_j[counter] = iic;
+               counter++;
+            }
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  h  = hypre_CSRMatrixMultiplyHostHashSlot(hash_key, hash_stamp, m, jb, iic);
+                  if (hash_stamp[h] != iic)
+                  {
+                     hash_stamp[h] = iic;
+                     hash_key[h]   = jb;
+                     hash_pos[h]   = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry * b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[hash_pos[h]] += a_entry * b_entry;
+                  }
+               }
+            }
+         }
+         else
+         {
+            if (diag)
+            {
+               B_marker[iic] = counter;
+               C_data[counter] = 0;
+               C_j[counter] = iic;
+               counter++;
+            }
+
+            for (ia = A_i[iic]; ia < A_i[iic + 1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja + 1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  if (B_marker[jb] < C_i[iic])
+                  {
+                     B_marker[jb] = counter;
+                     C_j[B_marker[jb]] = jb;
+                     C_data[B_marker[jb]] = a_entry * b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[B_marker[jb]] += a_entry * b_entry;
+                  }
                }
             }
          }
@@ -909,6 +1159,9 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 
       /* End of Second Pass */
       hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_stamp, HYPRE_MEMORY_HOST);
    } /*end parallel region */
 
 #ifdef HYPRE_DEBUG
@@ -1586,6 +1839,9 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   /* Values and columns move in place */
+   hypre_CSRMatrixSellDestroy(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2002,6 +2258,9 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   /* Values change in place: drop the SELL-C-sigma layout */
+   hypre_CSRMatrixSellDestroy(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2130,6 +2389,9 @@ hypre_CSRMatrixDiagScale( hypre_CSRMatrix *A,
       return hypre_error_flag;
    }
 
+   /* Values change in place: drop the SELL-C-sigma layout */
+   hypre_CSRMatrixSellDestroy(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec;
 
@@ -2174,6 +2436,9 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   /* Values change in place: drop the SELL-C-sigma layout */
+   hypre_CSRMatrixSellDestroy(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
@@ -66,6 +66,7 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), memory_location);
+      hypre_CSRMatrixSellDestroy(matrix);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -407,6 +408,178 @@ hypre_CSRMatrixSetRownnz( hypre_CSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellSetup
+ *
+ * Builds the SELL-C-sigma layout of a host CSR matrix (see csr_matrix.h).
+ * An existing layout is reused if it was built with the same parameters
+ * from the same CSR arrays, otherwise it is rebuilt.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellSetup( hypre_CSRMatrix *matrix,
+                          HYPRE_Int        chunk_size,
+                          HYPRE_Int        sigma )
+{
+   HYPRE_Int          num_rows = hypre_CSRMatrixNumRows(matrix);
+   HYPRE_Int          nnz      = hypre_CSRMatrixNumNonzeros(matrix);
+   HYPRE_Int         *A_i      = hypre_CSRMatrixI(matrix);
+   HYPRE_Int         *A_j      = hypre_CSRMatrixJ(matrix);
+   HYPRE_Complex     *A_data   = hypre_CSRMatrixData(matrix);
+   hypre_CSRSellData *sell     = hypre_CSRMatrixSellData(matrix);
+
+   HYPRE_Int          num_chunks, num_sorted;
+   HYPRE_Int         *chunk_ptr, *chunk_len, *perm, *row_len;
+   HYPRE_Int         *S_j;
+   HYPRE_Complex     *S_data;
+   HYPRE_Int          c, i, k, lane, row, len, jj, pad_col;
+
+   if (chunk_size < 1 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE ||
+       sigma < chunk_size || sigma % chunk_size)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (sell &&
+       hypre_CSRSellDataChunkSize(sell) == chunk_size &&
+       hypre_CSRSellDataSigma(sell)     == sigma      &&
+       hypre_CSRSellDataCSRData(sell)   == A_data     &&
+       hypre_CSRSellDataCSRNnz(sell)    == nnz)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSellDestroy(matrix);
+
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   num_sorted = num_chunks * chunk_size;
+
+   chunk_ptr  = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len  = hypre_TAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   perm       = hypre_TAlloc(HYPRE_Int, num_sorted, HYPRE_MEMORY_HOST);
+   row_len    = hypre_TAlloc(HYPRE_Int, num_sorted, HYPRE_MEMORY_HOST);
+
+   /* Sort rows by decreasing length within each sigma window.
+      The sort key is the negated row length */
+   for (i = 0; i < num_rows; i++)
+   {
+      perm[i]    = i;
+      row_len[i] = -(A_i[i + 1] - A_i[i]);
+   }
+   for (i = num_rows; i < num_sorted; i++)
+   {
+      perm[i]    = -1;
+      row_len[i] = 0;
+   }
+
+   if (sigma > 1)
+   {
+      for (i = 0; i < num_rows; i += sigma)
+      {
+         hypre_qsort2i(row_len, perm, i, hypre_min(i + sigma, num_rows) - 1);
+      }
+   }
+
+   /* Chunk widths and offsets */
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      len = 0;
+      for (lane = 0; lane < chunk_size; lane++)
+      {
+         len = hypre_max(len, -row_len[c * chunk_size + lane]);
+      }
+      chunk_len[c]     = len;
+      chunk_ptr[c + 1] = chunk_ptr[c] + len * chunk_size;
+   }
+
+   S_j    = hypre_TAlloc(HYPRE_Int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   S_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /* Fill chunks column-major; padding repeats the last column of the row
+      (or the first column of the chunk) with a zero value */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c, k, lane, row, len, jj, pad_col) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      pad_col = 0;
+      for (lane = 0; lane < chunk_size; lane++)
+      {
+         row = perm[c * chunk_size + lane];
+         if (row > -1 && A_i[row + 1] > A_i[row])
+         {
+            pad_col = A_j[A_i[row]];
+            break;
+         }
+      }
+
+      for (lane = 0; lane < chunk_size; lane++)
+      {
+         row = perm[c * chunk_size + lane];
+         len = (row > -1) ? (A_i[row + 1] - A_i[row]) : 0;
+         jj  = chunk_ptr[c] + lane;
+
+         for (k = 0; k < len; k++, jj += chunk_size)
+         {
+            S_j[jj]    = A_j[A_i[row] + k];
+            S_data[jj] = A_data[A_i[row] + k];
+         }
+         for (k = len; k < chunk_len[c]; k++, jj += chunk_size)
+         {
+            S_j[jj]    = (len > 0) ? A_j[A_i[row] + len - 1] : pad_col;
+            S_data[jj] = 0.0;
+         }
+      }
+   }
+
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   sell = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+   hypre_CSRSellDataChunkSize(sell) = chunk_size;
+   hypre_CSRSellDataSigma(sell)     = sigma;
+   hypre_CSRSellDataNumChunks(sell) = num_chunks;
+   hypre_CSRSellDataChunkPtr(sell)  = chunk_ptr;
+   hypre_CSRSellDataChunkLen(sell)  = chunk_len;
+   hypre_CSRSellDataPerm(sell)      = perm;
+   hypre_CSRSellDataJ(sell)         = S_j;
+   hypre_CSRSellDataData(sell)      = S_data;
+   hypre_CSRSellDataCSRData(sell)   = A_data;
+   hypre_CSRSellDataCSRNnz(sell)    = nnz;
+
+   hypre_CSRMatrixSellData(matrix)  = sell;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *
+ * Frees the SELL-C-sigma layout of a CSR matrix. This must be called after
+ * changing the values of the matrix in place.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *matrix )
+{
+   hypre_CSRSellData *sell = hypre_CSRMatrixSellData(matrix);
+
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixSellData(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
 /* check if numnonzeros was properly set to be ia[nrow] */
 HYPRE_Int
 hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix )
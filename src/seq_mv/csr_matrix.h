@@ -26,6 +26,40 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion layout of a CSR Matrix (host SpMV)
+ *
+ * Rows are sorted by length inside windows of sigma rows and grouped into
+ * chunks of C rows. Each chunk is stored column-major and padded to the length
+ * of its longest row, so that the C rows of a chunk can be processed in SIMD
+ * lanes. Padded entries have zero values and point to a valid column.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            chunk_size;      /* C: number of rows per chunk */
+   HYPRE_Int            sigma;           /* sorting window, a multiple of C */
+   HYPRE_Int            num_chunks;
+   HYPRE_Int           *chunk_ptr;       /* start of each chunk in j/data (num_chunks + 1) */
+   HYPRE_Int           *chunk_len;       /* width (longest row) of each chunk */
+   HYPRE_Int           *perm;            /* original row index of each sorted row */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+   HYPRE_Complex       *csr_data;        /* CSR data array the layout was built from */
+   HYPRE_Int            csr_nnz;         /* CSR number of nonzeros the layout was built from */
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataChunkSize(sell)   ((sell) -> chunk_size)
+#define hypre_CSRSellDataSigma(sell)       ((sell) -> sigma)
+#define hypre_CSRSellDataNumChunks(sell)   ((sell) -> num_chunks)
+#define hypre_CSRSellDataChunkPtr(sell)    ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)    ((sell) -> chunk_len)
+#define hypre_CSRSellDataPerm(sell)        ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)           ((sell) -> j)
+#define hypre_CSRSellDataData(sell)        ((sell) -> data)
+#define hypre_CSRSellDataCSRData(sell)     ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRNnz(sell)      ((sell) -> csr_nnz)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -46,6 +80,7 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma layout for host SpMV (built lazily) */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -73,6 +108,7 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -13,6 +13,126 @@
 
 #include "seq_mv.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellChunks
+ *
+ * y[perm] = alpha*A*x + beta*b[perm] over the SELL-C-sigma chunks of A.
+ * The chunk size C is passed as a literal by the caller so that the lane
+ * loops have a compile-time trip count and vectorize.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixMatvecSellChunks( HYPRE_Int          C,
+                                 hypre_CSRSellData *sell,
+                                 HYPRE_Int          num_rows,
+                                 HYPRE_Complex      alpha,
+                                 HYPRE_Complex     *x_data,
+                                 HYPRE_Complex      beta,
+                                 HYPRE_Complex     *b_data,
+                                 HYPRE_Complex     *y_data )
+{
+   HYPRE_Int      num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int     *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int     *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int     *perm       = hypre_CSRSellDataPerm(sell);
+   HYPRE_Int     *S_j        = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex *S_data     = hypre_CSRSellDataData(sell);
+   HYPRE_Int      c;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex  tmp[HYPRE_SELL_MAX_CHUNK_SIZE];
+      HYPRE_Int     *c_j    = S_j    + chunk_ptr[c];
+      HYPRE_Complex *c_data = S_data + chunk_ptr[c];
+      HYPRE_Int     *c_perm = perm   + c * C;
+      HYPRE_Int      nlanes = hypre_min(C, num_rows - c * C);
+      HYPRE_Int      k, lane;
+
+      for (lane = 0; lane < C; lane++)
+      {
+         tmp[lane] = 0.0;
+      }
+
+      for (k = 0; k < chunk_len[c]; k++)
+      {
+         for (lane = 0; lane < C; lane++)
+         {
+            tmp[lane] += c_data[k * C + lane] * x_data[c_j[k * C + lane]];
+         }
+      }
+
+      if (beta == 0.0)
+      {
+         for (lane = 0; lane < nlanes; lane++)
+         {
+            y_data[c_perm[lane]] = alpha * tmp[lane];
+         }
+      }
+      else
+      {
+         for (lane = 0; lane < nlanes; lane++)
+         {
+            y_data[c_perm[lane]] = alpha * tmp[lane] + beta * b_data[c_perm[lane]];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b using the SELL-C-sigma layout of A, which is built
+ * on first use. Only single vectors are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   HYPRE_Int          num_rows   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          chunk_size = hypre_HandleSpMVSellChunkSize(hypre_handle());
+   HYPRE_Int          sigma      = hypre_HandleSpMVSellSigma(hypre_handle());
+   HYPRE_Complex     *x_data     = hypre_VectorData(x);
+   HYPRE_Complex     *b_data     = hypre_VectorData(b);
+   HYPRE_Complex     *y_data     = hypre_VectorData(y);
+   hypre_CSRSellData *sell;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+   hypre_assert(x != y);
+
+   hypre_CSRMatrixSellSetup(A, chunk_size, sigma);
+   sell = hypre_CSRMatrixSellData(A);
+
+   switch (chunk_size)
+   {
+      case 4:
+         hypre_CSRMatrixMatvecSellChunks(4, sell, num_rows, alpha, x_data, beta, b_data, y_data);
+         break;
+
+      case 8:
+         hypre_CSRMatrixMatvecSellChunks(8, sell, num_rows, alpha, x_data, beta, b_data, y_data);
+         break;
+
+      case 16:
+         hypre_CSRMatrixMatvecSellChunks(16, sell, num_rows, alpha, x_data, beta, b_data, y_data);
+         break;
+
+      default:
+         hypre_CSRMatrixMatvecSellChunks(chunk_size, sell, num_rows, alpha, x_data, beta, b_data,
+                                         y_data);
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -106,6 +226,19 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       return ierr;
    }
 
+   /*-----------------------------------------------------------------------
+    * Use the SELL-C-sigma layout if requested (single vectors only). Blocks
+    * with empty rows, e.g. most offd blocks, keep the rownnz path below.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_HandleSpMVSellChunkSize(hypre_handle()) > 0 &&
+       num_vectors == 1 && offset == 0 && x != y && !A_rownnz)
+   {
+      hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+
+      return ierr;
+   }
+
    if (x == y)
    {
       x_tmp = hypre_SeqVectorCloneDeep(x);
@@ -900,6 +1033,60 @@ hypre_CSRMatrixMatvec( HYPRE_Complex    alpha,
    return hypre_CSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecNorm2Host
+ *
+ * Performs y = alpha*A*x + beta*b and returns the squared 2-norm of the
+ * result in y_norm2, in a single pass over y. b may be equal to y, but x may
+ * not. Only single vectors are supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecNorm2Host( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *b,
+                                hypre_Vector    *y,
+                                HYPRE_Real      *y_norm2 )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+
+   HYPRE_Complex     tempx, yi;
+   HYPRE_Real        norm2 = 0.0;
+   HYPRE_Int         i, jj;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+   hypre_assert(x != y);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, jj, tempx, yi) reduction(+:norm2) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      tempx = 0.0;
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         tempx += A_data[jj] * x_data[A_j[jj]];
+      }
+
+      yi = (beta == 0.0) ? alpha * tempx : alpha * tempx + beta * b_data[i];
+      y_data[i] = yi;
+      norm2 += hypre_creal(hypre_conj(yi) * yi);
+   }
+
+   *y_norm2 = norm2;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvecT
  *
@@ -117,6 +117,9 @@ HYPRE_Int hypre_CSRMatrixJtoBigJ ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixSetDataOwner ( hypre_CSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_CSRMatrixSetPatternOnly( hypre_CSRMatrix *matrix, HYPRE_Int pattern_only );
 HYPRE_Int hypre_CSRMatrixSetRownnz ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *matrix, HYPRE_Int chunk_size,
+                                     HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *matrix );
 hypre_CSRMatrix *hypre_CSRMatrixRead ( char *file_name );
 HYPRE_Int hypre_CSRMatrixPrint ( hypre_CSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_CSRMatrixPrintIJ( hypre_CSRMatrix *matrix, HYPRE_Int base_i,
@@ -150,6 +153,11 @@ HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre
                                   HYPRE_Complex beta, hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                    HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecNorm2Host ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                           hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y,
+                                           HYPRE_Real *y_norm2 );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
@@ -298,6 +306,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorComponentInnerProd(hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorComponentAxpy(HYPRE_Complex *alpha, hypre_Vector *x, hypre_Vector *y);
+HYPRE_Int hypre_SeqVectorComponentScale(HYPRE_Complex *alpha, hypre_Vector *y);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsHost ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsDevice ( hypre_Vector *vector );
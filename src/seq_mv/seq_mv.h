@@ -46,6 +46,40 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma companion layout of a CSR Matrix (host SpMV)
+ *
+ * Rows are sorted by length inside windows of sigma rows and grouped into
+ * chunks of C rows. Each chunk is stored column-major and padded to the length
+ * of its longest row, so that the C rows of a chunk can be processed in SIMD
+ * lanes. Padded entries have zero values and point to a valid column.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            chunk_size;      /* C: number of rows per chunk */
+   HYPRE_Int            sigma;           /* sorting window, a multiple of C */
+   HYPRE_Int            num_chunks;
+   HYPRE_Int           *chunk_ptr;       /* start of each chunk in j/data (num_chunks + 1) */
+   HYPRE_Int           *chunk_len;       /* width (longest row) of each chunk */
+   HYPRE_Int           *perm;            /* original row index of each sorted row */
+   HYPRE_Int           *j;
+   HYPRE_Complex       *data;
+   HYPRE_Complex       *csr_data;        /* CSR data array the layout was built from */
+   HYPRE_Int            csr_nnz;         /* CSR number of nonzeros the layout was built from */
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataChunkSize(sell)   ((sell) -> chunk_size)
+#define hypre_CSRSellDataSigma(sell)       ((sell) -> sigma)
+#define hypre_CSRSellDataNumChunks(sell)   ((sell) -> num_chunks)
+#define hypre_CSRSellDataChunkPtr(sell)    ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)    ((sell) -> chunk_len)
+#define hypre_CSRSellDataPerm(sell)        ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)           ((sell) -> j)
+#define hypre_CSRSellDataData(sell)        ((sell) -> data)
+#define hypre_CSRSellDataCSRData(sell)     ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRNnz(sell)      ((sell) -> csr_nnz)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -66,6 +100,7 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell_data;       /* SELL-C-sigma layout for host SpMV (built lazily) */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -93,6 +128,7 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell_data)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -393,6 +429,9 @@ HYPRE_Int hypre_CSRMatrixJtoBigJ ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixSetDataOwner ( hypre_CSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_CSRMatrixSetPatternOnly( hypre_CSRMatrix *matrix, HYPRE_Int pattern_only );
 HYPRE_Int hypre_CSRMatrixSetRownnz ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *matrix, HYPRE_Int chunk_size,
+                                     HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *matrix );
 hypre_CSRMatrix *hypre_CSRMatrixRead ( char *file_name );
 HYPRE_Int hypre_CSRMatrixPrint ( hypre_CSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_CSRMatrixPrintIJ( hypre_CSRMatrix *matrix, HYPRE_Int base_i,
@@ -426,6 +465,11 @@ HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre
                                   HYPRE_Complex beta, hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                    HYPRE_Complex beta, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                          hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecNorm2Host ( HYPRE_Complex alpha, hypre_CSRMatrix *A,
+                                           hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y,
+                                           HYPRE_Real *y_norm2 );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x,
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
@@ -574,6 +618,9 @@ HYPRE_Int hypre_SeqVectorMassAxpy4(HYPRE_Complex *alpha, hypre_Vector **x, hypre
                                    HYPRE_Int k);
 HYPRE_Int hypre_SeqVectorMassAxpy8(HYPRE_Complex *alpha, hypre_Vector **x, hypre_Vector *y,
                                    HYPRE_Int k);
+HYPRE_Int hypre_SeqVectorComponentInnerProd(hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result);
+HYPRE_Int hypre_SeqVectorComponentAxpy(HYPRE_Complex *alpha, hypre_Vector *x, hypre_Vector *y);
+HYPRE_Int hypre_SeqVectorComponentScale(HYPRE_Complex *alpha, hypre_Vector *y);
 HYPRE_Complex hypre_SeqVectorSumElts ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsHost ( hypre_Vector *vector );
 HYPRE_Complex hypre_SeqVectorSumEltsDevice ( hypre_Vector *vector );
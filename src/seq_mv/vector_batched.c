@@ -1207,3 +1207,118 @@ HYPRE_Int hypre_SeqVectorMassDotpTwo( hypre_Vector *x, hypre_Vector *y,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorComponentInnerProd
+ *
+ * Computes result[k] = <x_k, y_k> for each component k of the
+ * multicomponent vectors x and y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorComponentInnerProd( hypre_Vector *x,
+                                   hypre_Vector *y,
+                                   HYPRE_Real   *result )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_stride    = hypre_VectorVectorStride(x);
+   HYPRE_Int      y_stride    = hypre_VectorVectorStride(y);
+   HYPRE_Real     res;
+   HYPRE_Int      i, j;
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      HYPRE_Complex *xj = x_data + j * x_stride;
+      HYPRE_Complex *yj = y_data + j * y_stride;
+
+      res = 0.0;
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) reduction(+:res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         res += hypre_conj(yj[i]) * xj[i];
+      }
+      result[j] = res;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorComponentAxpy
+ *
+ * Computes y_k = y_k + alpha[k] * x_k for each component k.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorComponentAxpy( HYPRE_Complex *alpha,
+                              hypre_Vector  *x,
+                              hypre_Vector  *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      x_stride    = hypre_VectorVectorStride(x);
+   HYPRE_Int      y_stride    = hypre_VectorVectorStride(y);
+   HYPRE_Int      i, j;
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      HYPRE_Complex *xj = x_data + j * x_stride;
+      HYPRE_Complex *yj = y_data + j * y_stride;
+      HYPRE_Complex  aj = alpha[j];
+
+      if (aj == 0.0)
+      {
+         continue;
+      }
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         yj[i] += aj * xj[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorComponentScale
+ *
+ * Computes y_k = alpha[k] * y_k for each component k.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorComponentScale( HYPRE_Complex *alpha,
+                               hypre_Vector  *y )
+{
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(y);
+   HYPRE_Int      y_stride    = hypre_VectorVectorStride(y);
+   HYPRE_Int      i, j;
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      HYPRE_Complex *yj = y_data + j * y_stride;
+      HYPRE_Complex  aj = alpha[j];
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         yj[i] *= aj;
+      }
+   }
+
+   return hypre_error_flag;
+}
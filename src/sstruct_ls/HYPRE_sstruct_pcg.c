@@ -24,6 +24,8 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   pcg_functions->InnerProdBegin = hypre_SStructKrylovInnerProdBegin;
+   pcg_functions->InnerProdEnd   = hypre_SStructKrylovInnerProdEnd;
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -593,6 +593,9 @@ HYPRE_Int hypre_SStructKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, vo
                                       HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_SStructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_SStructKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_SStructKrylovInnerProdBegin ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                              hypre_MPI_Request *request );
+HYPRE_Int hypre_SStructKrylovInnerProdEnd ( hypre_MPI_Request *request );
 HYPRE_Int hypre_SStructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
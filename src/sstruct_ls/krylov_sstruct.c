@@ -215,6 +215,44 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdBegin( HYPRE_Int          n,
+                                   void             **x,
+                                   void             **y,
+                                   HYPRE_Real        *result,
+                                   hypre_MPI_Request *request )
+{
+   MPI_Comm   comm = hypre_SStructVectorComm((hypre_SStructVector *) x[0]);
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      hypre_SStructInnerProdLocal( (hypre_SStructVector *) x[k],
+                                   (hypre_SStructVector *) y[k], &result[k] );
+   }
+
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdEnd( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
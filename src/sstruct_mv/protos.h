@@ -221,6 +221,8 @@ HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px, hypre_SStructPVect
                                     HYPRE_Real *presult_ptr );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *y,
                                    HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructInnerProdLocal ( hypre_SStructVector *x, hypre_SStructVector *y,
+                                        HYPRE_Real *result_ptr );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
@@ -91,3 +91,64 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProdLocal
+ *
+ * Local contribution to <x,y>, without the global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructInnerProdLocal( hypre_SStructVector *x,
+                             hypre_SStructVector *y,
+                             HYPRE_Real          *result_ptr )
+{
+   HYPRE_Int    nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Real   result;
+   HYPRE_Int    part, var, nvars;
+
+   HYPRE_Int    x_object_type = hypre_SStructVectorObjectType(x);
+   HYPRE_Int    y_object_type = hypre_SStructVectorObjectType(y);
+
+   hypre_SStructPVector *px, *py;
+
+   if (x_object_type != y_object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   result = 0.0;
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         px    = hypre_SStructVectorPVector(x, part);
+         py    = hypre_SStructVectorPVector(y, part);
+         nvars = hypre_SStructPVectorNVars(px);
+         for (var = 0; var < nvars; var++)
+         {
+            result += hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                                 hypre_SStructPVectorSVector(py, var));
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      result = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par),
+                                        hypre_ParVectorLocalVector(y_par));
+   }
+
+   *result_ptr = result;
+
+   return hypre_error_flag;
+}
@@ -326,6 +326,25 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Fuse up to \e rb_temporal_block half-sweeps of red/black
+ * Gauss-Seidel relaxation (relax types 2 and 3) into one pass over memory.
+ * The vectors are exchanged with \e rb_temporal_block ghost layers once per
+ * block of half-sweeps, and the ghost layers are relaxed redundantly.  Each
+ * level keeps a copy of its matrix with these ghost layers.  The result does
+ * not change.  This reduces memory traffic and the number of messages when
+ * more than one relaxation sweep is done per level, and only pays off for
+ * boxes that are too large to fit in cache.  It is not used on periodic
+ * grids, nor on coarse levels whose processors only know their neighbors
+ * fewer than \e rb_temporal_block points away.  Values less than 2 turn the
+ * option off (default).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRBTemporalBlock(HYPRE_StructSolver solver,
+                                             HYPRE_Int          rb_temporal_block);
+
+HYPRE_Int HYPRE_StructPFMGGetRBTemporalBlock(HYPRE_StructSolver solver,
+                                             HYPRE_Int *rb_temporal_block);
+
 /*
  * RE-VISIT
  **/
@@ -500,6 +519,21 @@ HYPRE_Int HYPRE_StructSMGSetPrintLevel(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructSMGGetPrintLevel(HYPRE_StructSolver solver,
                                        HYPRE_Int *print_level);
 
+/**
+ * (Optional) Solve the lines of the line smoother in batches with the
+ * Thomas algorithm instead of with cyclic reduction.  This is only done
+ * when every line is owned by one process, i.e., when no box is split in
+ * the direction of the lines and the grid is not periodic in that
+ * direction.  Otherwise cyclic reduction is used.  Batched line solves
+ * need no communication and vectorize across lines.  They are used on
+ * host memory only.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructSMGSetBatchLines(HYPRE_StructSolver solver,
+                                       HYPRE_Int          batch_lines);
+
+HYPRE_Int HYPRE_StructSMGGetBatchLines(HYPRE_StructSolver solver,
+                                       HYPRE_Int *batch_lines);
+
 /**
  * Return the number of iterations taken.
  **/
@@ -29,6 +29,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   pcg_functions->InnerProdBegin = hypre_StructKrylovInnerProdBegin;
+   pcg_functions->InnerProdEnd   = hypre_StructKrylovInnerProdEnd;
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
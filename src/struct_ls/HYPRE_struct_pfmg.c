@@ -250,6 +250,23 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return ( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRBTemporalBlock( HYPRE_StructSolver solver,
+                                    HYPRE_Int          rb_temporal_block )
+{
+   return ( hypre_PFMGSetRBTemporalBlock( (void *) solver, rb_temporal_block) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRBTemporalBlock( HYPRE_StructSolver solver,
+                                    HYPRE_Int        * rb_temporal_block )
+{
+   return ( hypre_PFMGGetRBTemporalBlock( (void *) solver, rb_temporal_block) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -219,6 +219,23 @@ HYPRE_StructSMGGetPrintLevel( HYPRE_StructSolver solver,
    return ( hypre_SMGGetPrintLevel( (void *) solver, print_level) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSMGSetBatchLines( HYPRE_StructSolver solver,
+                              HYPRE_Int          batch_lines )
+{
+   return ( hypre_SMGSetBatchLines( (void *) solver, batch_lines ) );
+}
+
+HYPRE_Int
+HYPRE_StructSMGGetBatchLines( HYPRE_StructSolver solver,
+                              HYPRE_Int        * batch_lines )
+{
+   return ( hypre_SMGGetBatchLines( (void *) solver, batch_lines ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -15,6 +15,9 @@
 
 #define DEBUG 0
 
+/* number of lines per thread block in the batched line solver */
+#define hypre_CYCRED_LINE_BLOCK 32
+
 /*--------------------------------------------------------------------------
  * Macros
  *--------------------------------------------------------------------------*/
@@ -78,6 +81,16 @@ typedef struct
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
+
+   /* batched line solver (used instead of the levels above when possible) */
+   HYPRE_Int             batch_lines;   /* try to use the batched solver */
+   HYPRE_Int             batched;       /* is the batched solver set up? */
+   HYPRE_Int             line_size;     /* number of points on each line */
+   HYPRE_Int            *line_offsets;  /* first line of each base box */
+   HYPRE_Real           *line_lower;    /* lower coefficients */
+   HYPRE_Real           *line_pivot;    /* inverse pivots */
+   HYPRE_Real           *line_upper;    /* upper coefficients times pivot */
+   HYPRE_Real           *line_work;
 } hypre_CyclicReductionData;
 
 /*--------------------------------------------------------------------------
@@ -96,6 +109,8 @@ hypre_CyclicReductionCreate( MPI_Comm  comm )
    (cyc_red_data -> cdir) = 0;
    (cyc_red_data -> time_index)  = hypre_InitializeTiming("CyclicReduction");
    (cyc_red_data -> max_levels)  = -1;
+   (cyc_red_data -> batch_lines) = 0;
+   (cyc_red_data -> batched)     = 0;
 
    /* set defaults */
    hypre_SetIndex3((cyc_red_data -> base_index), 0, 0, 0);
@@ -460,6 +475,420 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedLineStart
+ *
+ * Returns the data index of the first point of line 'line' in the box of
+ * points with lower corner 'start', the given stride and loop_size.  The
+ * lines run in direction cdir and are numbered lexicographically in the
+ * remaining directions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedLineStart( HYPRE_Int    ndim,
+                       HYPRE_Int    cdir,
+                       hypre_Box   *data_box,
+                       hypre_Index  start,
+                       hypre_Index  stride,
+                       hypre_Index  loop_size,
+                       HYPRE_Int    line )
+{
+   hypre_Index  index;
+   HYPRE_Int    d;
+
+   hypre_CopyIndex(start, index);
+   for (d = 0; d < ndim; d++)
+   {
+      if (d != cdir)
+      {
+         hypre_IndexD(index, d) += (line % loop_size[d]) * hypre_IndexD(stride, d);
+         line /= loop_size[d];
+      }
+   }
+
+   return hypre_BoxIndexRank(data_box, index);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSetupLines
+ *
+ * Sets up the batched line solver if every line in direction cdir is owned
+ * by a single box.  This holds when each box spans the bounding box of the
+ * grid in direction cdir and the grid is not periodic in that direction.
+ * The test is collective, so either all processes use the batched solver
+ * or none do.
+ *
+ * The LU factors of the tridiagonal systems (Thomas algorithm) are computed
+ * here.  The lines of each box are split into blocks of at most
+ * hypre_CYCRED_LINE_BLOCK lines, and the factors of a block are stored
+ * line-interleaved, that is, point k of line j in a block of w lines is at
+ * k*w + j.  The solve then runs unit stride across the lines of a block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedSetupLines( void               *cyc_red_vdata,
+                        hypre_StructMatrix *A )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *) cyc_red_vdata;
+
+   MPI_Comm              comm          = (cyc_red_data -> comm);
+   HYPRE_Int             cdir          = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_index    = (cyc_red_data -> base_index);
+   hypre_IndexRef        base_stride   = (cyc_red_data -> base_stride);
+
+   hypre_StructGrid     *grid          = hypre_StructMatrixGrid(A);
+   HYPRE_Int             ndim          = hypre_StructGridNDim(grid);
+   hypre_Box            *bounding_box  = hypre_StructGridBoundingBox(grid);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             symmetric     = hypre_StructMatrixSymmetric(A);
+
+   hypre_BoxArray       *base_points;
+   hypre_Box            *base_box;
+   hypre_Box            *A_dbox;
+   HYPRE_Int            *line_offsets;
+   HYPRE_Real           *lower, *pivot, *upper;
+   HYPRE_Real           *lp, *pp, *up;
+   HYPRE_Real           *Ap, *Awp, *Aep;
+   hypre_Index           index;
+   hypre_Index           loop_size;
+
+   HYPRE_Int             line_size, num_lines, nl, jstart, w, Ai, Astride;
+   HYPRE_Int             batched, global_batched;
+   HYPRE_Int             num_zero_pivots = 0;
+   HYPRE_Int             flop_divisor;
+   HYPRE_Int             i, j, k, d, kj;
+   HYPRE_Real            a_lower, a_upper, denom;
+
+   /* Free the factors of a previous setup */
+   if (cyc_red_data -> batched)
+   {
+      hypre_BoxArrayDestroy(cyc_red_data -> base_points);
+      hypre_TFree(cyc_red_data -> line_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_lower, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_pivot, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_upper, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_work, HYPRE_MEMORY_HOST);
+      (cyc_red_data -> base_points) = NULL;
+      (cyc_red_data -> batched)     = 0;
+   }
+
+   line_size = hypre_BoxSizeD(bounding_box, cdir);
+
+   /*-----------------------------------------------------
+    * Check whether the lines can be solved locally
+    *-----------------------------------------------------*/
+
+   batched = 1;
+   if ( (hypre_GetActualMemLocation(hypre_StructMatrixMemoryLocation(A)) != hypre_MEMORY_HOST) ||
+        (hypre_StructMatrixConstantCoefficient(A) != 0) ||
+        (hypre_IndexD(hypre_StructGridPeriodic(grid), cdir) != 0) ||
+        (hypre_IndexD(base_stride, cdir) != 1) )
+   {
+      batched = 0;
+   }
+   for (i = 0; i < stencil_size; i++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if ( (d != cdir && hypre_IndexD(stencil_shape[i], d) != 0) ||
+              (hypre_abs(hypre_IndexD(stencil_shape[i], d)) > 1) )
+         {
+            batched = 0;
+         }
+      }
+   }
+
+   base_points = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(grid));
+   hypre_ProjectBoxArray(base_points, base_index, base_stride);
+
+   hypre_ForBoxI(i, base_points)
+   {
+      base_box = hypre_BoxArrayBox(base_points, i);
+      if ( hypre_BoxVolume(base_box) > 0 &&
+           (hypre_BoxIMinD(base_box, cdir) != hypre_BoxIMinD(bounding_box, cdir) ||
+            hypre_BoxIMaxD(base_box, cdir) != hypre_BoxIMaxD(bounding_box, cdir)) )
+      {
+         batched = 0;
+      }
+   }
+
+   hypre_MPI_Allreduce(&batched, &global_batched, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!global_batched)
+   {
+      hypre_BoxArrayDestroy(base_points);
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------
+    * Count the lines in each box
+    *-----------------------------------------------------*/
+
+   line_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(base_points) + 1,
+                               HYPRE_MEMORY_HOST);
+   line_offsets[0] = 0;
+   hypre_ForBoxI(i, base_points)
+   {
+      base_box = hypre_BoxArrayBox(base_points, i);
+      nl = 0;
+      if (hypre_BoxVolume(base_box) > 0)
+      {
+         hypre_BoxGetStrideSize(base_box, base_stride, loop_size);
+         nl = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            if (d != cdir)
+            {
+               nl *= loop_size[d];
+            }
+         }
+      }
+      line_offsets[i + 1] = line_offsets[i] + nl;
+   }
+   num_lines = line_offsets[hypre_BoxArraySize(base_points)];
+
+   lower = hypre_TAlloc(HYPRE_Real, line_size * num_lines, HYPRE_MEMORY_HOST);
+   pivot = hypre_TAlloc(HYPRE_Real, line_size * num_lines, HYPRE_MEMORY_HOST);
+   upper = hypre_TAlloc(HYPRE_Real, line_size * num_lines, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------
+    * Factor the tridiagonal systems
+    *
+    * If A is symmetric, only one of the off-diagonal
+    * coefficients is stored and the other one is taken
+    * from the neighboring row.
+    *-----------------------------------------------------*/
+
+   hypre_ForBoxI(i, base_points)
+   {
+      nl = line_offsets[i + 1] - line_offsets[i];
+      if (nl == 0)
+      {
+         continue;
+      }
+
+      base_box = hypre_BoxArrayBox(base_points, i);
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      hypre_BoxGetStrideSize(base_box, base_stride, loop_size);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+      Astride = hypre_BoxOffsetDistance(A_dbox, index);
+
+      for (jstart = 0; jstart < nl; jstart += hypre_CYCRED_LINE_BLOCK)
+      {
+         w  = hypre_min(hypre_CYCRED_LINE_BLOCK, nl - jstart);
+         lp = lower + line_size * (line_offsets[i] + jstart);
+         pp = pivot + line_size * (line_offsets[i] + jstart);
+         up = upper + line_size * (line_offsets[i] + jstart);
+
+         for (j = 0; j < w; j++)
+         {
+            Ai = hypre_CycRedLineStart(ndim, cdir, A_dbox, hypre_BoxIMin(base_box),
+                                       base_stride, loop_size, jstart + j);
+            for (k = 0; k < line_size; k++)
+            {
+               a_lower = 0.0;
+               a_upper = 0.0;
+               if (k > 0)
+               {
+                  if (Awp != NULL)
+                  {
+                     a_lower = Awp[Ai];
+                  }
+                  else if (symmetric && Aep != NULL)
+                  {
+                     a_lower = Aep[Ai - Astride];
+                  }
+               }
+               if (k < line_size - 1)
+               {
+                  if (Aep != NULL)
+                  {
+                     a_upper = Aep[Ai];
+                  }
+                  else if (symmetric && Awp != NULL)
+                  {
+                     a_upper = Awp[Ai + Astride];
+                  }
+               }
+
+               kj = k * w + j;
+               denom = Ap[Ai];
+               if (k > 0)
+               {
+                  denom -= a_lower * up[kj - w];
+               }
+               /* a zero pivot is reported below; the solve then leaves the point at zero */
+               if (denom != 0.0)
+               {
+                  pp[kj] = 1.0 / denom;
+               }
+               else
+               {
+                  pp[kj] = 0.0;
+                  num_zero_pivots++;
+               }
+               lp[kj] = a_lower;
+               up[kj] = a_upper * pp[kj];
+
+               Ai += Astride;
+            }
+         }
+      }
+   }
+
+   if (num_zero_pivots)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Zero pivot in the tridiagonal line factorization!");
+   }
+
+   (cyc_red_data -> batched)      = 1;
+   (cyc_red_data -> ndim)         = ndim;
+   (cyc_red_data -> num_levels)   = 1;
+   (cyc_red_data -> base_points)  = base_points;
+   (cyc_red_data -> line_size)    = line_size;
+   (cyc_red_data -> line_offsets) = line_offsets;
+   (cyc_red_data -> line_lower)   = lower;
+   (cyc_red_data -> line_pivot)   = pivot;
+   (cyc_red_data -> line_upper)   = upper;
+   (cyc_red_data -> line_work)    = hypre_TAlloc(HYPRE_Real, line_size * num_lines,
+                                                 HYPRE_MEMORY_HOST);
+
+   flop_divisor = (hypre_IndexX(base_stride) *
+                   hypre_IndexY(base_stride) *
+                   hypre_IndexZ(base_stride)  );
+   (cyc_red_data -> solve_flops) =
+      5 * hypre_StructGridGlobalSize(grid) / (HYPRE_BigInt)flop_divisor;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveLines
+ *
+ * Solves all lines with the factors from hypre_CycRedSetupLines.  For each
+ * block of lines, the right-hand sides are gathered into the work array,
+ * the forward and backward substitutions run across the lines of the block,
+ * and the solution is scattered into x.  No communication is needed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedSolveLines( void               *cyc_red_vdata,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *) cyc_red_vdata;
+
+   HYPRE_Int             ndim         = (cyc_red_data -> ndim);
+   HYPRE_Int             cdir         = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_stride  = (cyc_red_data -> base_stride);
+   hypre_BoxArray       *base_points  = (cyc_red_data -> base_points);
+   HYPRE_Int             line_size    = (cyc_red_data -> line_size);
+   HYPRE_Int            *line_offsets = (cyc_red_data -> line_offsets);
+
+   hypre_Box            *base_box;
+   hypre_Box            *b_dbox;
+   hypre_Box            *x_dbox;
+   HYPRE_Real           *bp, *xp;
+   hypre_Index           index;
+   hypre_Index           loop_size;
+
+   HYPRE_Int             nl, num_blocks, bstride, xstride;
+   HYPRE_Int             i, jb;
+
+   hypre_SetIndex3(index, 0, 0, 0);
+   hypre_IndexD(index, cdir) = 1;
+
+   hypre_ForBoxI(i, base_points)
+   {
+      nl = line_offsets[i + 1] - line_offsets[i];
+      if (nl == 0)
+      {
+         continue;
+      }
+
+      base_box = hypre_BoxArrayBox(base_points, i);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      bp = hypre_StructVectorBoxData(b, i);
+      xp = hypre_StructVectorBoxData(x, i);
+      bstride = hypre_BoxOffsetDistance(b_dbox, index);
+      xstride = hypre_BoxOffsetDistance(x_dbox, index);
+      hypre_BoxGetStrideSize(base_box, base_stride, loop_size);
+
+      num_blocks = (nl + hypre_CYCRED_LINE_BLOCK - 1) / hypre_CYCRED_LINE_BLOCK;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(jb) HYPRE_SMP_SCHEDULE
+#endif
+      for (jb = 0; jb < num_blocks; jb++)
+      {
+         HYPRE_Int    jstart = jb * hypre_CYCRED_LINE_BLOCK;
+         HYPRE_Int    w      = hypre_min(hypre_CYCRED_LINE_BLOCK, nl - jstart);
+         HYPRE_Int    offset = line_size * (line_offsets[i] + jstart);
+         HYPRE_Real  *lower  = (cyc_red_data -> line_lower) + offset;
+         HYPRE_Real  *pivot  = (cyc_red_data -> line_pivot) + offset;
+         HYPRE_Real  *upper  = (cyc_red_data -> line_upper) + offset;
+         HYPRE_Real  *work   = (cyc_red_data -> line_work)  + offset;
+         HYPRE_Int    j, k, kj, bi, xi;
+
+         /* gather right-hand sides */
+         for (j = 0; j < w; j++)
+         {
+            bi = hypre_CycRedLineStart(ndim, cdir, b_dbox, hypre_BoxIMin(base_box),
+                                       base_stride, loop_size, jstart + j);
+            for (k = 0; k < line_size; k++)
+            {
+               work[k * w + j] = bp[bi + k * bstride];
+            }
+         }
+
+         /* forward substitution */
+         for (j = 0; j < w; j++)
+         {
+            work[j] *= pivot[j];
+         }
+         for (k = 1; k < line_size; k++)
+         {
+            kj = k * w;
+            for (j = 0; j < w; j++)
+            {
+               work[kj + j] = (work[kj + j] - lower[kj + j] * work[kj - w + j]) * pivot[kj + j];
+            }
+         }
+
+         /* backward substitution */
+         for (k = line_size - 2; k >= 0; k--)
+         {
+            kj = k * w;
+            for (j = 0; j < w; j++)
+            {
+               work[kj + j] -= upper[kj + j] * work[kj + w + j];
+            }
+         }
+
+         /* scatter solution */
+         for (j = 0; j < w; j++)
+         {
+            xi = hypre_CycRedLineStart(ndim, cdir, x_dbox, hypre_BoxIMin(base_box),
+                                       base_stride, loop_size, jstart + j);
+            for (k = 0; k < line_size; k++)
+            {
+               xp[xi + k * xstride] = work[k * w + j];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -504,6 +933,19 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    HYPRE_MemoryLocation    memory_location = hypre_StructMatrixMemoryLocation(A);
 
+   /*-----------------------------------------------------
+    * Use the batched line solver if possible
+    *-----------------------------------------------------*/
+
+   if (cyc_red_data -> batch_lines)
+   {
+      hypre_CycRedSetupLines(cyc_red_vdata, A);
+      if (cyc_red_data -> batched)
+      {
+         return hypre_error_flag;
+      }
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -812,6 +1254,15 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 
    hypre_BeginTiming(cyc_red_data -> time_index);
 
+   if (cyc_red_data -> batched)
+   {
+      hypre_CycRedSolveLines(cyc_red_vdata, b, x);
+
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
 
    /*--------------------------------------------------
     * Initialize some things
@@ -1200,6 +1651,25 @@ hypre_CyclicReductionSetCDir( void        *cyc_red_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CyclicReductionSetBatchLines
+ *
+ * If batch_lines is nonzero, lines that are owned by a single process are
+ * solved in batches with the Thomas algorithm instead of cyclic reduction.
+ * Must be called before setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CyclicReductionSetBatchLines( void        *cyc_red_vdata,
+                                    HYPRE_Int    batch_lines )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *)cyc_red_vdata;
+
+   (cyc_red_data -> batch_lines) = batch_lines;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionDestroy
  *--------------------------------------------------------------------------*/
@@ -1216,26 +1686,37 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
       HYPRE_MemoryLocation memory_location = cyc_red_data -> memory_location;
 
       hypre_BoxArrayDestroy(cyc_red_data -> base_points);
-      hypre_StructGridDestroy(cyc_red_data -> grid_l[0]);
-      hypre_StructMatrixDestroy(cyc_red_data -> A_l[0]);
-      hypre_StructVectorDestroy(cyc_red_data -> x_l[0]);
-      for (l = 0; l < ((cyc_red_data -> num_levels) - 1); l++)
+      if (cyc_red_data -> batched)
+      {
+         hypre_TFree(cyc_red_data -> line_offsets, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> line_lower, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> line_pivot, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> line_upper, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> line_work, HYPRE_MEMORY_HOST);
+      }
+      else
       {
-         hypre_StructGridDestroy(cyc_red_data -> grid_l[l + 1]);
+         hypre_StructGridDestroy(cyc_red_data -> grid_l[0]);
+         hypre_StructMatrixDestroy(cyc_red_data -> A_l[0]);
+         hypre_StructVectorDestroy(cyc_red_data -> x_l[0]);
+         for (l = 0; l < ((cyc_red_data -> num_levels) - 1); l++)
+         {
+            hypre_StructGridDestroy(cyc_red_data -> grid_l[l + 1]);
+            hypre_BoxArrayDestroy(cyc_red_data -> fine_points_l[l]);
+            hypre_StructMatrixDestroy(cyc_red_data -> A_l[l + 1]);
+            hypre_StructVectorDestroy(cyc_red_data -> x_l[l + 1]);
+            hypre_ComputePkgDestroy(cyc_red_data -> down_compute_pkg_l[l]);
+            hypre_ComputePkgDestroy(cyc_red_data -> up_compute_pkg_l[l]);
+         }
          hypre_BoxArrayDestroy(cyc_red_data -> fine_points_l[l]);
-         hypre_StructMatrixDestroy(cyc_red_data -> A_l[l + 1]);
-         hypre_StructVectorDestroy(cyc_red_data -> x_l[l + 1]);
-         hypre_ComputePkgDestroy(cyc_red_data -> down_compute_pkg_l[l]);
-         hypre_ComputePkgDestroy(cyc_red_data -> up_compute_pkg_l[l]);
+         hypre_TFree(cyc_red_data -> data, memory_location);
+         hypre_TFree(cyc_red_data -> grid_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> fine_points_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> A_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> x_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> down_compute_pkg_l, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> up_compute_pkg_l, HYPRE_MEMORY_HOST);
       }
-      hypre_BoxArrayDestroy(cyc_red_data -> fine_points_l[l]);
-      hypre_TFree(cyc_red_data -> data, memory_location);
-      hypre_TFree(cyc_red_data -> grid_l, HYPRE_MEMORY_HOST);
-      hypre_TFree(cyc_red_data -> fine_points_l, HYPRE_MEMORY_HOST);
-      hypre_TFree(cyc_red_data -> A_l, HYPRE_MEMORY_HOST);
-      hypre_TFree(cyc_red_data -> x_l, HYPRE_MEMORY_HOST);
-      hypre_TFree(cyc_red_data -> down_compute_pkg_l, HYPRE_MEMORY_HOST);
-      hypre_TFree(cyc_red_data -> up_compute_pkg_l, HYPRE_MEMORY_HOST);
 
       hypre_FinalizeTiming(cyc_red_data -> time_index);
       hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
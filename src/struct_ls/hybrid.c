@@ -463,6 +463,8 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   pcg_functions->InnerProdBegin = hypre_StructKrylovInnerProdBegin;
+   pcg_functions->InnerProdEnd   = hypre_StructKrylovInnerProdEnd;
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
    hypre_PCGSetTol(krylov_solver, tol);
@@ -138,6 +138,44 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdBegin( HYPRE_Int          n,
+                                  void             **x,
+                                  void             **y,
+                                  HYPRE_Real        *result,
+                                  hypre_MPI_Request *request )
+{
+   MPI_Comm   comm = hypre_StructVectorComm((hypre_StructVector *) x[0]);
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = hypre_StructInnerProdLocal( (hypre_StructVector *) x[k],
+                                              (hypre_StructVector *) y[k] );
+   }
+
+   hypre_MPI_Iallreduce(hypre_MPI_IN_PLACE, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdEnd( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
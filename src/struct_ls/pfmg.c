@@ -37,6 +37,7 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)     = 1;
    (pfmg_data -> num_post_relax)    = 1;
    (pfmg_data -> skip_relax)        = 1;
+   (pfmg_data -> rb_temporal_block) = 0;
    (pfmg_data -> logging)           = 0;
    (pfmg_data -> print_level)       = 0;
 
@@ -406,6 +407,31 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRBTemporalBlock( void *pfmg_vdata,
+                              HYPRE_Int  rb_temporal_block )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> rb_temporal_block) = rb_temporal_block;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRBTemporalBlock( void *pfmg_vdata,
+                              HYPRE_Int *rb_temporal_block )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *rb_temporal_block = (pfmg_data -> rb_temporal_block);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
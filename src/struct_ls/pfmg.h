@@ -36,6 +36,7 @@ typedef struct
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
    HYPRE_Int             skip_relax;     /* flag to allow skipping relaxation */
+   HYPRE_Int             rb_temporal_block; /* red/black half-sweeps per pass */
    HYPRE_Real            relax_weight;
    HYPRE_Real            dxyz[3];     /* parameters used to determine cdir */
 
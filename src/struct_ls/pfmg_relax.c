@@ -17,6 +17,13 @@ typedef struct
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
+   /* weighted Jacobi for matrices with a coefficient generator */
+   hypre_StructVector     *gen_dinv;    /* inverse of the diagonal */
+   hypre_StructVector     *gen_t;       /* temp vector */
+   void                   *gen_matvec_data;
+   HYPRE_Int               gen_max_iter;
+   HYPRE_Int               gen_zero_guess;
+
 } hypre_PFMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -32,6 +39,7 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> gen_max_iter) = 1000;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +56,11 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_StructVectorDestroy(pfmg_relax_data -> gen_dinv);
+      if (pfmg_relax_data -> gen_matvec_data)
+      {
+         hypre_StructMatvecDestroy(pfmg_relax_data -> gen_matvec_data);
+      }
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -67,6 +80,11 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
    HYPRE_Int    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      return hypre_PFMGRelaxGen(pfmg_relax_vdata, A, b, x);
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -104,6 +122,11 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+      return hypre_PFMGRelaxGenSetup(pfmg_relax_vdata, A, b, x);
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -254,6 +277,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   (pfmg_relax_data -> gen_max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -269,6 +293,21 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   (pfmg_relax_data -> gen_zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlock( void  *pfmg_relax_vdata,
+                                 HYPRE_Int    temporal_block   )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetTemporalBlock((pfmg_relax_data -> rb_relax_data), temporal_block);
 
    return hypre_error_flag;
 }
@@ -283,7 +322,175 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
+   (pfmg_relax_data -> gen_t) = t;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxGenSetup
+ * Setup for matrices with a coefficient generator: the inverse diagonal is
+ * the only coefficient data stored.  Only Jacobi relaxation is supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxGenSetup( void               *pfmg_relax_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_StructVector *b,
+                         hypre_StructVector *x                )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   HYPRE_Int            ndim = hypre_StructMatrixNDim(A);
+   hypre_StructGrid    *grid = hypre_StructMatrixGrid(A);
+   hypre_BoxArray      *boxes = hypre_StructGridBoxes(grid);
+   hypre_StructVector  *dinv;
+   hypre_Box           *box;
+   hypre_Box           *d_data_box;
+   HYPRE_Complex       *dp;
+   HYPRE_Complex       *diag;
+   hypre_Index          diag_index;
+   hypre_Index          loop_size;
+   hypre_IndexRef       start;
+   hypre_Index          unit_stride;
+   HYPRE_Int            diag_rank, max_volume, i;
+
+   if ((pfmg_relax_data -> relax_type) != 0 && (pfmg_relax_data -> relax_type) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Only Jacobi relaxation is supported for generated matrices!");
+      return hypre_error_flag;
+   }
+
+   hypre_SetIndex3(diag_index, 0, 0, 0);
+   diag_rank = hypre_StructStencilElementRank(hypre_StructMatrixStencil(A), diag_index);
+   hypre_SetIndex(unit_stride, 1);
+
+   hypre_StructVectorDestroy(pfmg_relax_data -> gen_dinv);
+   dinv = hypre_StructVectorCreate(hypre_StructMatrixComm(A), grid);
+   hypre_StructVectorInitialize(dinv);
+
+   max_volume = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      max_volume = hypre_max(max_volume, hypre_BoxVolume(hypre_BoxArrayBox(boxes, i)));
+   }
+   diag = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      d_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(dinv), i);
+      dp = hypre_StructVectorBoxData(dinv, i);
+
+      hypre_StructMatrixGenerateValues(A, box, diag_rank, diag);
+
+      hypre_BoxGetSize(box, loop_size);
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          d_data_box, start, unit_stride, di,
+                          box, start, unit_stride, gi);
+      {
+         dp[di] = 1.0 / diag[gi];
+      }
+      hypre_BoxLoop2End(di, gi);
+   }
+
+   hypre_TFree(diag, HYPRE_MEMORY_HOST);
+
+   (pfmg_relax_data -> gen_dinv) = dinv;
+
+   if (pfmg_relax_data -> gen_matvec_data)
+   {
+      hypre_StructMatvecDestroy(pfmg_relax_data -> gen_matvec_data);
+   }
+   (pfmg_relax_data -> gen_matvec_data) = hypre_StructMatvecCreate();
+   hypre_StructMatvecSetup((pfmg_relax_data -> gen_matvec_data), A, x);
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxGen
+ * Weighted Jacobi, x += w D^{-1} (b - A x), for matrices with a coefficient
+ * generator.  The residual is computed with the on-the-fly matvec.  Jacobi
+ * (type 0) uses a unit weight.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxGen( void               *pfmg_relax_vdata,
+                    hypre_StructMatrix *A,
+                    hypre_StructVector *b,
+                    hypre_StructVector *x                )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   HYPRE_Int            ndim        = hypre_StructMatrixNDim(A);
+   hypre_StructVector  *dinv        = (pfmg_relax_data -> gen_dinv);
+   hypre_StructVector  *t           = (pfmg_relax_data -> gen_t);
+   HYPRE_Int            max_iter    = (pfmg_relax_data -> gen_max_iter);
+   HYPRE_Int            zero_guess  = (pfmg_relax_data -> gen_zero_guess);
+   HYPRE_Real           weight;
+
+   hypre_BoxArray      *boxes;
+   hypre_Box           *box;
+   hypre_Box           *d_data_box;
+   hypre_Box           *r_data_box;
+   hypre_Box           *x_data_box;
+   HYPRE_Complex       *dp;
+   HYPRE_Complex       *rp;
+   HYPRE_Complex       *xp;
+   hypre_Index          loop_size;
+   hypre_IndexRef       start;
+   hypre_Index          unit_stride;
+   HYPRE_Int            iter, i;
+
+   weight = ((pfmg_relax_data -> relax_type) == 0) ? 1.0 : (pfmg_relax_data -> jacobi_weight);
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      /* r = b for a zero initial guess, r = b - A x otherwise */
+      if (zero_guess && iter == 0)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+         hypre_StructCopy(b, t);
+      }
+      else
+      {
+         hypre_StructCopy(b, t);
+         hypre_StructMatvecCompute((pfmg_relax_data -> gen_matvec_data), -1.0, A, x, 1.0, t);
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box   = hypre_BoxArrayBox(boxes, i);
+         start = hypre_BoxIMin(box);
+
+         d_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(dinv), i);
+         r_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+         x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+         dp = hypre_StructVectorBoxData(dinv, i);
+         rp = hypre_StructVectorBoxData(t, i);
+         xp = hypre_StructVectorBoxData(x, i);
+
+         hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(xp,rp,dp)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             d_data_box, start, unit_stride, di,
+                             r_data_box, start, unit_stride, ri,
+                             x_data_box, start, unit_stride, xi);
+         {
+            xp[xi] += weight * dp[di] * rp[ri];
+         }
+         hypre_BoxLoop3End(di, ri, xi);
+#undef DEVICE_VAR
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -35,6 +35,9 @@
 #endif
 #define MAX_DEPTH 7
 
+/* maximum number of slabs per box for generated matrix coefficients */
+#define HYPRE_PFMG_GEN_NUM_SLABS 8
+
 HYPRE_Int hypre_StructGetNonzeroDirection(hypre_Index shape)
 {
    HYPRE_Int Astenc = 0;
@@ -73,6 +76,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight = (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             rb_temporal_block = (pfmg_data -> rb_temporal_block);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -137,6 +141,20 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /*-----------------------------------------------------
+    * A matrix with a coefficient generator is relaxed with
+    * matrix-free Jacobi on the finest grid.
+    *-----------------------------------------------------*/
+
+   if (hypre_StructMatrixCoeffFcn(A) && relax_type != 0 && relax_type != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Only Jacobi relaxation is supported for generated matrices!");
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -594,20 +612,29 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGSetFIndex(cdir, findex);
       hypre_PFMGSetStride(cdir, stride);
 
-      /* set up interpolation operator */
-      hypre_PFMGSetupInterpOp(A_l[l], cdir, findex, stride, P_l[l], rap_type);
+      if (hypre_StructMatrixCoeffFcn(A_l[l]))
+      {
+         /* set up the interpolation and coarse grid operators */
+         hypre_PFMGGenSetupOps(A_l[l], cdir, cindex, findex, stride, rap_type,
+                               P_l[l], A_l[l + 1]);
+      }
+      else
+      {
+         /* set up interpolation operator */
+         hypre_PFMGSetupInterpOp(A_l[l], cdir, findex, stride, P_l[l], rap_type);
 
-      /* set up the restriction operator */
+         /* set up the restriction operator */
 #if 0
-      /* Allow R != PT for non symmetric case */
-      if (!hypre_StructMatrixSymmetric(A))
-         hypre_PFMGSetupRestrictOp(A_l[l], tx_l[l],
-                                   cdir, cindex, stride, RT_l[l]);
+         /* Allow R != PT for non symmetric case */
+         if (!hypre_StructMatrixSymmetric(A))
+            hypre_PFMGSetupRestrictOp(A_l[l], tx_l[l],
+                                      cdir, cindex, stride, RT_l[l]);
 #endif
 
-      /* set up the coarse grid operator */
-      hypre_PFMGSetupRAPOp(RT_l[l], A_l[l], P_l[l],
-                           cdir, cindex, stride, rap_type, A_l[l + 1]);
+         /* set up the coarse grid operator */
+         hypre_PFMGSetupRAPOp(RT_l[l], A_l[l], P_l[l],
+                              cdir, cindex, stride, rap_type, A_l[l + 1]);
+      }
 
       /* set up the interpolation routine */
       interp_data_l[l] = hypre_SemiInterpCreate();
@@ -637,7 +664,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
     * point.
     *-----------------------------------------------------*/
 
-   if ( hypre_ZeroDiagonal(A_l[l]))
+   if (!hypre_StructMatrixCoeffFcn(A_l[l]) && hypre_ZeroDiagonal(A_l[l]))
    {
       active_l[l] = 0;
    }
@@ -660,6 +687,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   hypre_PFMGRelaxSetTemporalBlock(relax_data_l[0], rb_temporal_block);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -680,6 +708,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetTemporalBlock(relax_data_l[l], rb_temporal_block);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
@@ -754,6 +783,194 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGGenSlabs
+ * Splits a box into slabs along its last dimension.  The coefficients of a
+ * matrix with a coefficient generator are generated a slab at a time.
+ *--------------------------------------------------------------------------*/
+
+hypre_BoxArray *
+hypre_PFMGGenSlabs( hypre_Box *box )
+{
+   HYPRE_Int        ndim = hypre_BoxNDim(box);
+   HYPRE_Int        d    = ndim - 1;
+   HYPRE_Int        size = hypre_BoxSizeD(box, d);
+   hypre_BoxArray  *slabs;
+   hypre_Box       *slab;
+   HYPRE_Int        nslabs, k;
+
+   /* keep slabs at least four points thick */
+   nslabs = hypre_max(1, hypre_min(HYPRE_PFMG_GEN_NUM_SLABS, size / 4));
+
+   slabs = hypre_BoxArrayCreate(nslabs, ndim);
+   for (k = 0; k < nslabs; k++)
+   {
+      slab = hypre_BoxArrayBox(slabs, k);
+      hypre_CopyBox(box, slab);
+      hypre_BoxIMinD(slab, d) = hypre_BoxIMinD(box, d) + (k * size) / nslabs;
+      hypre_BoxIMaxD(slab, d) = hypre_BoxIMinD(box, d) + ((k + 1) * size) / nslabs - 1;
+   }
+
+   return slabs;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGGenCopyValues
+ * Copies the coefficients of box 0 of 'from' into box 'to_bi' of 'to' at the
+ * points of the coarsened grid that come from the fine grid box 'fbox'.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGGenCopyValues( hypre_StructMatrix *from,
+                         hypre_StructMatrix *to,
+                         HYPRE_Int           to_bi,
+                         hypre_Box          *fbox,
+                         hypre_Index         index,
+                         hypre_Index         stride )
+{
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(to);
+   hypre_Box            *cbox;
+   hypre_Box            *from_dbox;
+   hypre_Box            *to_dbox;
+   HYPRE_Real           *fp;
+   HYPRE_Real           *tp;
+   hypre_Index           loop_size;
+   hypre_IndexRef        start;
+   hypre_Index           unit_stride;
+   HYPRE_Int             s;
+
+   cbox = hypre_BoxDuplicate(fbox);
+   hypre_ProjectBox(cbox, index, stride);
+   hypre_StructMapFineToCoarse(hypre_BoxIMin(cbox), index, stride, hypre_BoxIMin(cbox));
+   hypre_StructMapFineToCoarse(hypre_BoxIMax(cbox), index, stride, hypre_BoxIMax(cbox));
+
+   if (hypre_BoxVolume(cbox))
+   {
+      from_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(from), 0);
+      to_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(to), to_bi);
+      start     = hypre_BoxIMin(cbox);
+      hypre_SetIndex(unit_stride, 1);
+      hypre_BoxGetSize(cbox, loop_size);
+
+      for (s = 0; s < hypre_StructStencilSize(hypre_StructMatrixStencil(to)); s++)
+      {
+         fp = hypre_StructMatrixBoxData(from, 0, s);
+         tp = hypre_StructMatrixBoxData(to, to_bi, s);
+
+#define DEVICE_VAR is_device_ptr(tp,fp)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             from_dbox, start, unit_stride, fi,
+                             to_dbox, start, unit_stride, ti);
+         {
+            tp[ti] = fp[fi];
+         }
+         hypre_BoxLoop2End(fi, ti);
+#undef DEVICE_VAR
+      }
+   }
+
+   hypre_BoxDestroy(cbox);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGGenSetupOps
+ * Sets up the interpolation operator P and the coarse grid operator Ac for a
+ * matrix A with a coefficient generator.  A is generated on one slab of a box
+ * at a time, together with a layer of neighboring points.  P and Ac are set up
+ * on this piece with the usual routines and copied into place, so A is never
+ * stored as a whole.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGGenSetupOps( hypre_StructMatrix *A,
+                       HYPRE_Int           cdir,
+                       hypre_Index         cindex,
+                       hypre_Index         findex,
+                       hypre_Index         stride,
+                       HYPRE_Int           rap_type,
+                       hypre_StructMatrix *P,
+                       hypre_StructMatrix *Ac )
+{
+   HYPRE_Int             ndim        = hypre_StructMatrixNDim(A);
+   hypre_StructGrid     *fgrid       = hypre_StructMatrixGrid(A);
+   hypre_BoxArray       *fgrid_boxes = hypre_StructGridBoxes(fgrid);
+   HYPRE_Int            *fgrid_ids   = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid       = hypre_StructMatrixGrid(Ac);
+   hypre_BoxArray       *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids   = hypre_StructGridIDs(cgrid);
+
+   hypre_BoxArray       *slabs;
+   hypre_Box            *slab;
+   hypre_Box            *grow_box;
+   hypre_StructGrid     *slab_P_grid;
+   hypre_StructGrid     *slab_cgrid;
+   hypre_StructMatrix   *slab_A;
+   hypre_StructMatrix   *slab_P;
+   hypre_StructMatrix   *slab_Ac;
+   HYPRE_Int             fi, ci, k, has_coarse;
+
+   grow_box = hypre_BoxCreate(ndim);
+
+   ci = 0;
+   hypre_ForBoxI(fi, fgrid_boxes)
+   {
+      /* the coarse grid is pruned of empty boxes */
+      has_coarse = (ci < hypre_BoxArraySize(cgrid_boxes) && cgrid_ids[ci] == fgrid_ids[fi]);
+
+      slabs = hypre_PFMGGenSlabs(hypre_BoxArrayBox(fgrid_boxes, fi));
+      hypre_ForBoxI(k, slabs)
+      {
+         slab = hypre_BoxArrayBox(slabs, k);
+         if (hypre_BoxVolume(slab) == 0)
+         {
+            continue;
+         }
+
+         /* the operators at the slab points couple to neighboring points */
+         hypre_CopyBox(slab, grow_box);
+         hypre_BoxGrowByValue(grow_box, 1);
+         slab_A = hypre_StructMatrixMaterializeBox(A, grow_box);
+
+         hypre_StructCoarsen(hypre_StructMatrixGrid(slab_A), findex, stride, 0, &slab_P_grid);
+         hypre_StructCoarsen(hypre_StructMatrixGrid(slab_A), cindex, stride, 1, &slab_cgrid);
+
+         slab_P = hypre_PFMGCreateInterpOp(slab_A, slab_P_grid, cdir, rap_type);
+         hypre_StructMatrixInitialize(slab_P);
+         hypre_PFMGSetupInterpOp(slab_A, cdir, findex, stride, slab_P, rap_type);
+         hypre_PFMGGenCopyValues(slab_P, P, fi, slab, findex, stride);
+
+         if (has_coarse)
+         {
+            slab_Ac = hypre_PFMGCreateRAPOp(slab_P, slab_A, slab_P, slab_cgrid, cdir, rap_type);
+            hypre_StructMatrixInitialize(slab_Ac);
+            hypre_PFMGSetupRAPOp(slab_P, slab_A, slab_P, cdir, cindex, stride, rap_type, slab_Ac);
+            hypre_PFMGGenCopyValues(slab_Ac, Ac, ci, slab, cindex, stride);
+            hypre_StructMatrixDestroy(slab_Ac);
+         }
+
+         hypre_StructMatrixDestroy(slab_P);
+         hypre_StructMatrixDestroy(slab_A);
+         hypre_StructGridDestroy(slab_P_grid);
+         hypre_StructGridDestroy(slab_cgrid);
+      }
+      hypre_BoxArrayDestroy(slabs);
+
+      if (has_coarse)
+      {
+         ci++;
+      }
+   }
+
+   hypre_BoxDestroy(grow_box);
+
+   hypre_StructInterpAssemble(A, P, 0, cdir, findex, stride);
+   hypre_StructMatrixAssemble(Ac);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -764,21 +981,13 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
                        HYPRE_Real         *deviation)
 {
    hypre_BoxArray        *compute_boxes;
+   hypre_BoxArray        *slabs;
+   hypre_StructMatrix    *A_slab;
    HYPRE_Real             cxyz[3], sqcxyz[3], tcxyz[3];
    HYPRE_Real             cxyz_max;
    HYPRE_Int              tot_size;
-   hypre_StructStencil   *stencil;
-   //hypre_Index           *stencil_shape;
-   HYPRE_Int              stencil_size;
    HYPRE_Int              constant_coefficient;
-   HYPRE_Int              i, d;
-
-   /*----------------------------------------------------------
-    * Initialize some things
-    *----------------------------------------------------------*/
-   stencil       = hypre_StructMatrixStencil(A);
-   //stencil_shape = hypre_StructStencilShape(stencil);
-   stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int              i, k, d;
 
    /*----------------------------------------------------------
     * Compute cxyz (use arithmetic mean)
@@ -792,35 +1001,21 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
 
    hypre_ForBoxI(i, compute_boxes)
    {
-      /* all coefficients constant or variable diagonal */
-      if ( constant_coefficient )
+      /* generated coefficients, a slab at a time */
+      if (hypre_StructMatrixCoeffFcn(A))
       {
-         hypre_PFMGComputeDxyz_CS(i, A, cxyz, sqcxyz);
+         slabs = hypre_PFMGGenSlabs(hypre_BoxArrayBox(compute_boxes, i));
+         hypre_ForBoxI(k, slabs)
+         {
+            A_slab = hypre_StructMatrixMaterializeBox(A, hypre_BoxArrayBox(slabs, k));
+            hypre_PFMGComputeDxyzBox(0, A_slab, cxyz, sqcxyz);
+            hypre_StructMatrixDestroy(A_slab);
+         }
+         hypre_BoxArrayDestroy(slabs);
       }
-      /* constant_coefficient==0, all coefficients vary with space */
       else
       {
-         switch (stencil_size)
-         {
-            case 5:
-               hypre_PFMGComputeDxyz_SS5 (i, A, cxyz, sqcxyz);
-               break;
-            case 9:
-               hypre_PFMGComputeDxyz_SS9 (i, A, cxyz, sqcxyz);
-               break;
-            case 7:
-               hypre_PFMGComputeDxyz_SS7 (i, A, cxyz, sqcxyz);
-               break;
-            case 19:
-               hypre_PFMGComputeDxyz_SS19(i, A, cxyz, sqcxyz);
-               break;
-            case 27:
-               hypre_PFMGComputeDxyz_SS27(i, A, cxyz, sqcxyz);
-               break;
-            default:
-               hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
-               hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
-         }
+         hypre_PFMGComputeDxyzBox(i, A, cxyz, sqcxyz);
       }
    }
 
@@ -892,6 +1087,55 @@ hypre_PFMGComputeDxyz( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGComputeDxyzBox
+ * Adds the contributions of box i of A to the sums in hypre_PFMGComputeDxyz.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGComputeDxyzBox( HYPRE_Int           i,
+                          hypre_StructMatrix *A,
+                          HYPRE_Real         *cxyz,
+                          HYPRE_Real         *sqcxyz)
+{
+   HYPRE_Int              stencil_size;
+
+   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   /* all coefficients constant or variable diagonal */
+   if ( hypre_StructMatrixConstantCoefficient(A) )
+   {
+      hypre_PFMGComputeDxyz_CS(i, A, cxyz, sqcxyz);
+   }
+   /* constant_coefficient==0, all coefficients vary with space */
+   else
+   {
+      switch (stencil_size)
+      {
+         case 5:
+            hypre_PFMGComputeDxyz_SS5 (i, A, cxyz, sqcxyz);
+            break;
+         case 9:
+            hypre_PFMGComputeDxyz_SS9 (i, A, cxyz, sqcxyz);
+            break;
+         case 7:
+            hypre_PFMGComputeDxyz_SS7 (i, A, cxyz, sqcxyz);
+            break;
+         case 19:
+            hypre_PFMGComputeDxyz_SS19(i, A, cxyz, sqcxyz);
+            break;
+         case 27:
+            hypre_PFMGComputeDxyz_SS27(i, A, cxyz, sqcxyz);
+            break;
+         default:
+            hypre_printf("hypre error: unsupported stencil size %d\n", stencil_size);
+            hypre_MPI_Abort(hypre_MPI_COMM_WORLD, 1);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
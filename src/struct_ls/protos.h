@@ -19,6 +19,11 @@ hypre_StructMatrix *hypre_CycRedCreateCoarseOp ( hypre_StructMatrix *A,
                                                  hypre_StructGrid *coarse_grid, HYPRE_Int cdir );
 HYPRE_Int hypre_CycRedSetupCoarseOp ( hypre_StructMatrix *A, hypre_StructMatrix *Ac,
                                       hypre_Index cindex, hypre_Index cstride, HYPRE_Int cdir );
+HYPRE_Int hypre_CycRedLineStart ( HYPRE_Int ndim, HYPRE_Int cdir, hypre_Box *data_box,
+                                  hypre_Index start, hypre_Index stride, hypre_Index loop_size, HYPRE_Int line );
+HYPRE_Int hypre_CycRedSetupLines ( void *cyc_red_vdata, hypre_StructMatrix *A );
+HYPRE_Int hypre_CycRedSolveLines ( void *cyc_red_vdata, hypre_StructVector *b,
+                                   hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReductionSetup ( void *cyc_red_vdata, hypre_StructMatrix *A,
                                        hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -26,6 +31,7 @@ HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hy
 HYPRE_Int hypre_CyclicReductionSetCDir ( void *cyc_red_vdata, HYPRE_Int cdir );
 HYPRE_Int hypre_CyclicReductionSetBase ( void *cyc_red_vdata, hypre_Index base_index,
                                          hypre_Index base_stride );
+HYPRE_Int hypre_CyclicReductionSetBatchLines ( void *cyc_red_vdata, HYPRE_Int batch_lines );
 HYPRE_Int hypre_CyclicReductionDestroy ( void *cyc_red_vdata );
 HYPRE_Int hypre_CyclicReductionSetMaxLevel( void   *cyc_red_vdata, HYPRE_Int   max_level  );
 
@@ -98,6 +104,9 @@ HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data, HYPRE_Complex alpha, voi
                                      HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_StructKrylovInnerProdBegin ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                             hypre_MPI_Request *request );
+HYPRE_Int hypre_StructKrylovInnerProdEnd ( hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
@@ -211,6 +220,8 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetRBTemporalBlock ( void *pfmg_vdata, HYPRE_Int rb_temporal_block );
+HYPRE_Int hypre_PFMGGetRBTemporalBlock ( void *pfmg_vdata, HYPRE_Int *rb_temporal_block );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -235,13 +246,27 @@ HYPRE_Int hypre_PFMGRelaxSetPostRelax ( void *pfmg_relax_vdata );
 HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
+HYPRE_Int hypre_PFMGRelaxSetTemporalBlock ( void *pfmg_relax_vdata, HYPRE_Int temporal_block );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxGenSetup ( void *pfmg_relax_vdata, hypre_StructMatrix *A,
+                                    hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_PFMGRelaxGen ( void *pfmg_relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                               hypre_StructVector *x );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                             hypre_StructVector *x );
+hypre_BoxArray *hypre_PFMGGenSlabs ( hypre_Box *box );
+HYPRE_Int hypre_PFMGGenCopyValues ( hypre_StructMatrix *from, hypre_StructMatrix *to,
+                                    HYPRE_Int to_bi, hypre_Box *fbox, hypre_Index index,
+                                    hypre_Index stride );
+HYPRE_Int hypre_PFMGGenSetupOps ( hypre_StructMatrix *A, HYPRE_Int cdir, hypre_Index cindex,
+                                  hypre_Index findex, hypre_Index stride, HYPRE_Int rap_type,
+                                  hypre_StructMatrix *P, hypre_StructMatrix *Ac );
 HYPRE_Int hypre_PFMGComputeDxyz ( hypre_StructMatrix *A, HYPRE_Real *dxyz, HYPRE_Real *mean,
                                   HYPRE_Real *deviation);
+HYPRE_Int hypre_PFMGComputeDxyzBox ( HYPRE_Int i, hypre_StructMatrix *A, HYPRE_Real *cxyz,
+                                     HYPRE_Real *sqcxyz);
 HYPRE_Int hypre_PFMGComputeDxyz_CS  ( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE_Real *cxyz,
                                       HYPRE_Real *sqcxyz);
 HYPRE_Int hypre_PFMGComputeDxyz_SS5 ( HYPRE_Int bi, hypre_StructMatrix *A, HYPRE_Real *cxyz,
@@ -380,11 +405,18 @@ HYPRE_Int hypre_RedBlackGSSetup ( void *relax_vdata, hypre_StructMatrix *A, hypr
                                   hypre_StructVector *x );
 HYPRE_Int hypre_RedBlackGS ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                              hypre_StructVector *x );
+HYPRE_Int hypre_RedBlackGSBoxSweep ( hypre_StructMatrix *A, hypre_StructVector *b,
+                                     hypre_StructVector *x, HYPRE_Int i, hypre_Box *box, HYPRE_Int rb, HYPRE_Int diag_rank,
+                                     HYPRE_Int *offd );
+HYPRE_Int hypre_RedBlackGSTemporalSetup ( void *relax_vdata, hypre_StructMatrix *A );
+HYPRE_Int hypre_RedBlackGSTemporalBlock ( void *relax_vdata, hypre_StructMatrix *A,
+                                          hypre_StructVector *b, hypre_StructVector *x, HYPRE_Int rb, HYPRE_Int nsweeps );
 HYPRE_Int hypre_RedBlackGSSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_RedBlackGSSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_RedBlackGSSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_RedBlackGSSetStartRed ( void *relax_vdata );
 HYPRE_Int hypre_RedBlackGSSetStartBlack ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSSetTemporalBlock ( void *relax_vdata, HYPRE_Int temporal_block );
 
 /* semi.c */
 HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A, hypre_StructMatrix *P,
@@ -466,6 +498,8 @@ HYPRE_Int hypre_SMGSetLogging ( void *smg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_SMGGetLogging ( void *smg_vdata, HYPRE_Int *logging );
 HYPRE_Int hypre_SMGSetPrintLevel ( void *smg_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_SMGGetPrintLevel ( void *smg_vdata, HYPRE_Int *print_level );
+HYPRE_Int hypre_SMGSetBatchLines ( void *smg_vdata, HYPRE_Int batch_lines );
+HYPRE_Int hypre_SMGGetBatchLines ( void *smg_vdata, HYPRE_Int *batch_lines );
 HYPRE_Int hypre_SMGGetNumIterations ( void *smg_vdata, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_SMGPrintLogging ( void *smg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_SMGGetFinalRelativeResidualNorm ( void *smg_vdata,
@@ -513,6 +547,7 @@ HYPRE_Int hypre_SMGRelaxSetNewMatrixStencil ( void *relax_vdata,
 HYPRE_Int hypre_SMGRelaxSetupBaseBoxArray ( void *relax_vdata, hypre_StructMatrix *A,
                                             hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_SMGRelaxSetMaxLevel( void *relax_vdata, HYPRE_Int   num_max_level );
+HYPRE_Int hypre_SMGRelaxSetBatchLines ( void *relax_vdata, HYPRE_Int batch_lines );
 
 /* smg_residual.c */
 void *hypre_SMGResidualCreate ( void );
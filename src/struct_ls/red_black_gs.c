@@ -34,11 +34,16 @@ hypre_RedBlackGSCreate( MPI_Comm  comm )
    (relax_data -> rel_change)  = 0;
    (relax_data -> zero_guess)  = 0;
    (relax_data -> rb_start)    = 1;
+   (relax_data -> temporal_block) = 0;
    (relax_data -> flops)       = 0;
    (relax_data -> A)           = NULL;
    (relax_data -> b)           = NULL;
    (relax_data -> x)           = NULL;
    (relax_data -> compute_pkg) = NULL;
+   (relax_data -> tb_A)        = NULL;
+   (relax_data -> tb_b)        = NULL;
+   (relax_data -> tb_x)        = NULL;
+   (relax_data -> tb_comm_pkg) = NULL;
 
    return (void *) relax_data;
 }
@@ -57,6 +62,10 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> b);
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+      hypre_StructMatrixDestroy(relax_data -> tb_A);
+      hypre_StructVectorDestroy(relax_data -> tb_b);
+      hypre_StructVectorDestroy(relax_data -> tb_x);
+      hypre_CommPkgDestroy(relax_data -> tb_comm_pkg);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -112,6 +121,102 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    (relax_data -> diag_rank) = diag_rank;
    (relax_data -> compute_pkg) = compute_pkg;
 
+   hypre_RedBlackGSTemporalSetup(relax_vdata, A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSTemporalSetup
+ *
+ * Creates copies of A, b, and x with temporal_block ghost layers, and the
+ * package that exchanges these layers.  The ghost layers of the copy of A
+ * are filled once here.  Temporal blocking is left off for periodic grids,
+ * for constant or generated coefficients, and for grids that do not know
+ * their neighbor boxes temporal_block points away (coarse grids only gather
+ * neighbors within their max_distance).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSTemporalSetup( void               *relax_vdata,
+                               hypre_StructMatrix *A )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int              temporal_block = (relax_data -> temporal_block);
+   MPI_Comm               comm = hypre_StructMatrixComm(A);
+   hypre_StructGrid      *grid = hypre_StructMatrixGrid(A);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+
+   hypre_StructMatrix    *tb_A;
+   hypre_StructVector    *tb_b;
+   hypre_StructVector    *tb_x;
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *tb_comm_pkg;
+   HYPRE_Int              num_ghost[2 * HYPRE_MAXDIM];
+   HYPRE_Int              known;
+   HYPRE_Int              d;
+
+   hypre_StructMatrixDestroy(relax_data -> tb_A);
+   hypre_StructVectorDestroy(relax_data -> tb_b);
+   hypre_StructVectorDestroy(relax_data -> tb_x);
+   hypre_CommPkgDestroy(relax_data -> tb_comm_pkg);
+   (relax_data -> tb_A)        = NULL;
+   (relax_data -> tb_b)        = NULL;
+   (relax_data -> tb_x)        = NULL;
+   (relax_data -> tb_comm_pkg) = NULL;
+
+   if ( (temporal_block < 2) || (ndim < 2) ||
+        (hypre_StructMatrixConstantCoefficient(A) != 0) ||
+        hypre_StructMatrixCoeffFcn(A) )
+   {
+      return hypre_error_flag;
+   }
+   hypre_BoxManGetAllGlobalKnown(hypre_StructGridBoxMan(grid), &known);
+   for (d = 0; d < ndim; d++)
+   {
+      if ( (hypre_IndexD(hypre_StructGridPeriodic(grid), d) != 0) ||
+           (!known && hypre_IndexD(hypre_StructGridMaxDistance(grid), d) < temporal_block) )
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2 * ndim) ? temporal_block : 0;
+   }
+
+   /* assembling fills the ghost layers, and sets the identity outside the domain */
+   tb_A = hypre_StructMatrixCreate(comm, grid, hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSymmetric(tb_A) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetNumGhost(tb_A, num_ghost);
+   hypre_StructMatrixInitialize(tb_A);
+   hypre_StructMatrixMigrate(A, tb_A);
+   hypre_StructMatrixAssemble(tb_A);
+
+   tb_b = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(tb_b, num_ghost);
+   hypre_StructVectorInitialize(tb_b);
+   hypre_StructVectorAssemble(tb_b);
+
+   tb_x = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(tb_x, num_ghost);
+   hypre_StructVectorInitialize(tb_x);
+   hypre_StructVectorAssemble(tb_x);
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(tb_x),
+                       hypre_StructVectorDataSpace(tb_x),
+                       1, NULL, 0, comm, &tb_comm_pkg);
+   hypre_CommInfoDestroy(comm_info);
+
+   (relax_data -> tb_A)        = tb_A;
+   (relax_data -> tb_b)        = tb_b;
+   (relax_data -> tb_x)        = tb_x;
+   (relax_data -> tb_comm_pkg) = tb_comm_pkg;
+
    return hypre_error_flag;
 }
 
@@ -146,10 +251,11 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              Astart, Ani, Anj;
    HYPRE_Int              bstart, bni, bnj;
    HYPRE_Int              xstart, xni, xnj;
-   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
+   HYPRE_Int              xoff0 = 0, xoff1 = 0, xoff2 = 0, xoff3 = 0, xoff4 = 0, xoff5 = 0;
 
    HYPRE_Real            *Ap;
-   HYPRE_Real            *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
+   HYPRE_Real            *Ap0 = NULL, *Ap1 = NULL, *Ap2 = NULL;
+   HYPRE_Real            *Ap3 = NULL, *Ap4 = NULL, *Ap5 = NULL;
    HYPRE_Real            *bp;
    HYPRE_Real            *xp;
 
@@ -164,6 +270,7 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              iter, rb, redblack, d;
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
+   HYPRE_Int              nsweeps;
 
    /*----------------------------------------------------------
     * Initialize some things and deal with special cases
@@ -307,6 +414,15 @@ hypre_RedBlackGS( void               *relax_vdata,
     * Do regular iterations
     *----------------------------------------------------------*/
 
+   /* fuse the remaining half-sweeps in blocks of temporal_block */
+   nsweeps = 2 * max_iter - iter;
+   if (nsweeps > 1 && (relax_data -> tb_x) != NULL)
+   {
+      hypre_RedBlackGSTemporalBlock(relax_data, A, b, x, rb, nsweeps);
+      rb = (rb + nsweeps) % 2;
+      iter += nsweeps;
+   }
+
    while (iter < 2 * max_iter)
    {
       for (compute_i = 0; compute_i < 2; compute_i++)
@@ -377,33 +493,30 @@ hypre_RedBlackGS( void               *relax_vdata,
                   }
                }
 
-               switch (stencil_size)
+               if (stencil_size > 5)
                {
-                  case 7:
-                     Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
-                     Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
-                     xoff5 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[5]]);
-                     xoff4 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[4]]);
-
-                  case 5:
-                     Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
-                     Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
-                     xoff3 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[3]]);
-                     xoff2 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[2]]);
-
-                  case 3:
-                     Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
-                     Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
-                     xoff1 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[1]]);
-                     xoff0 = hypre_BoxOffsetDistance(
-                                x_dbox, stencil_shape[offd[0]]);
-                     break;
+                  Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
+                  Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
+                  xoff5 = hypre_BoxOffsetDistance(
+                             x_dbox, stencil_shape[offd[5]]);
+                  xoff4 = hypre_BoxOffsetDistance(
+                             x_dbox, stencil_shape[offd[4]]);
                }
+               if (stencil_size > 3)
+               {
+                  Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
+                  Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
+                  xoff3 = hypre_BoxOffsetDistance(
+                             x_dbox, stencil_shape[offd[3]]);
+                  xoff2 = hypre_BoxOffsetDistance(
+                             x_dbox, stencil_shape[offd[2]]);
+               }
+               Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
+               Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
+               xoff1 = hypre_BoxOffsetDistance(
+                          x_dbox, stencil_shape[offd[1]]);
+               xoff0 = hypre_BoxOffsetDistance(
+                          x_dbox, stencil_shape[offd[0]]);
 
                switch (stencil_size)
                {
@@ -485,6 +598,305 @@ hypre_RedBlackGS( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSBoxSweep
+ *
+ * Relax the points of color rb in the given box of grid box i.  When the
+ * box is a single plane (or row), the rows are mapped onto the outer loop so
+ * that they are still distributed over threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSBoxSweep( hypre_StructMatrix *A,
+                          hypre_StructVector *b,
+                          hypre_StructVector *x,
+                          HYPRE_Int           i,
+                          hypre_Box          *box,
+                          HYPRE_Int           rb,
+                          HYPRE_Int           diag_rank,
+                          HYPRE_Int          *offd )
+{
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+
+   hypre_Box             *A_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+
+   HYPRE_Int              Astart, Ani, Anj;
+   HYPRE_Int              bstart, bni, bnj;
+   HYPRE_Int              xstart, xni, xnj;
+   HYPRE_Int              xoff0 = 0, xoff1 = 0, xoff2 = 0, xoff3 = 0, xoff4 = 0, xoff5 = 0;
+
+   HYPRE_Real            *Ap;
+   HYPRE_Real            *Ap0 = NULL, *Ap1 = NULL, *Ap2 = NULL;
+   HYPRE_Real            *Ap3 = NULL, *Ap4 = NULL, *Ap5 = NULL;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *xp;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+
+   HYPRE_Int              redblack, d;
+   HYPRE_Int              ni, nj, nk;
+
+   stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+   stencil_size  = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+   x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+   Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
+   bp = hypre_StructVectorBoxData(b, i);
+   xp = hypre_StructVectorBoxData(x, i);
+
+   start  = hypre_BoxIMin(box);
+   hypre_BoxGetSize(box, loop_size);
+
+   /* Are we relaxing index start or start+(1,0,0)? */
+   redblack = rb;
+   for (d = 0; d < ndim; d++)
+   {
+      redblack += hypre_IndexD(start, d);
+   }
+   redblack = hypre_abs(redblack) % 2;
+
+   Astart = hypre_BoxIndexRank(A_dbox, start);
+   bstart = hypre_BoxIndexRank(b_dbox, start);
+   xstart = hypre_BoxIndexRank(x_dbox, start);
+   ni = hypre_IndexX(loop_size);
+   nj = hypre_IndexY(loop_size);
+   nk = hypre_IndexZ(loop_size);
+   Ani = hypre_BoxSizeX(A_dbox);
+   bni = hypre_BoxSizeX(b_dbox);
+   xni = hypre_BoxSizeX(x_dbox);
+   Anj = hypre_BoxSizeY(A_dbox);
+   bnj = hypre_BoxSizeY(b_dbox);
+   xnj = hypre_BoxSizeY(x_dbox);
+   if (ndim < 3)
+   {
+      nk = 1;
+      if (ndim < 2)
+      {
+         nj = 1;
+      }
+   }
+   if (nk == 1)
+   {
+      /* loop over the rows of a plane as if they were planes */
+      nk = nj;
+      nj = 1;
+      Anj = 1;
+      bnj = 1;
+      xnj = 1;
+   }
+
+   if (stencil_size > 5)
+   {
+      Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
+      Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
+      xoff5 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[5]]);
+      xoff4 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[4]]);
+   }
+   if (stencil_size > 3)
+   {
+      Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
+      Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
+      xoff3 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[3]]);
+      xoff2 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[2]]);
+   }
+   Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
+   Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
+   xoff1 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[1]]);
+   xoff0 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[0]]);
+
+   switch (stencil_size)
+   {
+      case 7:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3] -
+                Ap4[Ai] * xp[xi + xoff4] -
+                Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+         break;
+
+      case 5:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+         break;
+
+      case 3:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSTemporalBlock
+ *
+ * Do nsweeps red/black half-sweeps, starting with color rb, in blocks of
+ * temporal_block half-sweeps with one ghost exchange per block.  The result
+ * is identical to nsweeps calls of the regular half-sweep.
+ *
+ * The half-sweeps run on the copies from hypre_RedBlackGSTemporalSetup.
+ * After the exchange of the temporal_block ghost layers of x, half-sweep h
+ * (h = 1,...,s) of a block of s half-sweeps relaxes the box grown by s-h
+ * layers, so the ghost points are relaxed redundantly instead of being
+ * exchanged again.  The layers are relaxed in a wavefront along the slowest
+ * dimension, with half-sweep h lagging one plane behind half-sweep h-1, so
+ * that each plane of A, b, and x is loaded from memory once per block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSTemporalBlock( void               *relax_vdata,
+                               hypre_StructMatrix *A,
+                               hypre_StructVector *b,
+                               hypre_StructVector *x,
+                               HYPRE_Int           rb,
+                               HYPRE_Int           nsweeps )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int              temporal_block = (relax_data -> temporal_block);
+   HYPRE_Int              diag_rank   = (relax_data -> diag_rank);
+   hypre_StructMatrix    *tb_A        = (relax_data -> tb_A);
+   hypre_StructVector    *tb_b        = (relax_data -> tb_b);
+   hypre_StructVector    *tb_x        = (relax_data -> tb_x);
+   hypre_CommPkg         *tb_comm_pkg = (relax_data -> tb_comm_pkg);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+   HYPRE_Int              zdim = ndim - 1;
+
+   hypre_CommHandle      *comm_handle;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *region;
+   hypre_Box             *plane;
+   HYPRE_Complex         *bp;
+   HYPRE_Complex         *xp;
+
+   HYPRE_Int              stencil_size;
+   HYPRE_Int              offd[6];
+   HYPRE_Int              sweep, nblock;
+   HYPRE_Int              i, j, d, h, t, z;
+
+   stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   i = 0;
+   for (j = 0; j < stencil_size; j++)
+   {
+      if (j != diag_rank)
+      {
+         offd[i] = j;
+         i++;
+      }
+   }
+
+   boxes  = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   region = hypre_BoxCreate(ndim);
+   plane  = hypre_BoxCreate(ndim);
+
+   /* b does not change, so its ghost layers are exchanged once */
+   hypre_StructCopy(b, tb_b);
+   hypre_StructCopy(x, tb_x);
+   bp = hypre_StructVectorData(tb_b);
+   xp = hypre_StructVectorData(tb_x);
+   hypre_InitializeCommunication(tb_comm_pkg, bp, bp, 0, 0, &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+
+   for (sweep = 0; sweep < nsweeps; sweep += nblock)
+   {
+      nblock = hypre_min(temporal_block, nsweeps - sweep);
+
+      hypre_InitializeCommunication(tb_comm_pkg, xp, xp, 0, 0, &comm_handle);
+      hypre_FinalizeCommunication(comm_handle);
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         if (hypre_BoxVolume(box) == 0)
+         {
+            continue;
+         }
+
+         /* plane z of half-sweep h is relaxed at step t = z + h - 1 */
+         for (t = hypre_BoxIMinD(box, zdim) - nblock + 1;
+              t <= hypre_BoxIMaxD(box, zdim) + nblock - 1; t++)
+         {
+            for (h = 1; h <= nblock; h++)
+            {
+               hypre_CopyBox(box, region);
+               for (d = 0; d < ndim; d++)
+               {
+                  hypre_BoxIMinD(region, d) -= nblock - h;
+                  hypre_BoxIMaxD(region, d) += nblock - h;
+               }
+               z = t - (h - 1);
+               if ( (z >= hypre_BoxIMinD(region, zdim)) &&
+                    (z <= hypre_BoxIMaxD(region, zdim)) )
+               {
+                  hypre_CopyBox(region, plane);
+                  hypre_BoxIMinD(plane, zdim) = z;
+                  hypre_BoxIMaxD(plane, zdim) = z;
+                  hypre_RedBlackGSBoxSweep(tb_A, tb_b, tb_x, i, plane,
+                                           (rb + sweep + h - 1) % 2, diag_rank, offd);
+               }
+            }
+         }
+      }
+   }
+
+   hypre_StructCopy(tb_x, x);
+
+   hypre_BoxDestroy(region);
+   hypre_BoxDestroy(plane);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -553,3 +965,17 @@ hypre_RedBlackGSSetStartBlack( void *relax_vdata )
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetTemporalBlock( void *relax_vdata,
+                                  HYPRE_Int   temporal_block )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> temporal_block) = temporal_block;
+
+   return hypre_error_flag;
+}
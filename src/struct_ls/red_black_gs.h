@@ -18,6 +18,7 @@ typedef struct
    HYPRE_Int               rel_change;         /* not yet used */
    HYPRE_Int               zero_guess;
    HYPRE_Int               rb_start;
+   HYPRE_Int               temporal_block;     /* half-sweeps fused per pass */
 
    hypre_StructMatrix     *A;
    hypre_StructVector     *b;
@@ -27,6 +28,12 @@ typedef struct
 
    hypre_ComputePkg       *compute_pkg;
 
+   /* copies of A, b, and x with temporal_block ghost layers */
+   hypre_StructMatrix     *tb_A;
+   hypre_StructVector     *tb_b;
+   hypre_StructVector     *tb_x;
+   hypre_CommPkg          *tb_comm_pkg;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
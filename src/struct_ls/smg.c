@@ -32,6 +32,7 @@ hypre_SMGCreate( MPI_Comm  comm )
    (smg_data -> num_pre_relax)  = 1;
    (smg_data -> num_post_relax) = 1;
    (smg_data -> cdir) = 2;
+   (smg_data -> batch_lines) = 0;
    hypre_SetIndex3((smg_data -> base_index), 0, 0, 0);
    hypre_SetIndex3((smg_data -> base_stride), 1, 1, 1);
    (smg_data -> logging) = 0;
@@ -380,6 +381,31 @@ hypre_SMGGetPrintLevel( void *smg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGSetBatchLines( void *smg_vdata,
+                        HYPRE_Int   batch_lines )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   (smg_data -> batch_lines) = batch_lines;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SMGGetBatchLines( void *smg_vdata,
+                        HYPRE_Int * batch_lines )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   *batch_lines = (smg_data -> batch_lines);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -35,6 +35,7 @@ typedef struct
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
 
    HYPRE_Int             cdir;  /* coarsening direction */
+   HYPRE_Int             batch_lines;  /* batched line solves in relaxation */
 
    /* base index space info */
    hypre_Index           base_index;
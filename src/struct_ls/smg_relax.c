@@ -58,6 +58,7 @@ typedef struct
    HYPRE_Int               num_post_relax;
 
    HYPRE_Int               max_level;
+   HYPRE_Int               batch_lines;
 } hypre_SMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -100,6 +101,7 @@ hypre_SMGRelaxCreate( MPI_Comm  comm )
    (relax_data -> num_pre_relax)  = 1;
    (relax_data -> num_post_relax) = 1;
    (relax_data -> max_level)      = -1;
+   (relax_data -> batch_lines)    = 0;
    return (void *) relax_data;
 }
 
@@ -591,12 +593,14 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
          hypre_SMGSetTol(solve_data[i], 0.0);
          hypre_SMGSetMaxIter(solve_data[i], 1);
          hypre_StructSMGSetMaxLevel(solve_data[i], (relax_data -> max_level));
+         hypre_SMGSetBatchLines(solve_data[i], (relax_data -> batch_lines));
          hypre_SMGSetup(solve_data[i], A_sol, temp_vec, x);
       }
       else
       {
          solve_data[i] = hypre_CyclicReductionCreate(relax_data -> comm);
          hypre_CyclicReductionSetBase(solve_data[i], base_index, base_stride);
+         hypre_CyclicReductionSetBatchLines(solve_data[i], (relax_data -> batch_lines));
          //hypre_CyclicReductionSetMaxLevel(solve_data[i], -1);//(relax_data -> max_level)+10);
          hypre_CyclicReductionSetup(solve_data[i], A_sol, temp_vec, x);
       }
@@ -953,3 +957,17 @@ hypre_SMGRelaxSetMaxLevel( void *relax_vdata,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGRelaxSetBatchLines( void *relax_vdata,
+                             HYPRE_Int   batch_lines )
+{
+   hypre_SMGRelaxData *relax_data = (hypre_SMGRelaxData  *)relax_vdata;
+
+   (relax_data -> batch_lines) = batch_lines;
+
+   return hypre_error_flag;
+}
@@ -465,6 +465,7 @@ hypre_SMGSetup( void               *smg_vdata,
       relax_data_l[l] = hypre_SMGRelaxCreate(comm);
       hypre_SMGRelaxSetBase(relax_data_l[l], bindex, bstride);
       hypre_SMGRelaxSetMemoryUse(relax_data_l[l], (smg_data -> memory_use));
+      hypre_SMGRelaxSetBatchLines(relax_data_l[l], (smg_data -> batch_lines));
       hypre_SMGRelaxSetTol(relax_data_l[l], 0.0);
       hypre_SMGRelaxSetNumSpaces(relax_data_l[l], 2);
       hypre_SMGRelaxSetSpace(relax_data_l[l], 0,
@@ -528,6 +529,7 @@ hypre_SMGSetup( void               *smg_vdata,
    hypre_SMGRelaxSetBase(relax_data_l[l], bindex, bstride);
    hypre_SMGRelaxSetTol(relax_data_l[l], 0.0);
    hypre_SMGRelaxSetMaxIter(relax_data_l[l], 1);
+   hypre_SMGRelaxSetBatchLines(relax_data_l[l], (smg_data -> batch_lines));
    hypre_SMGRelaxSetTempVec(relax_data_l[l], tb_l[l]);
    hypre_SMGRelaxSetNumPreRelax( relax_data_l[l], n_pre);
    hypre_SMGRelaxSetNumPostRelax( relax_data_l[l], n_post);
@@ -333,6 +333,17 @@ HYPRE_StructMatrixSetNumGhost( HYPRE_StructMatrix  matrix,
    return ( hypre_StructMatrixSetNumGhost(matrix, num_ghost) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetCoeffGenerator( HYPRE_StructMatrix          matrix,
+                                     HYPRE_StructMatrixCoeffFcn  fcn,
+                                     void                       *data )
+{
+   return ( hypre_StructMatrixSetCoeffGenerator(matrix, fcn, data) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
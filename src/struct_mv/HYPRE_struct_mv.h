@@ -156,6 +156,20 @@ struct hypre_StructMatrix_struct;
  **/
 typedef struct hypre_StructMatrix_struct *HYPRE_StructMatrix;
 
+/**
+ * Coefficient generator for matrices whose coefficients are not stored (see
+ * \ref HYPRE_StructMatrixSetCoeffGenerator).  The function must fill \e values
+ * with the coefficients of the \e nentries stencil entries listed in \e entries
+ * for every index in the box [\e ilower, \e iupper], ordered exactly as in
+ * \ref HYPRE_StructMatrixSetBoxValues.
+ **/
+typedef HYPRE_Int (*HYPRE_StructMatrixCoeffFcn)(void          *data,
+                                                HYPRE_Int     *ilower,
+                                                HYPRE_Int     *iupper,
+                                                HYPRE_Int      nentries,
+                                                HYPRE_Int     *entries,
+                                                HYPRE_Complex *values);
+
 /**
  * Create a matrix object.
  **/
@@ -349,6 +363,26 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
 HYPRE_Int HYPRE_StructMatrixSetNumGhost(HYPRE_StructMatrix  matrix,
                                         HYPRE_Int          *num_ghost);
 
+/**
+ * (Optional) Evaluate the matrix coefficients on the fly with \e fcn instead
+ * of storing them.  This must be called before \ref HYPRE_StructMatrixInitialize,
+ * after which no coefficient data is allocated and the Set/AddTo/Get value
+ * routines may not be used.  Only variable-coefficient matrices are supported.
+ *
+ * The function may be called concurrently from several threads, and for boxes
+ * reaching into the ghost layer (transpose entries of symmetric matrices are
+ * evaluated at the neighboring index).  Couplings to points outside of the
+ * domain must evaluate to zero.
+ *
+ * Presently supported by \ref HYPRE_StructMatrixMatvec (host memory only) and
+ * by PFMG with Jacobi relaxation (relax types 0 and 1).  PFMG generates the
+ * coefficients a slab of the grid at a time to build the coarse grid
+ * operators, so the full matrix is never stored.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffGenerator(HYPRE_StructMatrix          matrix,
+                                              HYPRE_StructMatrixCoeffFcn  fcn,
+                                              void                       *data);
+
 
 /**
  * Print the matrix to file.  This is mainly for debugging purposes.
@@ -178,19 +178,29 @@ for (i = 0; i < hypre_BoxArraySize(box_array); i++)
 #define hypre_ForBoxArrayI(i, box_array_array) \
 for (i = 0; i < hypre_BoxArrayArraySize(box_array_array); i++)
 
-#define ZYPRE_BOX_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J,hypre__d,hypre__i
+#define ZYPRE_BOX_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J,hypre__d,hypre__i,hypre__m,hypre__o
 #define HYPRE_BOX_PRIVATE ZYPRE_BOX_PRIVATE
 
+/* Blocks are either ranges of rows (default) or tiles of the loop box (see
+ * HYPRE_SetStructBoxLoopTiling).  Within a block, hypre__i counts from zero
+ * up to the block extents hypre__m, and hypre__o is the block offset. */
 #define zypre_BoxLoopDeclare() \
-HYPRE_Int  hypre__tot, hypre__div, hypre__mod;\
-HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__tot, hypre__div = 0, hypre__mod = 0;\
+HYPRE_Int  hypre__block, hypre__num_blocks, hypre__tiled;\
 HYPRE_Int  hypre__d, hypre__ndim;\
 HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
-HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1]
+HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__m[HYPRE_MAXDIM+1] = {0}, hypre__o[HYPRE_MAXDIM] = {0};\
+HYPRE_Int  hypre__bs[HYPRE_MAXDIM], hypre__nt[HYPRE_MAXDIM]
 
 #define zypre_BoxLoopDeclareK(k) \
 HYPRE_Int  hypre__ikstart##k, hypre__i0inc##k;\
-HYPRE_Int  hypre__sk##k[HYPRE_MAXDIM], hypre__ikinc##k[HYPRE_MAXDIM+1]
+HYPRE_Int  hypre__sk##k[HYPRE_MAXDIM]
+
+/* Declare this inside the block loop, since the increments depend on the
+ * extents of the block */
+#define zypre_BoxLoopDeclareIncK(k) \
+HYPRE_Int  hypre__ikinc##k[HYPRE_MAXDIM+1]
 
 #define zypre_BoxLoopInit(ndim, loop_size) \
 hypre__ndim = ndim;\
@@ -202,38 +212,63 @@ for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
    hypre__tot *= hypre__n[hypre__d];\
 }\
 hypre__n[hypre__ndim] = 2;\
-hypre__num_blocks = hypre_NumThreads();\
-if (hypre__tot < hypre__num_blocks)\
+hypre__tiled = hypre_BoxLoopTilesInit(hypre__ndim, hypre__n, hypre__bs, hypre__nt);\
+if (hypre__tiled)\
 {\
-   hypre__num_blocks = hypre__tot;\
+   hypre__num_blocks = hypre__tiled;\
 }\
-if (hypre__num_blocks > 0)\
+else\
 {\
-   hypre__div = hypre__tot / hypre__num_blocks;\
-   hypre__mod = hypre__tot % hypre__num_blocks;\
+   hypre__num_blocks = hypre_NumThreads();\
+   if (hypre__tot < hypre__num_blocks)\
+   {\
+      hypre__num_blocks = hypre__tot;\
+   }\
+   if (hypre__num_blocks > 0)\
+   {\
+      hypre__div = hypre__tot / hypre__num_blocks;\
+      hypre__mod = hypre__tot % hypre__num_blocks;\
+   }\
 }
 
 #define zypre_BoxLoopInitK(k, dboxk, startk, stridek, ik) \
 hypre__sk##k[0] = stridek[0];\
-hypre__ikinc##k[0] = 0;\
 ik = hypre_BoxSizeD(dboxk, 0); /* temporarily use ik */\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
    hypre__sk##k[hypre__d] = ik*stridek[hypre__d];\
-   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
-      hypre__sk##k[hypre__d] - hypre__n[hypre__d-1]*hypre__sk##k[hypre__d-1];\
    ik *= hypre_BoxSizeD(dboxk, hypre__d);\
 }\
 hypre__i0inc##k = hypre__sk##k[0];\
-hypre__ikinc##k[hypre__ndim] = 0;\
 hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
 
 #define zypre_BoxLoopSet() \
-hypre__IN = hypre__n[0];\
-if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
+if (hypre__tiled)\
+{\
+   /* tiles are numbered with the first dimension varying fastest */\
+   hypre__J = hypre__block;\
+   hypre__JN = 1;\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__o[hypre__d] = (hypre__J % hypre__nt[hypre__d]) * hypre__bs[hypre__d];\
+      hypre__m[hypre__d] = hypre_min(hypre__bs[hypre__d], hypre__n[hypre__d] - hypre__o[hypre__d]);\
+      hypre__i[hypre__d] = 0;\
+      hypre__J /= hypre__nt[hypre__d];\
+   }\
+   for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__JN *= hypre__m[hypre__d];\
+   }\
+}\
+else if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
 {\
    hypre__JN = hypre__div + ((hypre__mod > hypre__block) ? 1 : 0);\
    hypre__J = hypre__block * hypre__div + hypre_min(hypre__mod, hypre__block);\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__m[hypre__d] = hypre__n[hypre__d];\
+      hypre__o[hypre__d] = 0;\
+   }\
    for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
    {\
       hypre__i[hypre__d] = hypre__J % hypre__n[hypre__d];\
@@ -243,23 +278,31 @@ if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
 else\
 {\
    hypre__JN = hypre__tot;\
-   for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
    {\
+      hypre__m[hypre__d] = hypre__n[hypre__d];\
+      hypre__o[hypre__d] = 0;\
       hypre__i[hypre__d] = 0;\
    }\
 }\
+hypre__IN = hypre__m[0];\
+hypre__m[hypre__ndim] = 2;\
 hypre__i[hypre__ndim] = 0
 
 #define zypre_BoxLoopSetK(k, ik) \
-ik = hypre__ikstart##k;\
+ik = hypre__ikstart##k + hypre__o[0]*hypre__sk##k[0];\
+hypre__ikinc##k[0] = 0;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
-   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
-}
+   ik += (hypre__o[hypre__d] + hypre__i[hypre__d])*hypre__sk##k[hypre__d];\
+   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
+      hypre__sk##k[hypre__d] - hypre__m[hypre__d-1]*hypre__sk##k[hypre__d-1];\
+}\
+hypre__ikinc##k[hypre__ndim] = 0
 
 #define zypre_BoxLoopInc1() \
 hypre__d = 1;\
-while ((hypre__i[hypre__d]+2) > hypre__n[hypre__d])\
+while ((hypre__i[hypre__d]+2) > hypre__m[hypre__d])\
 {\
    hypre__d++;\
 }
@@ -276,29 +319,27 @@ while (hypre__d > 1)\
  * where the numbering starts at 0.  It works even when threading is turned on,
  * as long as 'index' is declared to be private. */
 #define zypre_BoxLoopGetIndex(index) \
-index[0] = hypre__I;\
+index[0] = hypre__o[0] + hypre__I;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
-   index[hypre__d] = hypre__i[hypre__d];\
+   index[hypre__d] = hypre__o[hypre__d] + hypre__i[hypre__d];\
 }
 
 /* Use this before the For macros below to force only one block */
-#define zypre_BoxLoopSetOneBlock() hypre__num_blocks = 1
+#define zypre_BoxLoopSetOneBlock() \
+hypre__num_blocks = 1;\
+hypre__tiled = 0
 
 /* Use this to get the block iteration inside a BoxLoop */
 #define zypre_BoxLoopBlock() hypre__block
 
 #define zypre_BasicBoxLoopInitK(k, stridek) \
 hypre__sk##k[0] = stridek[0];\
-hypre__ikinc##k[0] = 0;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
    hypre__sk##k[hypre__d] = stridek[hypre__d];\
-   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
-      hypre__sk##k[hypre__d] - hypre__n[hypre__d-1]*hypre__sk##k[hypre__d-1];\
 }\
 hypre__i0inc##k = hypre__sk##k[0];\
-hypre__ikinc##k[hypre__ndim] = 0;\
 hypre__ikstart##k = 0
 
 /*--------------------------------------------------------------------------
@@ -917,6 +958,17 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   /* persistent requests and host buffers, set up after the first comm. */
+   HYPRE_Int            persistent_tag;
+   /* are the persistent requests started and not yet completed? */
+   HYPRE_Int            persistent_active;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
+#endif
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -942,6 +994,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1035,6 +1090,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)      (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)      (comm_pkg -> persistent_recv_buffers)
+#endif
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1050,6 +1114,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1181,6 +1246,10 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn coeff_fcn;            /* Coefficient generator; when set,
+                                                       no coefficient data is stored */
+   void                 *coeff_fcn_data;            /* User data for coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -1209,6 +1278,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffFcnData(matrix)        ((matrix) -> coeff_fcn_data)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
@@ -1406,6 +1477,7 @@ HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *bo
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
+HYPRE_Int hypre_BoxLoopTilesInit ( HYPRE_Int ndim, HYPRE_Int *n, HYPRE_Int *bs, HYPRE_Int *nt );
 
 /* box_manager.c */
 HYPRE_Int hypre_BoxManEntryGetInfo ( hypre_BoxManEntry *entry, void **info_ptr );
@@ -1527,6 +1599,8 @@ HYPRE_Int HYPRE_StructMatrixAddToConstantValues ( HYPRE_StructMatrix matrix,
                                                   HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixAssemble ( HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixSetNumGhost ( HYPRE_StructMatrix matrix, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_StructMatrixSetCoeffGenerator ( HYPRE_StructMatrix matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
 HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix, HYPRE_StructGrid *grid );
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix, HYPRE_Int nentries,
@@ -1597,6 +1671,8 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgPersistentDestroy ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommPkgPersistentSetup ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -1634,6 +1710,7 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_io.c */
@@ -1676,6 +1753,11 @@ HYPRE_Int hypre_StructMatrixClearBoxValues ( hypre_StructMatrix *matrix, hypre_B
                                              HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixAssemble ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixSetNumGhost ( hypre_StructMatrix *matrix, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixSetCoeffGenerator ( hypre_StructMatrix *matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
+HYPRE_Int hypre_StructMatrixGenerateValues ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                             HYPRE_Int entry, HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixMaterializeBox ( hypre_StructMatrix *matrix, hypre_Box *box );
 HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
@@ -1707,6 +1789,16 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFusedStencil ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecCC0Fused ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                       hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC1Fused ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                       hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecGen ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                  hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                  hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -1730,6 +1822,8 @@ hypre_StructVector *hypre_StructVectorRef ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorDestroy ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorInitializeShell ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorInitializeData ( hypre_StructVector *vector, HYPRE_Complex *data);
+HYPRE_Complex *hypre_StructDataAlloc ( hypre_BoxArray *data_space, HYPRE_Int data_size,
+                                      HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_StructVectorInitialize ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorSetValues ( hypre_StructVector *vector, hypre_Index grid_index,
                                         HYPRE_Complex *values, HYPRE_Int action, HYPRE_Int boxnum, HYPRE_Int outside );
@@ -2398,6 +2492,7 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       HYPRE_Int i1;                                                           \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2431,6 +2526,8 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       HYPRE_Int i1, i2;                                                       \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2470,6 +2567,9 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
+      zypre_BoxLoopDeclareIncK(3);                                            \
       HYPRE_Int i1, i2, i3;                                                   \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2514,6 +2614,10 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
+      zypre_BoxLoopDeclareIncK(3);                                            \
+      zypre_BoxLoopDeclareIncK(4);                                            \
       HYPRE_Int i1, i2, i3, i4;                                               \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2551,6 +2655,7 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       HYPRE_Int i1;                                                           \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2572,6 +2677,8 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       HYPRE_Int i1, i2;                                                       \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -2630,6 +2737,7 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    zypre_BoxLoopSetOneBlock();                                                \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
@@ -2653,6 +2761,8 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
    zypre_BoxLoopSetOneBlock();                                                \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
       zypre_BoxLoopSetK(2, i2);                                               \
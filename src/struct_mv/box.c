@@ -988,3 +988,44 @@ hypre_BoxArrayArrayDuplicate( hypre_BoxArrayArray *box_array_array )
 
    return new_box_array_array;
 }
+
+/*--------------------------------------------------------------------------
+ * Set up the tiles of a host BoxLoop with extents n[0..ndim-1], using the
+ * tile sizes set with HYPRE_SetStructBoxLoopTiling.  Returns the number of
+ * tiles, or 0 if the loop should be split into ranges of rows instead (no
+ * tiling requested, or fewer tiles than threads).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxLoopTilesInit( HYPRE_Int  ndim,
+                        HYPRE_Int *n,
+                        HYPRE_Int *bs,
+                        HYPRE_Int *nt )
+{
+   HYPRE_Int  *tile = hypre_HandleStructBoxLoopTile(hypre_handle());
+   HYPRE_Int   num_tiles, d;
+
+   if (!hypre_HandleStructBoxLoopTiled(hypre_handle()))
+   {
+      return 0;
+   }
+
+   num_tiles = 1;
+   for (d = 0; d < ndim; d++)
+   {
+      if (n[d] <= 0)
+      {
+         return 0;
+      }
+      bs[d] = (tile[d] > 0) ? hypre_min(tile[d], n[d]) : n[d];
+      nt[d] = (n[d] + bs[d] - 1) / bs[d];
+      num_tiles *= nt[d];
+   }
+
+   if (num_tiles < 2 || num_tiles < hypre_NumThreads())
+   {
+      return 0;
+   }
+
+   return num_tiles;
+}
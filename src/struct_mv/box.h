@@ -161,19 +161,29 @@ for (i = 0; i < hypre_BoxArraySize(box_array); i++)
 #define hypre_ForBoxArrayI(i, box_array_array) \
 for (i = 0; i < hypre_BoxArrayArraySize(box_array_array); i++)
 
-#define ZYPRE_BOX_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J,hypre__d,hypre__i
+#define ZYPRE_BOX_PRIVATE hypre__IN,hypre__JN,hypre__I,hypre__J,hypre__d,hypre__i,hypre__m,hypre__o
 #define HYPRE_BOX_PRIVATE ZYPRE_BOX_PRIVATE
 
+/* Blocks are either ranges of rows (default) or tiles of the loop box (see
+ * HYPRE_SetStructBoxLoopTiling).  Within a block, hypre__i counts from zero
+ * up to the block extents hypre__m, and hypre__o is the block offset. */
 #define zypre_BoxLoopDeclare() \
-HYPRE_Int  hypre__tot, hypre__div, hypre__mod;\
-HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__tot, hypre__div = 0, hypre__mod = 0;\
+HYPRE_Int  hypre__block, hypre__num_blocks, hypre__tiled;\
 HYPRE_Int  hypre__d, hypre__ndim;\
 HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
-HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1]
+HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__m[HYPRE_MAXDIM+1] = {0}, hypre__o[HYPRE_MAXDIM] = {0};\
+HYPRE_Int  hypre__bs[HYPRE_MAXDIM], hypre__nt[HYPRE_MAXDIM]
 
 #define zypre_BoxLoopDeclareK(k) \
 HYPRE_Int  hypre__ikstart##k, hypre__i0inc##k;\
-HYPRE_Int  hypre__sk##k[HYPRE_MAXDIM], hypre__ikinc##k[HYPRE_MAXDIM+1]
+HYPRE_Int  hypre__sk##k[HYPRE_MAXDIM]
+
+/* Declare this inside the block loop, since the increments depend on the
+ * extents of the block */
+#define zypre_BoxLoopDeclareIncK(k) \
+HYPRE_Int  hypre__ikinc##k[HYPRE_MAXDIM+1]
 
 #define zypre_BoxLoopInit(ndim, loop_size) \
 hypre__ndim = ndim;\
@@ -185,38 +195,63 @@ for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
    hypre__tot *= hypre__n[hypre__d];\
 }\
 hypre__n[hypre__ndim] = 2;\
-hypre__num_blocks = hypre_NumThreads();\
-if (hypre__tot < hypre__num_blocks)\
+hypre__tiled = hypre_BoxLoopTilesInit(hypre__ndim, hypre__n, hypre__bs, hypre__nt);\
+if (hypre__tiled)\
 {\
-   hypre__num_blocks = hypre__tot;\
+   hypre__num_blocks = hypre__tiled;\
 }\
-if (hypre__num_blocks > 0)\
+else\
 {\
-   hypre__div = hypre__tot / hypre__num_blocks;\
-   hypre__mod = hypre__tot % hypre__num_blocks;\
+   hypre__num_blocks = hypre_NumThreads();\
+   if (hypre__tot < hypre__num_blocks)\
+   {\
+      hypre__num_blocks = hypre__tot;\
+   }\
+   if (hypre__num_blocks > 0)\
+   {\
+      hypre__div = hypre__tot / hypre__num_blocks;\
+      hypre__mod = hypre__tot % hypre__num_blocks;\
+   }\
 }
 
 #define zypre_BoxLoopInitK(k, dboxk, startk, stridek, ik) \
 hypre__sk##k[0] = stridek[0];\
-hypre__ikinc##k[0] = 0;\
 ik = hypre_BoxSizeD(dboxk, 0); /* temporarily use ik */\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
    hypre__sk##k[hypre__d] = ik*stridek[hypre__d];\
-   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
-      hypre__sk##k[hypre__d] - hypre__n[hypre__d-1]*hypre__sk##k[hypre__d-1];\
    ik *= hypre_BoxSizeD(dboxk, hypre__d);\
 }\
 hypre__i0inc##k = hypre__sk##k[0];\
-hypre__ikinc##k[hypre__ndim] = 0;\
 hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk)
 
 #define zypre_BoxLoopSet() \
-hypre__IN = hypre__n[0];\
-if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
+if (hypre__tiled)\
+{\
+   /* tiles are numbered with the first dimension varying fastest */\
+   hypre__J = hypre__block;\
+   hypre__JN = 1;\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__o[hypre__d] = (hypre__J % hypre__nt[hypre__d]) * hypre__bs[hypre__d];\
+      hypre__m[hypre__d] = hypre_min(hypre__bs[hypre__d], hypre__n[hypre__d] - hypre__o[hypre__d]);\
+      hypre__i[hypre__d] = 0;\
+      hypre__J /= hypre__nt[hypre__d];\
+   }\
+   for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__JN *= hypre__m[hypre__d];\
+   }\
+}\
+else if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
 {\
    hypre__JN = hypre__div + ((hypre__mod > hypre__block) ? 1 : 0);\
    hypre__J = hypre__block * hypre__div + hypre_min(hypre__mod, hypre__block);\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__m[hypre__d] = hypre__n[hypre__d];\
+      hypre__o[hypre__d] = 0;\
+   }\
    for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
    {\
       hypre__i[hypre__d] = hypre__J % hypre__n[hypre__d];\
@@ -226,23 +261,31 @@ if (hypre__num_blocks > 1)/* in case user sets num_blocks to 1 */\
 else\
 {\
    hypre__JN = hypre__tot;\
-   for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
    {\
+      hypre__m[hypre__d] = hypre__n[hypre__d];\
+      hypre__o[hypre__d] = 0;\
       hypre__i[hypre__d] = 0;\
    }\
 }\
+hypre__IN = hypre__m[0];\
+hypre__m[hypre__ndim] = 2;\
 hypre__i[hypre__ndim] = 0
 
 #define zypre_BoxLoopSetK(k, ik) \
-ik = hypre__ikstart##k;\
+ik = hypre__ikstart##k + hypre__o[0]*hypre__sk##k[0];\
+hypre__ikinc##k[0] = 0;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
-   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
-}
+   ik += (hypre__o[hypre__d] + hypre__i[hypre__d])*hypre__sk##k[hypre__d];\
+   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
+      hypre__sk##k[hypre__d] - hypre__m[hypre__d-1]*hypre__sk##k[hypre__d-1];\
+}\
+hypre__ikinc##k[hypre__ndim] = 0
 
 #define zypre_BoxLoopInc1() \
 hypre__d = 1;\
-while ((hypre__i[hypre__d]+2) > hypre__n[hypre__d])\
+while ((hypre__i[hypre__d]+2) > hypre__m[hypre__d])\
 {\
    hypre__d++;\
 }
@@ -259,29 +302,27 @@ while (hypre__d > 1)\
  * where the numbering starts at 0.  It works even when threading is turned on,
  * as long as 'index' is declared to be private. */
 #define zypre_BoxLoopGetIndex(index) \
-index[0] = hypre__I;\
+index[0] = hypre__o[0] + hypre__I;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
-   index[hypre__d] = hypre__i[hypre__d];\
+   index[hypre__d] = hypre__o[hypre__d] + hypre__i[hypre__d];\
 }
 
 /* Use this before the For macros below to force only one block */
-#define zypre_BoxLoopSetOneBlock() hypre__num_blocks = 1
+#define zypre_BoxLoopSetOneBlock() \
+hypre__num_blocks = 1;\
+hypre__tiled = 0
 
 /* Use this to get the block iteration inside a BoxLoop */
 #define zypre_BoxLoopBlock() hypre__block
 
 #define zypre_BasicBoxLoopInitK(k, stridek) \
 hypre__sk##k[0] = stridek[0];\
-hypre__ikinc##k[0] = 0;\
 for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
 {\
    hypre__sk##k[hypre__d] = stridek[hypre__d];\
-   hypre__ikinc##k[hypre__d] = hypre__ikinc##k[hypre__d-1] +\
-      hypre__sk##k[hypre__d] - hypre__n[hypre__d-1]*hypre__sk##k[hypre__d-1];\
 }\
 hypre__i0inc##k = hypre__sk##k[0];\
-hypre__ikinc##k[hypre__ndim] = 0;\
 hypre__ikstart##k = 0
 
 /*--------------------------------------------------------------------------
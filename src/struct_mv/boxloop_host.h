@@ -65,6 +65,7 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       HYPRE_Int i1;                                                           \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -98,6 +99,8 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       HYPRE_Int i1, i2;                                                       \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -137,6 +140,9 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
+      zypre_BoxLoopDeclareIncK(3);                                            \
       HYPRE_Int i1, i2, i3;                                                   \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -181,6 +187,10 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
+      zypre_BoxLoopDeclareIncK(3);                                            \
+      zypre_BoxLoopDeclareIncK(4);                                            \
       HYPRE_Int i1, i2, i3, i4;                                               \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -218,6 +228,7 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       HYPRE_Int i1;                                                           \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -239,6 +250,8 @@
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       HYPRE_Int i1, i2;                                                       \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
@@ -297,6 +310,7 @@
    zypre_BoxLoopSetOneBlock();                                                \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
@@ -320,6 +334,8 @@
    zypre_BoxLoopSetOneBlock();                                                \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
+      zypre_BoxLoopDeclareIncK(1);                                            \
+      zypre_BoxLoopDeclareIncK(2);                                            \
       zypre_BoxLoopSet();                                                     \
       zypre_BoxLoopSetK(1, i1);                                               \
       zypre_BoxLoopSetK(2, i2);                                               \
@@ -93,9 +93,11 @@ hypre_ComputeInfoDestroy( hypre_ComputeInfo  *compute_info )
 
 /*--------------------------------------------------------------------------
  * Return descriptions of communications and computations patterns for
- * a given grid-stencil computation.  If HYPRE\_OVERLAP\_COMM\_COMP is
- * defined, then the patterns are computed to allow for overlapping
- * communications and computations.  The default is no overlap.
+ * a given grid-stencil computation.  If overlapping is turned on (see
+ * HYPRE_SetStructOverlapCommComp) and some data has to come from other
+ * processes, then each box is split into an independent interior and a
+ * dependent boundary shell, so that the interior can be computed while the
+ * ghost exchange is in flight.  Otherwise, all of each box is dependent.
  *
  * Note: This routine assumes that the grid boxes do not overlap.
  *--------------------------------------------------------------------------*/
@@ -117,13 +119,15 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    HYPRE_Int                i;
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
    hypre_Box               *rembox;
    hypre_Index             *stencil_shape;
    hypre_Index              lborder, rborder;
    HYPRE_Int                cbox_array_size;
    HYPRE_Int                s, d;
-#endif
+   HYPRE_Int                overlap, myid, j;
+   HYPRE_Int               *split;
+   hypre_BoxArrayArray     *recv_boxes;
+   HYPRE_Int              **recv_processes;
 
    /*------------------------------------------------------
     * Extract needed grid info
@@ -137,122 +141,178 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
-
    /*------------------------------------------------------
-    * Compute border info
+    * Only overlap if some data comes from other processes
     *------------------------------------------------------*/
 
-   hypre_SetIndex(lborder, 0);
-   hypre_SetIndex(rborder, 0);
-   stencil_shape = hypre_StructStencilShape(stencil);
-   for (s = 0; s < hypre_StructStencilSize(stencil); s++)
+   overlap = 0;
+   if (hypre_HandleStructOverlapCommComp(hypre_handle()))
    {
-      for (d = 0; d < ndim; d++)
+      hypre_MPI_Comm_rank(hypre_StructGridComm(grid), &myid);
+      recv_boxes     = hypre_CommInfoRecvBoxes(comm_info);
+      recv_processes = hypre_CommInfoRecvProcesses(comm_info);
+      hypre_ForBoxArrayI(i, recv_boxes)
       {
-         i = hypre_IndexD(stencil_shape[s], d);
-         if (i < 0)
+         cbox_array = hypre_BoxArrayArrayBoxArray(recv_boxes, i);
+         hypre_ForBoxI(j, cbox_array)
          {
-            lborder[d] = hypre_max(lborder[d], -i);
+            if (recv_processes[i][j] != myid)
+            {
+               overlap = 1;
+            }
          }
-         else if (i > 0)
+      }
+   }
+
+   if (overlap)
+   {
+      /*------------------------------------------------------
+       * Compute border info
+       *------------------------------------------------------*/
+
+      hypre_SetIndex(lborder, 0);
+      hypre_SetIndex(rborder, 0);
+      stencil_shape = hypre_StructStencilShape(stencil);
+      for (s = 0; s < hypre_StructStencilSize(stencil); s++)
+      {
+         for (d = 0; d < ndim; d++)
          {
-            rborder[d] = hypre_max(rborder[d], i);
+            i = hypre_IndexD(stencil_shape[s], d);
+            if (i < 0)
+            {
+               lborder[d] = hypre_max(lborder[d], -i);
+            }
+            else if (i > 0)
+            {
+               rborder[d] = hypre_max(rborder[d], i);
+            }
          }
       }
-   }
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Only split boxes whose interior is at least as large as
+       * the boundary shell (the extra loops are not worth it on
+       * small boxes, e.g., on coarse multigrid levels)
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      split = hypre_CTAlloc(HYPRE_Int, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+      rembox = hypre_BoxCreate(ndim);
+      hypre_ForBoxI(i, boxes)
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(rembox, d) += lborder[d];
+            hypre_BoxIMaxD(rembox, d) -= rborder[d];
+         }
+         split[i] = (2 * hypre_BoxVolume(rembox) >=
+                     hypre_BoxVolume(hypre_BoxArrayBox(boxes, i)));
+      }
+      hypre_BoxDestroy(rembox);
 
-   rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
+
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
-      cbox_array_size = 0;
-      for (d = 0; d < ndim; d++)
+      rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
+      hypre_ForBoxI(i, boxes)
       {
-         if ( (hypre_BoxVolume(rembox)) && lborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         if (!split[i])
          {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMaxD(cbox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
-            hypre_BoxIMinD(rembox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d];
-            cbox_array_size++;
+            hypre_BoxArraySetSize(cbox_array, 1);
+            hypre_CopyBox(hypre_BoxArrayBox(boxes, i),
+                          hypre_BoxArrayBox(cbox_array, 0));
+            continue;
          }
-         if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+         hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         cbox_array_size = 0;
+         for (d = 0; d < ndim; d++)
          {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMinD(cbox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
-            hypre_BoxIMaxD(rembox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d];
-            cbox_array_size++;
+            if ( (hypre_BoxVolume(rembox)) && lborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMaxD(cbox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
+               hypre_BoxIMinD(rembox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d];
+               cbox_array_size++;
+            }
+            if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMinD(cbox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
+               hypre_BoxIMaxD(rembox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d];
+               cbox_array_size++;
+            }
          }
+         hypre_BoxArraySetSize(cbox_array, cbox_array_size);
       }
-      hypre_BoxArraySetSize(cbox_array, cbox_array_size);
-   }
-   hypre_BoxDestroy(rembox);
+      hypre_BoxDestroy(rembox);
 
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
-
-      for (d = 0; d < ndim; d++)
+      hypre_ForBoxI(i, boxes)
       {
-         if ( lborder[d] )
+         if (!split[i])
          {
-            hypre_BoxIMinD(cbox, d) += lborder[d];
+            continue;
          }
-         if ( rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+
+         for (d = 0; d < ndim; d++)
          {
-            hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            if ( lborder[d] )
+            {
+               hypre_BoxIMinD(cbox, d) += lborder[d];
+            }
+            if ( rborder[d] )
+            {
+               hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            }
          }
       }
-   }
-
-#else
 
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
+      hypre_TFree(split, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      hypre_ForBoxI(i, boxes)
+      {
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      }
    }
 
-#endif
-
    /*------------------------------------------------------
     * Return
     *------------------------------------------------------*/
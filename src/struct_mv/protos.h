@@ -97,6 +97,7 @@ HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *bo
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
+HYPRE_Int hypre_BoxLoopTilesInit ( HYPRE_Int ndim, HYPRE_Int *n, HYPRE_Int *bs, HYPRE_Int *nt );
 
 /* box_manager.c */
 HYPRE_Int hypre_BoxManEntryGetInfo ( hypre_BoxManEntry *entry, void **info_ptr );
@@ -218,6 +219,8 @@ HYPRE_Int HYPRE_StructMatrixAddToConstantValues ( HYPRE_StructMatrix matrix,
                                                   HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixAssemble ( HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixSetNumGhost ( HYPRE_StructMatrix matrix, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_StructMatrixSetCoeffGenerator ( HYPRE_StructMatrix matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
 HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix, HYPRE_StructGrid *grid );
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix, HYPRE_Int nentries,
@@ -288,6 +291,8 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgPersistentDestroy ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommPkgPersistentSetup ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -325,6 +330,7 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_io.c */
@@ -367,6 +373,11 @@ HYPRE_Int hypre_StructMatrixClearBoxValues ( hypre_StructMatrix *matrix, hypre_B
                                              HYPRE_Int num_stencil_indices, HYPRE_Int *stencil_indices, HYPRE_Int boxnum, HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixAssemble ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixSetNumGhost ( hypre_StructMatrix *matrix, HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixSetCoeffGenerator ( hypre_StructMatrix *matrix,
+                                                HYPRE_StructMatrixCoeffFcn fcn, void *data );
+HYPRE_Int hypre_StructMatrixGenerateValues ( hypre_StructMatrix *matrix, hypre_Box *box,
+                                             HYPRE_Int entry, HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixMaterializeBox ( hypre_StructMatrix *matrix, hypre_Box *box );
 HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
@@ -398,6 +409,16 @@ HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hy
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFusedStencil ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecCC0Fused ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                       hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC1Fused ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                       hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                       hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecGen ( HYPRE_Complex alpha, HYPRE_Complex temp, hypre_StructMatrix *A,
+                                  hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                  hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -421,6 +442,8 @@ hypre_StructVector *hypre_StructVectorRef ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorDestroy ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorInitializeShell ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorInitializeData ( hypre_StructVector *vector, HYPRE_Complex *data);
+HYPRE_Complex *hypre_StructDataAlloc ( hypre_BoxArray *data_space, HYPRE_Int data_size,
+                                      HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_StructVectorInitialize ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorSetValues ( hypre_StructVector *vector, hypre_Index grid_index,
                                         HYPRE_Complex *values, HYPRE_Int action, HYPRE_Int boxnum, HYPRE_Int outside );
@@ -803,11 +803,139 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
    return hypre_error_flag;
 }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+
+/*--------------------------------------------------------------------------
+ * Free the persistent requests and buffers of a communication package.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgPersistentDestroy( hypre_CommPkg *comm_pkg )
+{
+   hypre_MPI_Request *requests = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Int          num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int          num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int          i;
+
+   if (requests)
+   {
+      for (i = 0; i < num_sends + num_recvs; i++)
+      {
+         hypre_MPI_Request_free(&requests[i]);
+      }
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+      }
+      if (num_recvs > 0)
+      {
+         hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRequests(comm_pkg) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up persistent send/recv requests on buffers owned by the
+ * communication package.  This is only done after the first
+ * communication, when the buffer sizes no longer include the prefix
+ * information.  The requests are rebuilt if the tag changes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgPersistentSetup( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   if (hypre_CommPkgPersistentRequests(comm_pkg))
+   {
+      if (hypre_CommPkgPersistentTag(comm_pkg) == tag)
+      {
+         return hypre_error_flag;
+      }
+      hypre_CommPkgPersistentDestroy(comm_pkg);
+   }
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+   if (num_sends > 0)
+   {
+      send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+         send_buffers[i] = send_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   if (num_recvs > 0)
+   {
+      recv_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+         recv_buffers[i] = recv_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   /* same request order as the non-persistent path: receives first */
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+
+   hypre_CommPkgPersistentTag(comm_pkg)         = tag;
+   hypre_CommPkgPersistentRequests(comm_pkg)    = requests;
+   hypre_CommPkgPersistentStatus(comm_pkg)      =
+      hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+   hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+
+   return hypre_error_flag;
+}
+
+#endif
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
  * The communication buffers are created, the send buffer is manually
- * packed, and the communication requests are posted.
+ * packed, and the communication requests are posted.  With persistent
+ * communication, exchanges after the first one on host memory reuse the
+ * buffers and requests stored in comm_pkg and are started with a single
+ * MPI_Startall.
  *
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
@@ -852,25 +980,48 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent = 0;
 
    HYPRE_MemoryLocation memory_location     = hypre_HandleMemoryLocation(hypre_handle());
    HYPRE_MemoryLocation memory_location_mpi = memory_location;
 
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
-
    num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-   status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   /* a comm_pkg can only have one persistent exchange in flight */
+   if ( num_requests > 0 &&
+        !hypre_CommPkgFirstComm(comm_pkg) &&
+        !hypre_CommPkgPersistentActive(comm_pkg) &&
+        hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST )
+   {
+      persistent = 1;
+   }
+#endif
 
    /*--------------------------------------------------------------------
-    * allocate buffers
+    * allocate requests, status and buffers
     *--------------------------------------------------------------------*/
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   if (persistent)
+   {
+      hypre_CommPkgPersistentSetup(comm_pkg, tag);
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   }
+   else
+#endif
+   {
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   }
+
    /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+   if (!persistent && num_sends > 0)
    {
       size = hypre_CommPkgSendBufsize(comm_pkg);
       send_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
@@ -883,8 +1034,7 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    }
 
    /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
+   if (!persistent && num_recvs > 0)
    {
       size = hypre_CommPkgRecvBufsize(comm_pkg);
       recv_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
@@ -1026,34 +1176,44 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for (i = 0; i < num_recvs; i++)
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      hypre_MPI_Startall(num_requests, requests);
+      hypre_CommPkgPersistentActive(comm_pkg) = 1;
+   }
+   else
+#endif
+   {
+      j = 0;
+      for (i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_MPI_Irecv(recv_buffers_mpi[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
       }
-   }
 
-   for (i = 0; i < num_sends; i++)
-   {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      for (i = 0; i < num_sends; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_MPI_Isend(send_buffers_mpi[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
       }
    }
 
@@ -1101,6 +1261,7 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    hypre_CommHandleAction(comm_handle)         = action;
    hypre_CommHandleSendBuffersMPI(comm_handle) = send_buffers_mpi;
    hypre_CommHandleRecvBuffersMPI(comm_handle) = recv_buffers_mpi;
+   hypre_CommHandlePersistent(comm_handle)     = persistent;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1296,6 +1457,17 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      /* requests and buffers are kept in comm_pkg for the next exchange */
+      hypre_CommPkgPersistentActive(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+#endif
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1423,6 +1595,10 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+      hypre_CommPkgPersistentDestroy(comm_pkg);
+#endif
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
@@ -123,6 +123,17 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   /* persistent requests and host buffers, set up after the first comm. */
+   HYPRE_Int            persistent_tag;
+   /* are the persistent requests started and not yet completed? */
+   HYPRE_Int            persistent_active;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
+#endif
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -148,6 +159,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* requests and buffers are owned by comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -241,6 +255,15 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)      (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)      (comm_pkg -> persistent_recv_buffers)
+#endif
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -256,5 +279,6 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
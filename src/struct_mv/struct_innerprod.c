@@ -15,16 +15,16 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the contribution of the local boxes to <x,y>, without the global
+ * reduction. Used to batch several inner products into a single reduction.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -96,7 +96,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
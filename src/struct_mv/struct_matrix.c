@@ -534,8 +534,25 @@ hypre_StructMatrixInitialize( hypre_StructMatrix *matrix )
 
    hypre_StructMatrixInitializeShell(matrix);
 
-   data = hypre_CTAlloc(HYPRE_Complex, hypre_StructMatrixDataSize(matrix),
-                        hypre_StructMatrixMemoryLocation(matrix));
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* coefficients are generated on the fly, nothing is stored */
+      if (hypre_StructMatrixConstantCoefficient(matrix) != 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Coefficient generator requires variable coefficients");
+         return hypre_error_flag;
+      }
+      hypre_StructMatrixDataSize(matrix)      = 0;
+      hypre_StructMatrixDataConstSize(matrix) = 0;
+      hypre_StructMatrixInitializeData(matrix, NULL, NULL);
+
+      return hypre_error_flag;
+   }
+
+   data = hypre_StructDataAlloc(hypre_StructMatrixDataSpace(matrix),
+                                hypre_StructMatrixDataSize(matrix),
+                                hypre_StructMatrixMemoryLocation(matrix));
    data_const = hypre_CTAlloc(HYPRE_Complex, hypre_StructMatrixDataConstSize(matrix),
                               HYPRE_MEMORY_HOST);
 
@@ -578,6 +595,13 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
    HYPRE_MemoryLocation memory_location = hypre_StructMatrixMemoryLocation(matrix);
 #endif
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* no coefficient data is stored */
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -732,6 +756,13 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* no coefficient data is stored */
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -922,6 +953,13 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* no coefficient data is stored */
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1081,6 +1119,13 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int            i, s, istart, istop;
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* no coefficient data is stored */
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Initialize some things
     *-----------------------------------------------------------------------*/
@@ -1274,6 +1319,12 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
    HYPRE_Int              num_entries;
    /* End - variables for ghost layer identity code below */
 
+   if (hypre_StructMatrixCoeffFcn(matrix))
+   {
+      /* no coefficient data to update */
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
    /*-----------------------------------------------------------------------
@@ -1458,6 +1509,180 @@ hypre_StructMatrixSetNumGhost( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffGenerator
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffGenerator( hypre_StructMatrix         *matrix,
+                                     HYPRE_StructMatrixCoeffFcn  fcn,
+                                     void                       *data )
+{
+   hypre_StructMatrixCoeffFcn(matrix)     = fcn;
+   hypre_StructMatrixCoeffFcnData(matrix) = data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixGenerateValues
+ * Evaluates the coefficients of stencil entry 'entry' at every index of
+ * 'box' with the coefficient generator, ordered as in a BoxLoop over 'box'.
+ * Transpose entries of symmetric matrices are evaluated at the neighboring
+ * index, where the corresponding stored entry lives.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixGenerateValues( hypre_StructMatrix *matrix,
+                                  hypre_Box          *box,
+                                  HYPRE_Int           entry,
+                                  HYPRE_Complex      *values )
+{
+   HYPRE_Int             ndim  = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             symm  = hypre_StructMatrixSymmElements(matrix)[entry];
+   hypre_Index          *shape = hypre_StructStencilShape(hypre_StructMatrixStencil(matrix));
+   hypre_Index           ilower, iupper;
+
+   hypre_CopyToCleanIndex(hypre_BoxIMin(box), ndim, ilower);
+   hypre_CopyToCleanIndex(hypre_BoxIMax(box), ndim, iupper);
+   if (symm >= 0)
+   {
+      hypre_AddIndexes(ilower, shape[entry], ndim, ilower);
+      hypre_AddIndexes(iupper, shape[entry], ndim, iupper);
+      entry = symm;
+   }
+
+   if ((hypre_StructMatrixCoeffFcn(matrix))(hypre_StructMatrixCoeffFcnData(matrix),
+                                            ilower, iupper, 1, &entry, values))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coefficient generator failed");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixMaterializeBox
+ * Returns a new matrix on a one-box grid over 'box' (on hypre_MPI_COMM_SELF)
+ * holding the coefficients of a matrix with a coefficient generator, so that
+ * setup routines needing explicit coefficients (e.g., to compute coarse grid
+ * operators) can work on one piece of the grid at a time.  The ghost layers
+ * are filled as well, as if the matrix had been assembled on the full grid:
+ * points in a periodic image of the grid get the coefficients of the image,
+ * and points outside of the domain get identity rows.  The box may reach past
+ * the grid of 'matrix'.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixMaterializeBox( hypre_StructMatrix *matrix,
+                                  hypre_Box          *box )
+{
+   hypre_StructGrid     *grid          = hypre_StructMatrixGrid(matrix);
+   hypre_BoxManager     *boxman        = hypre_StructGridBoxMan(grid);
+   hypre_StructStencil  *user_stencil  = hypre_StructMatrixUserStencil(matrix);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(matrix);
+
+   hypre_StructGrid     *box_grid;
+   hypre_StructMatrix   *mat;
+   hypre_BoxManEntry   **boxman_entries;
+   hypre_Box            *data_box;
+   hypre_Box            *shift_box;
+   hypre_Box            *int_box;
+   hypre_IndexRef        pshift;
+   hypre_Index           ilower, iupper;
+   hypre_Index           diag_index;
+   hypre_Index           loop_size;
+   hypre_Index           unit_stride;
+   HYPRE_Int            *entries;
+   HYPRE_Complex        *values;
+   HYPRE_Complex        *dp;
+   HYPRE_Int             nentries, num_boxman_entries, diag_rank;
+   HYPRE_Int             p, j;
+
+   hypre_StructGridCreate(hypre_MPI_COMM_SELF, ndim, &box_grid);
+   hypre_StructGridSetExtents(box_grid, hypre_BoxIMin(box), hypre_BoxIMax(box));
+   hypre_StructGridAssemble(box_grid);
+
+   mat = hypre_StructMatrixCreate(hypre_MPI_COMM_SELF, box_grid, user_stencil);
+   hypre_StructMatrixSymmetric(mat) = hypre_StructMatrixSymmetric(matrix);
+   hypre_StructMatrixInitialize(mat);
+   hypre_StructGridDestroy(box_grid);
+
+   /* start from identity rows, including the ghost layers */
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(hypre_StructMatrixStencil(mat), diag_index);
+   data_box  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(mat), 0);
+   dp        = hypre_StructMatrixBoxData(mat, 0, diag_rank);
+   hypre_SetIndex(unit_stride, 1);
+   hypre_BoxGetSize(data_box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(dp)
+   hypre_BoxLoop1Begin(ndim, loop_size,
+                       data_box, hypre_BoxIMin(data_box), unit_stride, di);
+   {
+      dp[di] = 1.0;
+   }
+   hypre_BoxLoop1End(di);
+#undef DEVICE_VAR
+
+   /* only the stored entries need to be generated */
+   entries  = hypre_TAlloc(HYPRE_Int, hypre_StructStencilSize(user_stencil), HYPRE_MEMORY_HOST);
+   nentries = 0;
+   for (j = 0; j < hypre_StructStencilSize(user_stencil); j++)
+   {
+      if (symm_elements[j] < 0)
+      {
+         entries[nentries++] = j;
+      }
+   }
+   values = hypre_TAlloc(HYPRE_Complex, nentries * hypre_BoxVolume(data_box), HYPRE_MEMORY_HOST);
+
+   /* generate the coefficients on the parts of the data box in the grid or in
+    * one of its periodic images */
+   shift_box = hypre_BoxCreate(ndim);
+   int_box   = hypre_BoxCreate(ndim);
+   for (p = 0; p < hypre_StructGridNumPeriods(grid); p++)
+   {
+      pshift = hypre_StructGridPShift(grid, p);
+      hypre_CopyBox(data_box, shift_box);
+      hypre_BoxShiftNeg(shift_box, pshift);
+
+      hypre_BoxManIntersect(boxman, hypre_BoxIMin(shift_box), hypre_BoxIMax(shift_box),
+                            &boxman_entries, &num_boxman_entries);
+      for (j = 0; j < num_boxman_entries; j++)
+      {
+         hypre_BoxManEntryGetExtents(boxman_entries[j],
+                                     hypre_BoxIMin(int_box), hypre_BoxIMax(int_box));
+         hypre_IntersectBoxes(int_box, shift_box, int_box);
+         if (hypre_BoxVolume(int_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_CopyToCleanIndex(hypre_BoxIMin(int_box), ndim, ilower);
+         hypre_CopyToCleanIndex(hypre_BoxIMax(int_box), ndim, iupper);
+         if ((hypre_StructMatrixCoeffFcn(matrix))(hypre_StructMatrixCoeffFcnData(matrix),
+                                                  ilower, iupper, nentries, entries, values))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coefficient generator failed");
+         }
+
+         hypre_BoxShiftPos(int_box, pshift);
+         hypre_StructMatrixSetBoxValues(mat, int_box, int_box, nentries, entries,
+                                        values, 0, 0, 1);
+      }
+      hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_BoxDestroy(shift_box);
+   hypre_BoxDestroy(int_box);
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   return mat;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixSetConstantCoefficient
  * deprecated in user interface, in favor of SetConstantEntries.
@@ -20,6 +20,28 @@
 #endif
 #define MAX_DEPTH 7
 
+/* the fused single-pass kernels capture a variable number of local coefficient
+ * pointers inside the loop body, so they are only available with host BoxLoops */
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_SYCL)
+#define HYPRE_STRUCT_MATVEC_FUSED 1
+#endif
+
+/* largest stencil handled by the fused kernels */
+#define HYPRE_SMV_FUSED_MAX 27
+
+/* number of points per chunk for which coefficients are generated at a time
+ * by hypre_StructMatvecGen (the per-thread buffer holds stencil_size times
+ * this many values) */
+#define HYPRE_SMV_GEN_CHUNK 2048
+
+/* x and y never overlap in the fused kernels (see hypre_StructMatvecCompute),
+ * which lets the compiler vectorize without runtime alias checks */
+#if defined(_MSC_VER)
+#define hypre_SMVRestrict __restrict
+#else
+#define hypre_SMVRestrict __restrict__
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -118,6 +140,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 
    HYPRE_Complex            temp;
    HYPRE_Int                compute_i, i;
+   HYPRE_Int                fused = 0;
+   HYPRE_Int                gen = 0;
 
    hypre_StructVector      *x_tmp = NULL;
 
@@ -162,11 +186,42 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       return hypre_error_flag;
    }
 
+   if (hypre_StructMatrixCoeffFcn(A))
+   {
+#if defined(HYPRE_STRUCT_MATVEC_FUSED)
+      gen = 1;
+#else
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficient generator matrices require host BoxLoops");
+      return hypre_error_flag;
+#endif
+   }
+
    if (x == y)
    {
       x_tmp = hypre_StructVectorClone(y);
       x = x_tmp;
    }
+
+   /*-----------------------------------------------------------------------
+    * For the common stencils, the scaling of y is folded into the kernel
+    * so that y is swept only once (the indt and dept boxes partition the
+    * grid boxes, so each point is scaled exactly once).
+    *-----------------------------------------------------------------------*/
+
+#if defined(HYPRE_STRUCT_MATVEC_FUSED)
+   fused = gen || hypre_StructMatvecFusedStencil(A);
+#endif
+
+   if ( constant_coefficient == 1 )
+   {
+      temp = beta;
+   }
+   else
+   {
+      temp = beta / alpha;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha != 0.0) computation
     *-----------------------------------------------------------------------*/
@@ -187,15 +242,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
              * beta*y for constant coefficient (where only Ax gets multiplied by alpha)
              *--------------------------------------------------------------*/
 
-            if ( constant_coefficient == 1 )
-            {
-               temp = beta;
-            }
-            else
-            {
-               temp = beta / alpha;
-            }
-            if (temp != 1.0)
+            if (temp != 1.0 && !fused)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
                hypre_ForBoxI(i, boxes)
@@ -252,12 +299,32 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (gen)
+            {
+#if defined(HYPRE_STRUCT_MATVEC_FUSED)
+               hypre_StructMatvecGen( alpha, temp, A, x, y, compute_box_aa, stride );
+#endif
+            }
+            else if (fused)
+            {
+               hypre_StructMatvecCC0Fused( alpha, temp, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
          {
-            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            if (fused)
+            {
+               hypre_StructMatvecCC1Fused( alpha, temp, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 2:
@@ -597,6 +664,496 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFusedStencil
+ * returns 1 if the single-pass kernels should be used for A, 0 otherwise.
+ * Variable coefficient matrices with 5, 9 (2D) and 7, 19, 27 (3D) point
+ * stencils are supported.  For constant coefficients the kernel is compute
+ * bound, and the multi-pass kernel is faster beyond MAX_DEPTH entries.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFusedStencil( hypre_StructMatrix *A )
+{
+   HYPRE_Int  constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   if (constant_coefficient == 2)
+   {
+      return 0;
+   }
+
+   switch (stencil_size)
+   {
+      case 5:
+      case 7:
+         return 1;
+      case 9:
+      case 19:
+      case 27:
+         return (constant_coefficient == 0);
+   }
+
+   return 0;
+}
+
+#if defined(HYPRE_STRUCT_MATVEC_FUSED)
+
+/* The coefficient pointers (or values) and offsets of each stencil entry are
+ * copied to scalar locals so that the compiler keeps them in registers */
+#define hypre_SMVLocal(k) \
+   HYPRE_Complex *Ap##k = Ap[k]; HYPRE_Int xoff##k = xoff[k];
+#define hypre_SMVCLocal(k) \
+   HYPRE_Complex AAp##k = AAp[k]; HYPRE_Int xoff##k = xoff[k];
+#define hypre_SMVTerm(k)  Ap##k[Ai] * xp[xi + xoff##k]
+#define hypre_SMVCTerm(k) AAp##k * xp[xi + xoff##k]
+
+/* Partial sums of MAX_DEPTH terms, added left to right in the same order as
+ * the unrolled kernels above so that the results are bitwise identical */
+#define hypre_SMVSum2(T, k0, k1) \
+   (T(k0) + T(k1))
+#define hypre_SMVSum5(T, k0, k1, k2, k3, k4) \
+   (T(k0) + T(k1) + T(k2) + T(k3) + T(k4))
+#define hypre_SMVSum6(T, k0, k1, k2, k3, k4, k5) \
+   (T(k0) + T(k1) + T(k2) + T(k3) + T(k4) + T(k5))
+#define hypre_SMVSum7(T, k0, k1, k2, k3, k4, k5, k6) \
+   (T(k0) + T(k1) + T(k2) + T(k3) + T(k4) + T(k5) + T(k6))
+#define hypre_SMVLocal7(L, k0, k1, k2, k3, k4, k5, k6) \
+   L(k0) L(k1) L(k2) L(k3) L(k4) L(k5) L(k6)
+
+/* Instantiates LOOP(YINIT, SUM) for the supported stencil sizes.  The scaling
+ * of y is resolved outside of the loop; temp == 0 must not read y. */
+#define hypre_SMVYDispatch(LOOP, SUM)                                       \
+   if (temp == 0.0)                                                         \
+   {                                                                        \
+      LOOP(0.0, SUM);                                                       \
+   }                                                                        \
+   else if (temp == 1.0)                                                    \
+   {                                                                        \
+      LOOP(yp[yi], SUM);                                                    \
+   }                                                                        \
+   else                                                                     \
+   {                                                                        \
+      LOOP(temp * yp[yi], SUM);                                             \
+   }
+
+#define hypre_SMVDispatch(LOOP, L, T)                                       \
+   switch (stencil_size)                                                    \
+   {                                                                        \
+      case 5:                                                               \
+      {                                                                     \
+         L(0) L(1) L(2) L(3) L(4)                                           \
+         hypre_SMVYDispatch(LOOP, hypre_SMVSum5(T, 0, 1, 2, 3, 4));         \
+      }                                                                     \
+      break;                                                                \
+      case 7:                                                               \
+      {                                                                     \
+         hypre_SMVLocal7(L, 0, 1, 2, 3, 4, 5, 6)                            \
+         hypre_SMVYDispatch(LOOP, hypre_SMVSum7(T, 0, 1, 2, 3, 4, 5, 6));   \
+      }                                                                     \
+      break;                                                                \
+      case 9:                                                               \
+      {                                                                     \
+         hypre_SMVLocal7(L, 0, 1, 2, 3, 4, 5, 6) L(7) L(8)                  \
+         hypre_SMVYDispatch(LOOP, hypre_SMVSum7(T, 0, 1, 2, 3, 4, 5, 6) +   \
+                            hypre_SMVSum2(T, 7, 8));                        \
+      }                                                                     \
+      break;                                                                \
+      case 19:                                                              \
+      {                                                                     \
+         hypre_SMVLocal7(L, 0, 1, 2, 3, 4, 5, 6)                            \
+         hypre_SMVLocal7(L, 7, 8, 9, 10, 11, 12, 13)                        \
+         L(14) L(15) L(16) L(17) L(18)                                      \
+         hypre_SMVYDispatch(LOOP, hypre_SMVSum7(T, 0, 1, 2, 3, 4, 5, 6) +   \
+                            hypre_SMVSum7(T, 7, 8, 9, 10, 11, 12, 13) +     \
+                            hypre_SMVSum5(T, 14, 15, 16, 17, 18));          \
+      }                                                                     \
+      break;                                                                \
+      case 27:                                                              \
+      {                                                                     \
+         hypre_SMVLocal7(L, 0, 1, 2, 3, 4, 5, 6)                            \
+         hypre_SMVLocal7(L, 7, 8, 9, 10, 11, 12, 13)                        \
+         hypre_SMVLocal7(L, 14, 15, 16, 17, 18, 19, 20)                     \
+         L(21) L(22) L(23) L(24) L(25) L(26)                                \
+         hypre_SMVYDispatch(LOOP, hypre_SMVSum7(T, 0, 1, 2, 3, 4, 5, 6) +   \
+                            hypre_SMVSum7(T, 7, 8, 9, 10, 11, 12, 13) +     \
+                            hypre_SMVSum7(T, 14, 15, 16, 17, 18, 19, 20) +  \
+                            hypre_SMVSum6(T, 21, 22, 23, 24, 25, 26));      \
+      }                                                                     \
+      break;                                                                \
+   }
+
+#define hypre_SMVCC0Loop(YINIT, SUM)                                        \
+   hypre_BoxLoop3Begin(ndim, loop_size,                                     \
+                       A_data_box, start, stride, Ai,                       \
+                       x_data_box, start, stride, xi,                       \
+                       y_data_box, start, stride, yi);                      \
+   {                                                                        \
+      yp[yi] = alpha * (YINIT + SUM);                                       \
+   }                                                                        \
+   hypre_BoxLoop3End(Ai, xi, yi)
+
+#define hypre_SMVCC1Loop(YINIT, SUM)                                        \
+   hypre_BoxLoop2Begin(ndim, loop_size,                                     \
+                       x_data_box, start, stride, xi,                       \
+                       y_data_box, start, stride, yi);                      \
+   {                                                                        \
+      yp[yi] = YINIT + SUM;                                                 \
+   }                                                                        \
+   hypre_BoxLoop2End(xi, yi)
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCC0Fused
+ * single-pass version of hypre_StructMatvecCC0 for the stencils accepted by
+ * hypre_StructMatvecFusedStencil.  Computes y = alpha*(temp*y + A*x) with
+ * one sweep over y per compute box, i.e., the scaling of y by temp and the
+ * final scaling by alpha are folded into the stencil loop.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecCC0Fused( HYPRE_Complex        alpha,
+                            HYPRE_Complex        temp,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa,
+                            hypre_IndexRef       stride )
+{
+   HYPRE_Int                i, j, si;
+   HYPRE_Complex           *Ap[HYPRE_SMV_FUSED_MAX];
+   HYPRE_Int                xoff[HYPRE_SMV_FUSED_MAX];
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *hypre_SMVRestrict xp;
+   HYPRE_Complex           *hypre_SMVRestrict yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         /* alpha*v is exact for alpha == 1, so no special case is needed */
+         hypre_SMVDispatch(hypre_SMVCC0Loop, hypre_SMVLocal, hypre_SMVTerm);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCC1Fused
+ * single-pass version of hypre_StructMatvecCC1 for the stencils accepted by
+ * hypre_StructMatvecFusedStencil.  Computes y = temp*y + (alpha*A)*x with
+ * one sweep over y per compute box.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecCC1Fused( HYPRE_Complex        alpha,
+                            HYPRE_Complex        temp,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa,
+                            hypre_IndexRef       stride )
+{
+   HYPRE_Int                i, j, si;
+   HYPRE_Complex            AAp[HYPRE_SMV_FUSED_MAX];
+   HYPRE_Int                xoff[HYPRE_SMV_FUSED_MAX];
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *hypre_SMVRestrict xp;
+   HYPRE_Complex           *hypre_SMVRestrict yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         AAp[si]  = hypre_StructMatrixBoxData(A, i, si)[0] * alpha;
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         hypre_SMVDispatch(hypre_SMVCC1Loop, hypre_SMVCLocal, hypre_SMVCTerm);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+#define hypre_SMVGenLoop(YINIT, SUM)                                        \
+   Ai = 0;                                                                  \
+   hypre_SerialBoxLoop2Begin(ndim, chunk_size,                              \
+                             x_data_box, chunk_start, stride, xi,           \
+                             y_data_box, chunk_start, stride, yi);          \
+   {                                                                        \
+      yp[yi] = alpha * (YINIT + SUM);                                       \
+      Ai++;                                                                 \
+   }                                                                        \
+   hypre_SerialBoxLoop2End(xi, yi)
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecGen
+ * version of hypre_StructMatvecCC0Fused for matrices with a coefficient
+ * generator.  Each compute box is split into chunks of at most
+ * HYPRE_SMV_GEN_CHUNK points (whole lines or planes where possible), the
+ * coefficients of a chunk are generated into a per-thread buffer, and
+ * y = alpha*(temp*y + A*x) is computed for the chunk while the buffer is
+ * still in cache.  Requires a unit stride and at most HYPRE_SMV_FUSED_MAX
+ * stencil entries; the common stencils use the fused kernel sums.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecGen( HYPRE_Complex        alpha,
+                       HYPRE_Complex        temp,
+                       hypre_StructMatrix  *A,
+                       hypre_StructVector  *x,
+                       hypre_StructVector  *y,
+                       hypre_BoxArrayArray *compute_box_aa,
+                       hypre_IndexRef       stride )
+{
+   HYPRE_Int                i, j, c, d, si;
+   HYPRE_Int               *xoff;
+   HYPRE_Complex           *buffer;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *hypre_SMVRestrict xp;
+   HYPRE_Complex           *hypre_SMVRestrict yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+   HYPRE_Int                cdim, plane, cwidth, nb, nchunks;
+   HYPRE_Int                fused;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+   if (stencil_size > HYPRE_SMV_FUSED_MAX)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Stencil too large for coefficient generator");
+      return hypre_error_flag;
+   }
+   fused         = (stencil_size == 5 || stencil_size == 7 || stencil_size == 9 ||
+                    stencil_size == 19 || stencil_size == 27);
+
+   xoff   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   buffer = hypre_TAlloc(HYPRE_Complex, hypre_NumThreads() * stencil_size * HYPRE_SMV_GEN_CHUNK,
+                         HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         /* chunks span all of dimensions < cdim, cwidth layers of dimension
+          * cdim, and a single layer of dimensions > cdim */
+         plane = 1;
+         for (cdim = 0; cdim < (ndim - 1); cdim++)
+         {
+            if (plane * loop_size[cdim] > HYPRE_SMV_GEN_CHUNK)
+            {
+               break;
+            }
+            plane *= loop_size[cdim];
+         }
+         cwidth  = hypre_max(1, hypre_min(HYPRE_SMV_GEN_CHUNK / plane, loop_size[cdim]));
+         nb      = (loop_size[cdim] + cwidth - 1) / cwidth;
+         nchunks = nb;
+         for (d = cdim + 1; d < ndim; d++)
+         {
+            nchunks *= loop_size[d];
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(c) HYPRE_SMP_SCHEDULE
+#endif
+         for (c = 0; c < nchunks; c++)
+         {
+            HYPRE_Complex  *vp = buffer + hypre_GetThreadNum() * stencil_size * HYPRE_SMV_GEN_CHUNK;
+            HYPRE_Complex  *Ap[HYPRE_SMV_FUSED_MAX];
+            hypre_Box       chunk_box;
+            hypre_Index     chunk_size;
+            hypre_IndexRef  chunk_start;
+            HYPRE_Int       k, rest, vol, Ai;
+            HYPRE_Complex   sum;
+
+            hypre_BoxInit(&chunk_box, ndim);
+            rest = c / nb;
+            for (k = 0; k < ndim; k++)
+            {
+               if (k < cdim)
+               {
+                  hypre_BoxIMinD(&chunk_box, k) = start[k];
+                  hypre_BoxIMaxD(&chunk_box, k) = start[k] + loop_size[k] - 1;
+               }
+               else if (k == cdim)
+               {
+                  hypre_BoxIMinD(&chunk_box, k) = start[k] + (c % nb) * cwidth;
+                  hypre_BoxIMaxD(&chunk_box, k) = hypre_min(hypre_BoxIMinD(&chunk_box, k) + cwidth,
+                                                            start[k] + loop_size[k]) - 1;
+               }
+               else
+               {
+                  hypre_BoxIMinD(&chunk_box, k) = start[k] + (rest % loop_size[k]);
+                  hypre_BoxIMaxD(&chunk_box, k) = hypre_BoxIMinD(&chunk_box, k);
+                  rest /= loop_size[k];
+               }
+            }
+            hypre_BoxGetSize(&chunk_box, chunk_size);
+            chunk_start = hypre_BoxIMin(&chunk_box);
+            vol = hypre_BoxVolume(&chunk_box);
+
+            for (k = 0; k < stencil_size; k++)
+            {
+               hypre_StructMatrixGenerateValues(A, &chunk_box, k, vp + k * vol);
+            }
+
+            for (k = 0; k < stencil_size; k++)
+            {
+               Ap[k] = vp + k * vol;
+            }
+
+            /* the serial loop visits the chunk in the generator's ordering */
+            if (fused)
+            {
+               hypre_SMVDispatch(hypre_SMVGenLoop, hypre_SMVLocal, hypre_SMVTerm);
+            }
+            else
+            {
+               Ai = 0;
+               hypre_SerialBoxLoop2Begin(ndim, chunk_size,
+                                         x_data_box, chunk_start, stride, xi,
+                                         y_data_box, chunk_start, stride, yi);
+               {
+                  sum = 0.0;
+                  for (k = 0; k < stencil_size; k++)
+                  {
+                     sum += Ap[k][Ai] * xp[xi + xoff[k]];
+                  }
+                  yp[yi] = alpha * ((temp == 0.0) ? sum : (temp * yp[yi] + sum));
+                  Ai++;
+               }
+               hypre_SerialBoxLoop2End(xi, yi);
+            }
+         }
+      }
+   }
+
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+#undef hypre_SMVLocal
+#undef hypre_SMVCLocal
+#undef hypre_SMVTerm
+#undef hypre_SMVCTerm
+#undef hypre_SMVLocal7
+#undef hypre_SMVSum2
+#undef hypre_SMVSum5
+#undef hypre_SMVSum6
+#undef hypre_SMVSum7
+#undef hypre_SMVYDispatch
+#undef hypre_SMVDispatch
+#undef hypre_SMVCC0Loop
+#undef hypre_SMVCC1Loop
+#undef hypre_SMVGenLoop
+
+#endif /* #if defined(HYPRE_STRUCT_MATVEC_FUSED) */
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC1
  * core of struct matvec computation, for the case constant_coefficient==1
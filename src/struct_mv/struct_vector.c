@@ -177,6 +177,68 @@ hypre_StructVectorInitializeData( hypre_StructVector *vector,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Allocate zeroed data for the boxes of data_space, stored one after the
+ * other as in struct vectors and matrices.  With HYPRE_SetStructFirstTouch,
+ * host data is zeroed with BoxLoops instead of calloc, so that each page is
+ * first touched by the thread that works on it later.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Complex *
+hypre_StructDataAlloc( hypre_BoxArray       *data_space,
+                       HYPRE_Int             data_size,
+                       HYPRE_MemoryLocation  memory_location )
+{
+   HYPRE_Int       ndim = hypre_BoxArrayNDim(data_space);
+   HYPRE_Complex  *data;
+   HYPRE_Complex  *datap;
+   hypre_Box      *data_box;
+   hypre_Index     loop_size, unit_stride;
+   HYPRE_Int       volume, num_values;
+   HYPRE_Int       i, j;
+
+   if ( !hypre_HandleStructFirstTouch(hypre_handle()) ||
+        hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST )
+   {
+      return hypre_CTAlloc(HYPRE_Complex, data_size, memory_location);
+   }
+
+   volume = 0;
+   hypre_ForBoxI(i, data_space)
+   {
+      volume += hypre_BoxVolume(hypre_BoxArrayBox(data_space, i));
+   }
+   if (volume == 0 || data_size % volume)
+   {
+      return hypre_CTAlloc(HYPRE_Complex, data_size, memory_location);
+   }
+   num_values = data_size / volume;
+
+   data = hypre_TAlloc(HYPRE_Complex, data_size, memory_location);
+
+   hypre_SetIndex(unit_stride, 1);
+   datap = data;
+   hypre_ForBoxI(i, data_space)
+   {
+      data_box = hypre_BoxArrayBox(data_space, i);
+      hypre_BoxGetSize(data_box, loop_size);
+
+      for (j = 0; j < num_values; j++)
+      {
+         zypre_BoxLoop1Begin(ndim, loop_size,
+                             data_box, hypre_BoxIMin(data_box), unit_stride, di);
+         {
+            datap[di] = 0.0;
+         }
+         zypre_BoxLoop1End(di);
+
+         datap += hypre_BoxVolume(data_box);
+      }
+   }
+
+   return data;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -187,8 +249,9 @@ hypre_StructVectorInitialize( hypre_StructVector *vector )
 
    hypre_StructVectorInitializeShell(vector);
 
-   data = hypre_CTAlloc(HYPRE_Complex, hypre_StructVectorDataSize(vector),
-                        hypre_StructVectorMemoryLocation(vector));
+   data = hypre_StructDataAlloc(hypre_StructVectorDataSpace(vector),
+                                hypre_StructVectorDataSize(vector),
+                                hypre_StructVectorMemoryLocation(vector));
 
    hypre_StructVectorInitializeData(vector, data);
    hypre_StructVectorDataAlloced(vector) = 1;
@@ -0,0 +1,92 @@
+#!/bin/sh
+# Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+# HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+#
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+
+TNAME=`basename $0 .sh`
+RTOL=$1
+ATOL=$2
+
+#=============================================================================
+# A. re-assembly through value slots
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.A0\
+ ${TNAME}.out.A1\
+ ${TNAME}.out.A2\
+ ${TNAME}.out.A3\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Frobenius norm" $i
+done > ${TNAME}.out.A
+
+# the assembled matrices must match the reference matrix
+grep "Frobenius norm" ${TNAME}.out.A | awk '$NF > 1.0e-12 {print "Assembly error: " $0}' >&2
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "# Output file" ${TNAME}.out.A | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out.A" >&2
+fi
+
+#=============================================================================
+# B. streamed off-processor AddToValues
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.B0\
+ ${TNAME}.out.B1\
+ ${TNAME}.out.B2\
+ ${TNAME}.out.B3\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Frobenius norm" $i
+done > ${TNAME}.out.B
+
+# the assembled matrices must match the reference matrix
+grep "Frobenius norm" ${TNAME}.out.B | awk '$NF > 1.0e-12 {print "Assembly error: " $0}' >&2
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "# Output file" ${TNAME}.out.B | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out.B" >&2
+fi
+
+#=============================================================================
+# C. threaded AddToValues into the assembled pattern
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.C0\
+ ${TNAME}.out.C1\
+ ${TNAME}.out.C2\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Frobenius norm" $i
+done > ${TNAME}.out.C
+
+# the assembled matrices must match the reference matrix
+grep "Frobenius norm" ${TNAME}.out.C | awk '$NF > 1.0e-12 {print "Assembly error: " $0}' >&2
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "# Output file" ${TNAME}.out.C | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out.C" >&2
+fi
+
+# put all of the output files together
+cat ${TNAME}.out.[A-Z] > ${TNAME}.out
@@ -24,6 +24,33 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# product plans: recomputed values must match the full products
+#=============================================================================
+
+for i in ${TNAME}.out.120 ${TNAME}.out.121
+do
+  grep "Product plan" $i | awk '$NF > 1.0e-12 {print "Product plan error in '$i': " $0}' >&2
+done
+
+#=============================================================================
+# SpMV after in-place value changes must use the new values
+#=============================================================================
+
+for i in ${TNAME}.out.122 ${TNAME}.out.123
+do
+  grep "SpMV after" $i | awk '$NF > 1.0e-12 {print "SpMV error in '$i': " $0}' >&2
+done
+
+#=============================================================================
+# cached block inverses must give the same scaling as recomputed ones
+#=============================================================================
+
+for i in ${TNAME}.out.124 ${TNAME}.out.125
+do
+  grep "Block diagonal inverse" $i | awk '$NF > 1.0e-12 {print "Block inverse error in '$i': " $0}' >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -48,6 +75,12 @@ FILES="\
  ${TNAME}.out.110\
  ${TNAME}.out.111\
  ${TNAME}.out.112\
+ ${TNAME}.out.120\
+ ${TNAME}.out.121\
+ ${TNAME}.out.122\
+ ${TNAME}.out.123\
+ ${TNAME}.out.124\
+ ${TNAME}.out.125\
 "
 
 for i in $FILES
@@ -49,6 +49,105 @@ tail -3 ${TNAME}.out.403.p | head -2 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.403.n | head -2 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+tail -3 ${TNAME}.out.410.c | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.410.s | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.411.c | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.411.s | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.420.s > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.420.p > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.421.s > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.421.p > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+# unsupported options fall back to standard PCG
+tail -3 ${TNAME}.out.422.s | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.422.p | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.430.g | awk '{print $NF}' > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.430.c | awk '{print $NF}' > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.431.g | awk '{print $NF}' > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.431.c | awk '{print $NF}' > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.440.f | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.440.n | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.441.f | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.441.n | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+# changed values: a full setup may coarsen the lower levels differently
+grep "Iterations" ${TNAME}.out.442.f > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.442.n > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.443.f > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.443.n > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.444.f | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.444.n | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.445.f | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.445.n | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.450.d | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.450.h | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -3 ${TNAME}.out.450.c | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+# each component of the multi-RHS solve must match the single-RHS solve, and
+# the multi-RHS solve must take as many iterations as the slowest component
+for i in 460 461 462 463
+do
+  iters=0
+  for c in 0 1 2 3
+  do
+    a=`grep "Component $c:" ${TNAME}.out.$i.m | awk '{print $NF}'`
+    b=`grep "Component 0:" ${TNAME}.out.$i.$c | awk '{print $NF}'`
+    echo "$a $b" | awk 'NF != 2 || ($1 - $2) > 1.0e-5 * $2 || ($2 - $1) > 1.0e-5 * $2 \
+      {print "Component '$c' of '$i' differs: " $0}' >&2
+    n=`grep "Iterations =" ${TNAME}.out.$i.$c | awk '{print $NF}'`
+    if [ "$n" -gt "$iters" ]; then iters=$n; fi
+  done
+  n=`grep "Iterations =" ${TNAME}.out.$i.m | awk '{print $NF}'`
+  if [ "$n" != "$iters" ]; then
+    echo "Iterations of ${TNAME}.out.$i.m: $n, slowest component: $iters" >&2
+  fi
+done
+
+tail -3 ${TNAME}.out.470.n | head -2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.470.p | head -2 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+for i in 0 1 summary
+do
+  if ! grep -q '"solver": "BoomerAMG", "level": 0, "phase": "setup"' ${TNAME}.prof.$i.json
+  then
+    echo "Missing BoomerAMG setup profile in ${TNAME}.prof.$i.json" >&2
+  fi
+done
+rm -f ${TNAME}.prof.*.json
+
+for i in 480 481
+do
+  tail -3 ${TNAME}.out.$i.p | head -2 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.n | head -2 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -182,6 +281,10 @@ FILES="\
  ${TNAME}.out.211\
  ${TNAME}.out.212\
  ${TNAME}.out.213\
+ ${TNAME}.out.214\
+ ${TNAME}.out.215\
+ ${TNAME}.out.216\
+ ${TNAME}.out.217\
 "
 
 for i in $FILES
@@ -197,6 +300,42 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+FILES="\
+ ${TNAME}.out.460.m\
+ ${TNAME}.out.460.0\
+ ${TNAME}.out.460.1\
+ ${TNAME}.out.460.2\
+ ${TNAME}.out.460.3\
+ ${TNAME}.out.461.m\
+ ${TNAME}.out.461.0\
+ ${TNAME}.out.461.1\
+ ${TNAME}.out.461.2\
+ ${TNAME}.out.461.3\
+ ${TNAME}.out.462.m\
+ ${TNAME}.out.462.0\
+ ${TNAME}.out.462.1\
+ ${TNAME}.out.462.2\
+ ${TNAME}.out.462.3\
+ ${TNAME}.out.463.m\
+ ${TNAME}.out.463.0\
+ ${TNAME}.out.463.1\
+ ${TNAME}.out.463.2\
+ ${TNAME}.out.463.3\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -E "Iterations|Component" $i
+done > ${TNAME}.out.f
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.f | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
@@ -8,6 +8,18 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# sstruct: pipelined PCG should take the same number of iterations as PCG
+#=============================================================================
+
+grep "Iterations" ${TNAME}.out.1 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.21 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.4 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.22 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -30,6 +42,8 @@ FILES="\
  ${TNAME}.out.18\
  ${TNAME}.out.19\
  ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
 "
 # ${TNAME}.out.5\
 # ${TNAME}.out.6\
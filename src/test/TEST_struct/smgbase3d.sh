@@ -36,6 +36,11 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -3 ${TNAME}.out.5 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+
+tail -3 ${TNAME}.out.6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -47,6 +52,7 @@ FILES="\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
  ${TNAME}.out.5\
+ ${TNAME}.out.6\
 "
 
 for i in $FILES
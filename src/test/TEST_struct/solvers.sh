@@ -8,6 +8,30 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# struct: pipelined PCG should take the same number of iterations as PCG
+#=============================================================================
+
+grep "Iterations" ${TNAME}.out.0 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.5 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+grep "Iterations" ${TNAME}.out.1 > ${TNAME}.testdata
+grep "Iterations" ${TNAME}.out.6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# struct: temporally blocked red/black relaxation should not change results
+#=============================================================================
+
+tail -3 ${TNAME}.out.7 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.8 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.9 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.10 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -18,6 +42,12 @@ FILES="\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
+ ${TNAME}.out.5\
+ ${TNAME}.out.6\
+ ${TNAME}.out.7\
+ ${TNAME}.out.8\
+ ${TNAME}.out.9\
+ ${TNAME}.out.10\
 "
 
 for i in $FILES
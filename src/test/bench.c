@@ -0,0 +1,1208 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * Micro-benchmark driver for the basic hypre kernels: ParCSR matvec, SpGEMM,
+ * the Galerkin product (RAP), the BoomerAMG smoothers, struct matvec and the
+ * ParCSR halo exchange.  Each kernel is run a number of warmup times and then
+ * timed over a number of repetitions.  The time of a repetition is the maximum
+ * over all ranks.  Rates are computed from the fastest repetition with the
+ * work models below and compared to a STREAM triad measured by the driver.
+ * Do `bench -help' for usage info.
+ *--------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE.h"
+#include "HYPRE_parcsr_ls.h"
+#include "_hypre_parcsr_ls.h"
+#include "_hypre_parcsr_mv.h"
+#include "HYPRE_struct_mv.h"
+
+#define BENCH_MAX_RESULTS  64
+#define BENCH_MAX_RELAX    32
+
+/*--------------------------------------------------------------------------
+ * Result of one benchmark.  flops, bytes and messages are the global work
+ * of one repetition; bytes are message bytes for the exchange benchmark.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   char        name[64];
+   HYPRE_Int   reps;
+   HYPRE_Real  tmin, tmed, tmean, tstd;
+   HYPRE_Real  flops;
+   HYPRE_Real  bytes;
+   HYPRE_Real  messages;
+   HYPRE_Int   memory_bound;  /* compare to STREAM? */
+
+} BenchResult;
+
+typedef HYPRE_Int (*BenchKernel)( void *data );
+
+/*--------------------------------------------------------------------------
+ * Kernel data
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int   n;
+   HYPRE_Real *a, *b, *c;
+
+} StreamData;
+
+typedef struct
+{
+   hypre_ParCSRMatrix *A;
+   hypre_ParCSRMatrix *P;
+   hypre_ParCSRMatrix *C;
+   hypre_ParVector    *x;
+   hypre_ParVector    *y;
+
+} ParCSRData;
+
+typedef struct
+{
+   hypre_ParCSRMatrix *A;
+   hypre_ParVector    *f, *u, *v, *z;
+   HYPRE_Int           relax_type;
+   HYPRE_Real         *l1_norms;
+
+} RelaxData;
+
+typedef struct
+{
+   HYPRE_StructMatrix  A;
+   HYPRE_StructVector  x;
+   HYPRE_StructVector  y;
+
+} StructData;
+
+typedef struct
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Complex       *send_data;
+   HYPRE_Complex       *recv_data;
+
+} CommData;
+
+/*--------------------------------------------------------------------------
+ * Kernels
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchStreamTriad( void *data )
+{
+   StreamData *stream = (StreamData *) data;
+   HYPRE_Real *a = stream -> a;
+   HYPRE_Real *b = stream -> b;
+   HYPRE_Real *c = stream -> c;
+   HYPRE_Int   i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < stream -> n; i++)
+   {
+      a[i] = b[i] + 3.0 * c[i];
+   }
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchMatvec( void *data )
+{
+   ParCSRData *pd = (ParCSRData *) data;
+
+   return hypre_ParCSRMatrixMatvec(1.0, pd -> A, pd -> x, 0.0, pd -> y);
+}
+
+static HYPRE_Int
+BenchSpGEMM( void *data )
+{
+   ParCSRData *pd = (ParCSRData *) data;
+
+   pd -> C = hypre_ParCSRMatMat(pd -> A, pd -> A);
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchRAP( void *data )
+{
+   ParCSRData *pd = (ParCSRData *) data;
+
+   return hypre_BoomerAMGBuildCoarseOperatorKT(pd -> P, pd -> A, pd -> P, 0, &(pd -> C));
+}
+
+/* Destroys the product of the previous SpGEMM or RAP repetition */
+static HYPRE_Int
+BenchProductReset( void *data )
+{
+   ParCSRData *pd = (ParCSRData *) data;
+
+   if (pd -> C)
+   {
+      hypre_ParCSRMatrixDestroy(pd -> C);
+      pd -> C = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchRelax( void *data )
+{
+   RelaxData *rd = (RelaxData *) data;
+
+   return hypre_BoomerAMGRelax(rd -> A, rd -> f, NULL, rd -> relax_type, 0, 1.0, 1.0,
+                               rd -> l1_norms, rd -> u, rd -> v, rd -> z);
+}
+
+static HYPRE_Int
+BenchStructMatvec( void *data )
+{
+   StructData *sd = (StructData *) data;
+
+   return HYPRE_StructMatrixMatvec(1.0, sd -> A, sd -> x, 0.0, sd -> y);
+}
+
+static HYPRE_Int
+BenchExchange( void *data )
+{
+   CommData               *cd = (CommData *) data;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, cd -> comm_pkg, cd -> send_data,
+                                              cd -> recv_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * BenchRun
+ *
+ * Runs kernel warmup times, then times reps repetitions.  reset (optional)
+ * is called before every run, outside of the timed region.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchRun( MPI_Comm     comm,
+          const char  *name,
+          BenchKernel  kernel,
+          BenchKernel  reset,
+          void        *data,
+          HYPRE_Int    warmup,
+          HYPRE_Int    reps,
+          BenchResult *result )
+{
+   HYPRE_Real *times = hypre_CTAlloc(HYPRE_Real, reps, HYPRE_MEMORY_HOST);
+   HYPRE_Real  t, sum, var;
+   HYPRE_Int   i, j;
+
+   memset(result, 0, sizeof(BenchResult));
+   hypre_sprintf(result -> name, "%s", name);
+   result -> reps = reps;
+
+   for (i = 0; i < warmup; i++)
+   {
+      if (reset)
+      {
+         reset(data);
+      }
+      kernel(data);
+   }
+
+   for (i = 0; i < reps; i++)
+   {
+      if (reset)
+      {
+         reset(data);
+      }
+
+#if defined(HYPRE_USING_GPU)
+      hypre_SyncCudaDevice(hypre_handle());
+#endif
+      hypre_MPI_Barrier(comm);
+      t = hypre_MPI_Wtime();
+
+      kernel(data);
+
+#if defined(HYPRE_USING_GPU)
+      hypre_SyncCudaDevice(hypre_handle());
+#endif
+      t = hypre_MPI_Wtime() - t;
+      hypre_MPI_Allreduce(&t, &times[i], 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   }
+
+   /* insertion sort, reps is small */
+   for (i = 1; i < reps; i++)
+   {
+      t = times[i];
+      for (j = i; j > 0 && times[j - 1] > t; j--)
+      {
+         times[j] = times[j - 1];
+      }
+      times[j] = t;
+   }
+
+   sum = 0.0;
+   for (i = 0; i < reps; i++)
+   {
+      sum += times[i];
+   }
+   var = 0.0;
+   for (i = 0; i < reps; i++)
+   {
+      var += (times[i] - sum / reps) * (times[i] - sum / reps);
+   }
+
+   result -> tmin  = times[0];
+   result -> tmed  = (reps % 2) ? times[reps / 2] : 0.5 * (times[reps / 2 - 1] + times[reps / 2]);
+   result -> tmean = sum / reps;
+   result -> tstd  = (reps > 1) ? sqrt(var / (reps - 1)) : 0.0;
+
+   hypre_TFree(times, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Work models
+ *
+ * A sparse product streams the matrix once and touches each vector entry
+ * once, as in the solver profiler (see utilities/profile.c).  Matrix-matrix
+ * products read their operands once and write the result once.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchSpMVWork( hypre_ParCSRMatrix *A,
+               HYPRE_Int           passes,
+               HYPRE_Real         *flops_ptr,
+               HYPRE_Real         *bytes_ptr )
+{
+   MPI_Comm         comm   = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real       nnz, num_rows, num_cols;
+   HYPRE_Real       work[2], global_work[2];
+
+   nnz      = (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(A_diag) + hypre_CSRMatrixNumNonzeros(A_offd));
+   num_rows = (HYPRE_Real) hypre_CSRMatrixNumRows(A_diag);
+   num_cols = (HYPRE_Real) (hypre_CSRMatrixNumCols(A_diag) + hypre_CSRMatrixNumCols(A_offd));
+
+   work[0] = 2.0 * nnz;
+   work[1] = nnz * (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+             (num_rows + 1.0) * (HYPRE_Real) sizeof(HYPRE_Int) +
+             (num_cols + 2.0 * num_rows) * (HYPRE_Real) sizeof(HYPRE_Complex);
+   hypre_MPI_Allreduce(work, global_work, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   *flops_ptr = (HYPRE_Real) passes * global_work[0];
+   *bytes_ptr = (HYPRE_Real) passes * global_work[1];
+
+   return hypre_error_flag;
+}
+
+/* Global number of stored entries and local number of entries in each row */
+static HYPRE_Real
+BenchRowSizes( hypre_ParCSRMatrix  *A,
+               HYPRE_Int          **row_sizes_ptr )
+{
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *diag_i   = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *offd_i   = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int       *row_sizes;
+   HYPRE_Real       nnz = 0.0, global_nnz;
+   HYPRE_Int        i;
+
+   row_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      row_sizes[i] = (diag_i[i + 1] - diag_i[i]) + (offd_i[i + 1] - offd_i[i]);
+      nnz += (HYPRE_Real) row_sizes[i];
+   }
+   hypre_MPI_Allreduce(&nnz, &global_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParCSRMatrixComm(A));
+
+   if (row_sizes_ptr)
+   {
+      *row_sizes_ptr = row_sizes;
+   }
+   else
+   {
+      hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
+   }
+
+   return global_nnz;
+}
+
+/* Global number of scalar multiplications in A*B; B's rows are distributed
+   as A's columns */
+static HYPRE_Real
+BenchMultCount( hypre_ParCSRMatrix *A,
+                hypre_ParCSRMatrix *B )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int              *offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int               num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int              *B_sizes, *B_ext_sizes, *send_buf;
+   HYPRE_Int               num_sends, i, j;
+   HYPRE_Real              mults = 0.0, global_mults;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   BenchRowSizes(B, &B_sizes);
+
+   send_buf = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                            HYPRE_MEMORY_HOST);
+   B_ext_sizes = hypre_CTAlloc(HYPRE_Int, hypre_CSRMatrixNumCols(A_offd), HYPRE_MEMORY_HOST);
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      send_buf[i] = B_sizes[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, send_buf, B_ext_sizes);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++)
+      {
+         mults += (HYPRE_Real) B_sizes[diag_j[j]];
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++)
+      {
+         mults += (HYPRE_Real) B_ext_sizes[offd_j[j]];
+      }
+   }
+   hypre_MPI_Allreduce(&mults, &global_mults, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParCSRMatrixComm(A));
+
+   hypre_TFree(B_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_ext_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   return global_mults;
+}
+
+/*--------------------------------------------------------------------------
+ * Output
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+BenchRate( HYPRE_Real work, HYPRE_Real time )
+{
+   return (time > 0.0) ? work / time * 1.0e-9 : 0.0;
+}
+
+static HYPRE_Real
+BenchPercentStream( BenchResult *result, HYPRE_Real stream_bw )
+{
+   if (!result -> memory_bound || stream_bw <= 0.0)
+   {
+      return -1.0;
+   }
+
+   return 100.0 * BenchRate(result -> bytes, result -> tmin) / stream_bw;
+}
+
+static HYPRE_Int
+BenchPrint( BenchResult *results,
+            HYPRE_Int    num_results,
+            HYPRE_Real   stream_bw )
+{
+   BenchResult *r;
+   HYPRE_Real   pct;
+   HYPRE_Int    i;
+
+   hypre_printf("\n%-20s %5s %11s %11s %11s %9s %9s %9s %8s\n", "kernel", "reps",
+                "min (s)", "median (s)", "mean (s)", "std (%)", "GFLOP/s", "GB/s", "%STREAM");
+   for (i = 0; i < num_results; i++)
+   {
+      r   = &results[i];
+      pct = BenchPercentStream(r, stream_bw);
+      hypre_printf("%-20s %5d %11.4e %11.4e %11.4e %9.2f %9.3f %9.3f ", r -> name, r -> reps,
+                   r -> tmin, r -> tmed, r -> tmean,
+                   (r -> tmean > 0.0) ? 100.0 * r -> tstd / r -> tmean : 0.0,
+                   BenchRate(r -> flops, r -> tmin), BenchRate(r -> bytes, r -> tmin));
+      if (pct < 0.0)
+      {
+         hypre_printf("%8s\n", "-");
+      }
+      else
+      {
+         hypre_printf("%8.1f\n", pct);
+      }
+   }
+   hypre_printf("\n");
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchPrintJSON( const char  *filename,
+                const char  *problem,
+                HYPRE_BigInt nx,
+                HYPRE_BigInt ny,
+                HYPRE_BigInt nz,
+                HYPRE_Int    num_procs,
+                HYPRE_Real   stream_bw,
+                BenchResult *results,
+                HYPRE_Int    num_results )
+{
+   FILE        *fp;
+   BenchResult *r;
+   HYPRE_Real   pct;
+   HYPRE_Int    i;
+
+   if ((fp = fopen(filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_fprintf(fp, "{\n");
+   hypre_fprintf(fp, "  \"problem\": \"%s\",\n", problem);
+   hypre_fprintf(fp, "  \"n\": [%b, %b, %b],\n", nx, ny, nz);
+   hypre_fprintf(fp, "  \"num_procs\": %d,\n", num_procs);
+   hypre_fprintf(fp, "  \"num_threads\": %d,\n", hypre_NumThreads());
+   hypre_fprintf(fp, "  \"stream_GBps\": %.6e,\n", stream_bw);
+   hypre_fprintf(fp, "  \"kernels\": [\n");
+   for (i = 0; i < num_results; i++)
+   {
+      r   = &results[i];
+      pct = BenchPercentStream(r, stream_bw);
+      hypre_fprintf(fp, "    {\"name\": \"%s\", \"reps\": %d, ", r -> name, r -> reps);
+      hypre_fprintf(fp, "\"time_min\": %.6e, \"time_median\": %.6e, ", r -> tmin, r -> tmed);
+      hypre_fprintf(fp, "\"time_mean\": %.6e, \"time_std\": %.6e, ", r -> tmean, r -> tstd);
+      hypre_fprintf(fp, "\"flops\": %.6e, \"bytes\": %.6e, \"messages\": %.0f, ",
+                    r -> flops, r -> bytes, r -> messages);
+      hypre_fprintf(fp, "\"GFLOPps\": %.6e, \"GBps\": %.6e, ",
+                    BenchRate(r -> flops, r -> tmin), BenchRate(r -> bytes, r -> tmin));
+      if (pct < 0.0)
+      {
+         hypre_fprintf(fp, "\"percent_stream\": null}");
+      }
+      else
+      {
+         hypre_fprintf(fp, "\"percent_stream\": %.6e}", pct);
+      }
+      hypre_fprintf(fp, "%s\n", (i < num_results - 1) ? "," : "");
+   }
+   hypre_fprintf(fp, "  ]\n");
+   hypre_fprintf(fp, "}\n");
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+BenchPrintCSV( const char  *filename,
+               BenchResult *results,
+               HYPRE_Int    num_results,
+               HYPRE_Real   stream_bw )
+{
+   FILE        *fp;
+   BenchResult *r;
+   HYPRE_Real   pct;
+   HYPRE_Int    i;
+
+   if ((fp = fopen(filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_fprintf(fp, "kernel,reps,time_min,time_median,time_mean,time_std,"
+                 "flops,bytes,messages,GFLOPps,GBps,percent_stream\n");
+   for (i = 0; i < num_results; i++)
+   {
+      r = &results[i];
+      pct = BenchPercentStream(r, stream_bw);
+      hypre_fprintf(fp, "%s,%d,%.6e,%.6e,%.6e,%.6e,%.6e,%.6e,%.0f,%.6e,%.6e,",
+                    r -> name, r -> reps, r -> tmin, r -> tmed, r -> tmean, r -> tstd,
+                    r -> flops, r -> bytes, r -> messages,
+                    BenchRate(r -> flops, r -> tmin), BenchRate(r -> bytes, r -> tmin));
+      if (pct < 0.0)
+      {
+         hypre_fprintf(fp, "\n");
+      }
+      else
+      {
+         hypre_fprintf(fp, "%.6e\n", pct);
+      }
+   }
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Struct problem on the same grid and processor topology as the ParCSR
+ * problem: a 7-point (or 27-point) Laplacian
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+BenchBuildStruct( MPI_Comm            comm,
+                  HYPRE_BigInt        nx,
+                  HYPRE_BigInt        ny,
+                  HYPRE_BigInt        nz,
+                  HYPRE_Int           P,
+                  HYPRE_Int           Q,
+                  HYPRE_Int           R,
+                  HYPRE_Int           p,
+                  HYPRE_Int           q,
+                  HYPRE_Int           r,
+                  HYPRE_Int           stencil_size,
+                  HYPRE_StructMatrix *A_ptr,
+                  HYPRE_StructVector *x_ptr,
+                  HYPRE_StructVector *y_ptr )
+{
+   HYPRE_StructGrid     grid;
+   HYPRE_StructStencil  stencil;
+   HYPRE_StructMatrix   A;
+   HYPRE_StructVector   x, y;
+   HYPRE_BigInt        *nx_part, *ny_part, *nz_part;
+   HYPRE_Int            ilower[3], iupper[3], offset[3];
+   HYPRE_Int           *entries;
+   HYPRE_Real          *values;
+   HYPRE_Int            num_points, i, j, k, s;
+
+   hypre_GeneratePartitioning(nx, P, &nx_part);
+   hypre_GeneratePartitioning(ny, Q, &ny_part);
+   hypre_GeneratePartitioning(nz, R, &nz_part);
+
+   ilower[0] = (HYPRE_Int) nx_part[p];  iupper[0] = (HYPRE_Int) nx_part[p + 1] - 1;
+   ilower[1] = (HYPRE_Int) ny_part[q];  iupper[1] = (HYPRE_Int) ny_part[q + 1] - 1;
+   ilower[2] = (HYPRE_Int) nz_part[r];  iupper[2] = (HYPRE_Int) nz_part[r + 1] - 1;
+
+   hypre_TFree(nx_part, HYPRE_MEMORY_HOST);
+   hypre_TFree(ny_part, HYPRE_MEMORY_HOST);
+   hypre_TFree(nz_part, HYPRE_MEMORY_HOST);
+
+   HYPRE_StructGridCreate(comm, 3, &grid);
+   HYPRE_StructGridSetExtents(grid, ilower, iupper);
+   HYPRE_StructGridAssemble(grid);
+
+   /* center first, then the neighbors */
+   HYPRE_StructStencilCreate(3, stencil_size, &stencil);
+   offset[0] = offset[1] = offset[2] = 0;
+   HYPRE_StructStencilSetElement(stencil, 0, offset);
+   s = 1;
+   for (k = -1; k <= 1; k++)
+   {
+      for (j = -1; j <= 1; j++)
+      {
+         for (i = -1; i <= 1; i++)
+         {
+            if ((i == 0 && j == 0 && k == 0) ||
+                (stencil_size == 7 && (hypre_abs(i) + hypre_abs(j) + hypre_abs(k)) != 1))
+            {
+               continue;
+            }
+            offset[0] = i; offset[1] = j; offset[2] = k;
+            HYPRE_StructStencilSetElement(stencil, s++, offset);
+         }
+      }
+   }
+
+   num_points = (iupper[0] - ilower[0] + 1) * (iupper[1] - ilower[1] + 1) *
+                (iupper[2] - ilower[2] + 1);
+   entries = hypre_CTAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   values  = hypre_CTAlloc(HYPRE_Real, num_points * stencil_size, HYPRE_MEMORY_HOST);
+   for (s = 0; s < stencil_size; s++)
+   {
+      entries[s] = s;
+   }
+   for (i = 0; i < num_points; i++)
+   {
+      values[i * stencil_size] = (HYPRE_Real) (stencil_size - 1);
+      for (s = 1; s < stencil_size; s++)
+      {
+         values[i * stencil_size + s] = -1.0;
+      }
+   }
+
+   HYPRE_StructMatrixCreate(comm, grid, stencil, &A);
+   HYPRE_StructMatrixInitialize(A);
+   HYPRE_StructMatrixSetBoxValues(A, ilower, iupper, stencil_size, entries, values);
+   HYPRE_StructMatrixAssemble(A);
+
+   HYPRE_StructVectorCreate(comm, grid, &x);
+   HYPRE_StructVectorInitialize(x);
+   HYPRE_StructVectorSetConstantValues(x, 1.0);
+   HYPRE_StructVectorAssemble(x);
+
+   HYPRE_StructVectorCreate(comm, grid, &y);
+   HYPRE_StructVectorInitialize(y);
+   HYPRE_StructVectorSetConstantValues(y, 0.0);
+   HYPRE_StructVectorAssemble(y);
+
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   HYPRE_StructStencilDestroy(stencil);
+   HYPRE_StructGridDestroy(grid);
+
+   *A_ptr = A;
+   *x_ptr = x;
+   *y_ptr = y;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Main
+ *--------------------------------------------------------------------------*/
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   MPI_Comm             comm = hypre_MPI_COMM_WORLD;
+   HYPRE_Int            arg_index;
+   HYPRE_Int            print_usage;
+   HYPRE_Int            num_procs, myid;
+   HYPRE_Int            problem;
+   const char          *problem_names[3] = {"laplacian", "27pt", "difconv"};
+   HYPRE_BigInt         nx, ny, nz;
+   HYPRE_Int            P, Q, R, p, q, r;
+   HYPRE_Int            warmup, reps;
+   HYPRE_Int            run_matvec, run_spgemm, run_rap, run_relax, run_struct, run_comm;
+   HYPRE_Int            num_relax;
+   HYPRE_Int            relax_types[BENCH_MAX_RELAX] = {0, 3, 4, 6, 7, 8, 13, 14, 18};
+   HYPRE_Int            stream_size;
+   HYPRE_Real           stream_bw;
+   char                *json_file = NULL;
+   char                *csv_file = NULL;
+
+   BenchResult          results[BENCH_MAX_RESULTS];
+   HYPRE_Int            num_results = 0;
+   BenchResult         *result;
+   char                 name[64];
+
+   HYPRE_ParCSRMatrix   A;
+   HYPRE_Real           values[7];
+   HYPRE_Real           h;
+   hypre_ParVector     *x, *y, *v, *z;
+   ParCSRData           pd;
+   HYPRE_Real           flops, bytes, nnz_A;
+   HYPRE_Int            i;
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+
+   hypre_MPI_Comm_size(comm, &num_procs );
+   hypre_MPI_Comm_rank(comm, &myid );
+
+   hypre_bind_device(myid, num_procs, comm);
+
+   HYPRE_Initialize();
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   problem = 0;
+   nx = ny = nz = 50;
+   P = 1;
+   Q = num_procs;
+   R = 1;
+   warmup = 2;
+   reps = 10;
+   run_matvec = run_spgemm = run_rap = run_relax = run_struct = run_comm = 1;
+   num_relax = 9;
+   stream_size = 1 << 23;
+   stream_bw = 0.0;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   print_usage = 0;
+   arg_index = 1;
+
+   while ( (arg_index < argc) && (!print_usage) )
+   {
+      if ( strcmp(argv[arg_index], "-laplacian") == 0 )
+      {
+         arg_index++;
+         problem = 0;
+      }
+      else if ( strcmp(argv[arg_index], "-27pt") == 0 )
+      {
+         arg_index++;
+         problem = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-difconv") == 0 )
+      {
+         arg_index++;
+         problem = 2;
+      }
+      else if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P  = atoi(argv[arg_index++]);
+         Q  = atoi(argv[arg_index++]);
+         R  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-warmup") == 0 )
+      {
+         arg_index++;
+         warmup = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-rep") == 0 )
+      {
+         arg_index++;
+         reps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-kernels") == 0 )
+      {
+         arg_index++;
+         run_matvec = run_spgemm = run_rap = run_relax = run_struct = run_comm = 0;
+         while (arg_index < argc && argv[arg_index][0] != '-')
+         {
+            if (strcmp(argv[arg_index], "matvec") == 0) { run_matvec = 1; }
+            else if (strcmp(argv[arg_index], "spgemm") == 0) { run_spgemm = 1; }
+            else if (strcmp(argv[arg_index], "rap") == 0) { run_rap = 1; }
+            else if (strcmp(argv[arg_index], "relax") == 0) { run_relax = 1; }
+            else if (strcmp(argv[arg_index], "struct") == 0) { run_struct = 1; }
+            else if (strcmp(argv[arg_index], "comm") == 0) { run_comm = 1; }
+            else { print_usage = 1; }
+            arg_index++;
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-rlx") == 0 )
+      {
+         arg_index++;
+         num_relax = atoi(argv[arg_index++]);
+         num_relax = hypre_min(hypre_max(num_relax, 0), BENCH_MAX_RELAX);
+         for (i = 0; i < num_relax; i++)
+         {
+            relax_types[i] = atoi(argv[arg_index++]);
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-stream") == 0 )
+      {
+         arg_index++;
+         stream_bw = (HYPRE_Real) atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-stream_size") == 0 )
+      {
+         arg_index++;
+         stream_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-json") == 0 )
+      {
+         arg_index++;
+         json_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-csv") == 0 )
+      {
+         arg_index++;
+         csv_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   reps = hypre_max(reps, 1);
+
+   /*-----------------------------------------------------------
+    * Print usage info
+    *-----------------------------------------------------------*/
+
+   if ( print_usage )
+   {
+      if ( myid == 0 )
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -laplacian           : 7pt 3D Laplacian (default)\n");
+         hypre_printf("  -27pt                : 27pt 3D Laplacian\n");
+         hypre_printf("  -difconv             : 7pt convection-diffusion\n");
+         hypre_printf("  -n <nx> <ny> <nz>    : global problem size (default 50 50 50)\n");
+         hypre_printf("  -P <Px> <Py> <Pz>    : processor topology\n");
+         hypre_printf("  -warmup <n>          : untimed runs of each kernel (default 2)\n");
+         hypre_printf("  -rep <n>             : timed runs of each kernel (default 10)\n");
+         hypre_printf("  -kernels <k1> ...    : subset of matvec spgemm rap relax struct comm\n");
+         hypre_printf("  -rlx <n> <t1> ...    : relaxation types (default 0 3 4 6 7 8 13 14 18)\n");
+         hypre_printf("  -stream <GB/s>       : STREAM triad bandwidth of all ranks together\n");
+         hypre_printf("                         (default: measured by the driver)\n");
+         hypre_printf("  -stream_size <n>     : triad array length per rank (default 2^23)\n");
+         hypre_printf("  -json <file>         : write the results as JSON\n");
+         hypre_printf("  -csv <file>          : write the results as CSV\n");
+         hypre_printf("\n");
+      }
+
+      HYPRE_Finalize();
+      hypre_MPI_Finalize();
+
+      return (0);
+   }
+
+   /*-----------------------------------------------------------
+    * Check a few things
+    *-----------------------------------------------------------*/
+
+   if ((P * Q * R) != num_procs)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: Invalid number of processors or processor topology \n");
+      }
+      exit(1);
+   }
+
+   p = myid % P;
+   q = (( myid - p) / P) % Q;
+   r = ( myid - p - P * q) / ( P * Q );
+
+   if (myid == 0)
+   {
+      hypre_printf("  Benchmark problem: %s\n", problem_names[problem]);
+      hypre_printf("    (nx, ny, nz) = (%b, %b, %b)\n", nx, ny, nz);
+      hypre_printf("    (Px, Py, Pz) = (%d, %d, %d)\n", P,  Q,  R);
+      hypre_printf("    warmup = %d, reps = %d, threads = %d\n", warmup, reps, hypre_NumThreads());
+   }
+
+   /*-----------------------------------------------------------
+    * STREAM triad
+    *-----------------------------------------------------------*/
+
+   if (stream_bw <= 0.0)
+   {
+      StreamData stream;
+
+      stream.n = stream_size;
+      stream.a = hypre_CTAlloc(HYPRE_Real, stream_size, HYPRE_MEMORY_HOST);
+      stream.b = hypre_CTAlloc(HYPRE_Real, stream_size, HYPRE_MEMORY_HOST);
+      stream.c = hypre_CTAlloc(HYPRE_Real, stream_size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < stream_size; i++)
+      {
+         stream.b[i] = 1.0;
+         stream.c[i] = 2.0;
+      }
+
+      result = &results[num_results++];
+      BenchRun(comm, "stream_triad", BenchStreamTriad, NULL, &stream, warmup, reps, result);
+      result -> flops = 2.0 * (HYPRE_Real) stream_size * num_procs;
+      result -> bytes = 3.0 * sizeof(HYPRE_Real) * (HYPRE_Real) stream_size * num_procs;
+      result -> memory_bound = 1;
+      stream_bw = BenchRate(result -> bytes, result -> tmin);
+
+      hypre_TFree(stream.a, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream.b, HYPRE_MEMORY_HOST);
+      hypre_TFree(stream.c, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------
+    * Generate the ParCSR matrix
+    *-----------------------------------------------------------*/
+
+   if (problem == 0)
+   {
+      values[0] = 6.0;
+      values[1] = values[2] = values[3] = -1.0;
+      A = GenerateLaplacian(comm, nx, ny, nz, P, Q, R, p, q, r, values);
+   }
+   else if (problem == 1)
+   {
+      values[0] = 26.0;
+      values[1] = -1.0;
+      A = GenerateLaplacian27pt(comm, nx, ny, nz, P, Q, R, p, q, r, values);
+   }
+   else
+   {
+      /* centered differences, unit diffusion and convection */
+      h = 1.0 / (HYPRE_Real) (hypre_max(hypre_max(nx, ny), nz) + 1);
+      values[0] = 6.0 / (h * h);
+      values[1] = values[2] = values[3] = -1.0 / (h * h) - 0.5 / h;
+      values[4] = values[5] = values[6] = -1.0 / (h * h) + 0.5 / h;
+      A = GenerateDifConv(comm, nx, ny, nz, P, Q, R, p, q, r, values);
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   nnz_A = BenchRowSizes(A, NULL);
+
+   if (myid == 0)
+   {
+      hypre_printf("    rows = %b, nonzeros = %.0f\n", hypre_ParCSRMatrixGlobalNumRows(A), nnz_A);
+   }
+
+   x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   y = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   v = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   z = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(x);
+   hypre_ParVectorInitialize(y);
+   hypre_ParVectorInitialize(v);
+   hypre_ParVectorInitialize(z);
+   hypre_ParVectorSetRandomValues(x, 1);
+
+   memset(&pd, 0, sizeof(ParCSRData));
+   pd.A = A;
+   pd.x = x;
+   pd.y = y;
+
+   /*-----------------------------------------------------------
+    * ParCSR matvec
+    *-----------------------------------------------------------*/
+
+   if (run_matvec)
+   {
+      result = &results[num_results++];
+      BenchRun(comm, "matvec", BenchMatvec, NULL, &pd, warmup, reps, result);
+      BenchSpMVWork(A, 1, &(result -> flops), &(result -> bytes));
+      result -> memory_bound = 1;
+   }
+
+   /*-----------------------------------------------------------
+    * SpGEMM: A*A
+    *-----------------------------------------------------------*/
+
+   if (run_spgemm)
+   {
+      result = &results[num_results++];
+      BenchRun(comm, "spgemm", BenchSpGEMM, BenchProductReset, &pd, warmup, reps, result);
+      result -> flops = 2.0 * BenchMultCount(A, A);
+      result -> bytes = (2.0 * nnz_A + BenchRowSizes(pd.C, NULL)) *
+                        (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+                        3.0 * (HYPRE_Real) (hypre_ParCSRMatrixGlobalNumRows(A) + num_procs) *
+                        (HYPRE_Real) sizeof(HYPRE_Int);
+      result -> memory_bound = 1;
+      BenchProductReset(&pd);
+   }
+
+   /*-----------------------------------------------------------
+    * Galerkin product with the BoomerAMG interpolation of the
+    * first level: P^T*A*P
+    *-----------------------------------------------------------*/
+
+   if (run_rap)
+   {
+      HYPRE_Solver        amg;
+      hypre_ParCSRMatrix *AP;
+      HYPRE_Int          *P_sizes, *AP_sizes;
+      HYPRE_Real          mults = 0.0, global_mults;
+
+      HYPRE_BoomerAMGCreate(&amg);
+      HYPRE_BoomerAMGSetMaxLevels(amg, 2);
+      HYPRE_BoomerAMGSetCycleRelaxType(amg, 8, 3);
+      HYPRE_BoomerAMGSetPrintLevel(amg, 0);
+      HYPRE_BoomerAMGSetup(amg, A, (HYPRE_ParVector) y, (HYPRE_ParVector) x);
+
+      if (hypre_ParAMGDataNumLevels((hypre_ParAMGData *) amg) > 1)
+      {
+         pd.P = hypre_ParAMGDataPArray((hypre_ParAMGData *) amg)[0];
+
+         result = &results[num_results++];
+         BenchRun(comm, "rap", BenchRAP, BenchProductReset, &pd, warmup, reps, result);
+
+         /* A*P, then P^T*(A*P) row by row */
+         AP = hypre_ParCSRMatMat(A, pd.P);
+         BenchRowSizes(pd.P, &P_sizes);
+         BenchRowSizes(AP, &AP_sizes);
+         for (i = 0; i < hypre_ParCSRMatrixNumRows(A); i++)
+         {
+            mults += (HYPRE_Real) P_sizes[i] * (HYPRE_Real) AP_sizes[i];
+         }
+         hypre_MPI_Allreduce(&mults, &global_mults, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+         result -> flops = 2.0 * (BenchMultCount(A, pd.P) + global_mults);
+         result -> bytes = (nnz_A + 2.0 * BenchRowSizes(pd.P, NULL) + BenchRowSizes(pd.C, NULL)) *
+                           (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int));
+         result -> memory_bound = 1;
+
+         hypre_TFree(P_sizes, HYPRE_MEMORY_HOST);
+         hypre_TFree(AP_sizes, HYPRE_MEMORY_HOST);
+         hypre_ParCSRMatrixDestroy(AP);
+         BenchProductReset(&pd);
+         pd.P = NULL;
+      }
+      else if (myid == 0)
+      {
+         hypre_printf("    rap: problem too small for a coarse level, skipped\n");
+      }
+
+      HYPRE_BoomerAMGDestroy(amg);
+   }
+
+   /*-----------------------------------------------------------
+    * Relaxation: one sweep of each type with u <- u + M^{-1}(f - Au)
+    *-----------------------------------------------------------*/
+
+   if (run_relax)
+   {
+      RelaxData rd;
+
+      rd.A = A;
+      rd.f = x;
+      rd.u = y;
+      rd.v = v;
+      rd.z = z;
+
+      for (i = 0; i < num_relax; i++)
+      {
+         rd.relax_type = relax_types[i];
+         rd.l1_norms = NULL;
+         hypre_BoomerAMGRelaxComputeL1Norms(A, rd.relax_type, 0, 0, NULL, &rd.l1_norms);
+         hypre_ParVectorSetConstantValues(y, 0.0);
+
+         hypre_sprintf(name, "relax_%d", rd.relax_type);
+         result = &results[num_results++];
+         BenchRun(comm, name, BenchRelax, NULL, &rd, warmup, reps, result);
+
+         /* two passes over A for the symmetric variants */
+         BenchSpMVWork(A, (rd.relax_type == 6 || rd.relax_type == 8 ||
+                           rd.relax_type == 12 || rd.relax_type == 25) ? 2 : 1,
+                       &flops, &bytes);
+         result -> flops = flops;
+         result -> bytes = bytes;
+         result -> memory_bound = 1;
+
+         hypre_TFree(rd.l1_norms, hypre_ParCSRMatrixMemoryLocation(A));
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Struct matvec
+    *-----------------------------------------------------------*/
+
+   if (run_struct)
+   {
+      StructData sd;
+      HYPRE_Int  stencil_size = (problem == 1) ? 27 : 7;
+      HYPRE_Real num_points = (HYPRE_Real) nx * (HYPRE_Real) ny * (HYPRE_Real) nz;
+
+      BenchBuildStruct(comm, nx, ny, nz, P, Q, R, p, q, r, stencil_size,
+                       &sd.A, &sd.x, &sd.y);
+
+      hypre_sprintf(name, "struct_matvec_%dpt", stencil_size);
+      result = &results[num_results++];
+      BenchRun(comm, name, BenchStructMatvec, NULL, &sd, warmup, reps, result);
+      result -> flops = 2.0 * stencil_size * num_points;
+      result -> bytes = (stencil_size + 2.0) * num_points * (HYPRE_Real) sizeof(HYPRE_Complex);
+      result -> memory_bound = 1;
+
+      HYPRE_StructMatrixDestroy(sd.A);
+      HYPRE_StructVectorDestroy(sd.x);
+      HYPRE_StructVectorDestroy(sd.y);
+   }
+
+   /*-----------------------------------------------------------
+    * Halo exchange of the matvec communication package
+    *-----------------------------------------------------------*/
+
+   if (run_comm)
+   {
+      CommData             cd;
+      hypre_ParCSRCommPkg *comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+      HYPRE_Int            num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      HYPRE_Int            num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      HYPRE_Int            send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      HYPRE_Int            recv_size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+      HYPRE_Real           work[2], global_work[2];
+
+      cd.comm_pkg  = comm_pkg;
+      cd.send_data = hypre_CTAlloc(HYPRE_Complex, send_size, HYPRE_MEMORY_HOST);
+      cd.recv_data = hypre_CTAlloc(HYPRE_Complex, recv_size, HYPRE_MEMORY_HOST);
+
+      result = &results[num_results++];
+      BenchRun(comm, "halo_exchange", BenchExchange, NULL, &cd, warmup, reps, result);
+
+      /* bytes sent and received, as in the profiler */
+      work[0] = (HYPRE_Real) (num_sends + num_recvs);
+      work[1] = (HYPRE_Real) (send_size + recv_size) * (HYPRE_Real) sizeof(HYPRE_Complex);
+      hypre_MPI_Allreduce(work, global_work, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+      result -> messages = global_work[0];
+      result -> bytes    = global_work[1];
+
+      hypre_TFree(cd.send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(cd.recv_data, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------
+    * Print the results
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      BenchPrint(results, num_results, stream_bw);
+      hypre_printf("  STREAM triad: %.3f GB/s\n", stream_bw);
+
+      if (json_file)
+      {
+         BenchPrintJSON(json_file, problem_names[problem], nx, ny, nz, num_procs,
+                        stream_bw, results, num_results);
+      }
+      if (csv_file)
+      {
+         BenchPrintCSV(csv_file, results, num_results, stream_bw);
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   hypre_ParVectorDestroy(x);
+   hypre_ParVectorDestroy(y);
+   hypre_ParVectorDestroy(v);
+   hypre_ParVectorDestroy(z);
+   HYPRE_ParCSRMatrixDestroy(A);
+
+   HYPRE_Finalize();
+   hypre_MPI_Finalize();
+
+   return (0);
+}
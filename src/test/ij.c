@@ -132,9 +132,12 @@ main( hypre_int argc,
    HYPRE_Int           build_sfpt_arg_index;
    HYPRE_Int           build_cpt_arg_index;
    HYPRE_Int           num_components = 1;
+   HYPRE_Int           rhs_seed = 22775;
+   HYPRE_Int           print_comp_res = 0;
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pcg_pipelined = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           poutusr = 0; /* if user selects pout */
@@ -216,6 +219,9 @@ main( hypre_int argc,
    HYPRE_Int           test_ij = 0;
    HYPRE_Int           test_multivec = 0;
    HYPRE_Int           test_scaling = 0;
+   HYPRE_Int           test_plan = 0;
+   HYPRE_Int           test_sell = 0;
+   HYPRE_Int           test_bdiag = 0;
    HYPRE_Int           test_error = 0;
 
    const HYPRE_Real    dt_inf = DT_INF;
@@ -223,6 +229,12 @@ main( hypre_int argc,
 
    /* solve -Ax = b, for testing SND matrices */
    HYPRE_Int           negA = 0;
+   HYPRE_Int           spmv_sell_chunk_size = 0;
+   HYPRE_Int           spmv_sell_sigma = 1;
+   HYPRE_Int           spgemm_host_dense_ncols = -1;
+   HYPRE_Int           spgemm_host_hash_max = -1;
+   HYPRE_Int           persistent_comm = -1;
+   char                profile_prefix[256] = "";
 
    /* parameters for BoomerAMG */
    HYPRE_Real     A_drop_tol = 0.0;
@@ -273,6 +285,8 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    numeric_resetup = 0;
+   HYPRE_Int    float_hierarchy = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -344,6 +358,7 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 4;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -363,6 +378,7 @@ main( hypre_int argc,
    HYPRE_Int    print_system = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
+   HYPRE_Real   second_shift = 0.0;
    HYPRE_Int    benchmark = 0;
 
    /* begin lobpcg */
@@ -734,6 +750,21 @@ main( hypre_int argc,
          arg_index++;
          test_scaling = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-test_plan") == 0 )
+      {
+         arg_index++;
+         test_plan = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-test_sell") == 0 )
+      {
+         arg_index++;
+         test_sell = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-test_bdiag") == 0 )
+      {
+         arg_index++;
+         test_bdiag = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-test_error") == 0 )
       {
          arg_index++;
@@ -847,6 +878,11 @@ main( hypre_int argc,
          build_rhs_type      = 3;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsseed") == 0 )
+      {
+         arg_index++;
+         rhs_seed = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-xisone") == 0 )
       {
          arg_index++;
@@ -1481,11 +1517,38 @@ main( hypre_int argc,
          arg_index++;
          negA = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-spmv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_sell_chunk_size = atoi(argv[arg_index++]);
+         spmv_sell_sigma      = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spgemm_host") == 0 )
+      {
+         arg_index++;
+         spgemm_host_dense_ncols = atoi(argv[arg_index++]);
+         spgemm_host_hash_max    = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent_comm") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-profile") == 0 )
+      {
+         arg_index++;
+         hypre_sprintf(profile_prefix, "%s", argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-second_time") == 0 )
       {
          arg_index++;
          second_time = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-second_shift") == 0 )
+      {
+         arg_index++;
+         second_shift = (HYPRE_Real) atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-benchmark") == 0 )
       {
          arg_index++;
@@ -1544,7 +1607,8 @@ main( hypre_int argc,
    /* defaults for BoomerAMG */
    if (solver_id == 0 || solver_id == 1 || solver_id == 3 || solver_id == 5
        || solver_id == 9 || solver_id == 13 || solver_id == 14
-       || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 61
+       || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 53
+       || solver_id == 61
        || solver_id == 16
        || solver_id == 70 || solver_id == 71 || solver_id == 72
        || solver_id == 90 || solver_id == 91)
@@ -1601,6 +1665,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-s_step") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1818,6 +1887,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -2007,6 +2081,16 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-numeric_resetup") == 0 )
+      {
+         arg_index++;
+         numeric_resetup = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-float_hierarchy") == 0 )
+      {
+         arg_index++;
+         float_hierarchy = 1;
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -2029,6 +2113,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-print_comp_res") == 0 )
+      {
+         arg_index++;
+         print_comp_res = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -2175,6 +2264,12 @@ main( hypre_int argc,
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
+         hypre_printf("  -spmv_sell <C> <sigma> : use SELL-C-sigma layout for host SpMV\n");
+         hypre_printf("  -test_sell             : check SpMV after in-place value changes of A\n");
+         hypre_printf("  -test_bdiag <bs>       : check the cached inverses of the diagonal blocks of A\n");
+         hypre_printf("  -spgemm_host <n> <h>   : host SpGEMM accumulator thresholds (dense ncols, hash max)\n");
+         hypre_printf("  -persistent_comm <p>   : ParCSR halo exchange with persistent requests (default 1)\n");
+         hypre_printf("  -profile <prefix>      : write per-level setup/solve profile to <prefix>.*.json\n");
          hypre_printf("\n");
          hypre_printf("  -rbm <val> <filename>  : rigid body mode vectors\n");
          hypre_printf("  -nc <val>              : number of components of a vector (multivector)\n");
@@ -2189,6 +2284,8 @@ main( hypre_int argc,
          hypre_printf("  -SFfromonefile          : ");
          hypre_printf("list of isolated F points from a single file\n");
          hypre_printf("  -rhsrand               : rhs is random vector\n");
+         hypre_printf("  -rhsseed <val>         : seed of -rhsrand (default 22775), incremented\n");
+         hypre_printf("                         :    for each further vector component\n");
          hypre_printf("  -rhsisone              : rhs is vector with unit coefficients (default)\n");
          hypre_printf("  -xisone                : solution of all ones\n");
          hypre_printf("  -rhszero               : rhs is zero vector\n");
@@ -2226,6 +2323,7 @@ main( hypre_int argc,
          hypre_printf("       45=Euclid-BICGSTAB 46=Euclid-COGMRES\n");
          hypre_printf("       47=Euclid-FlexGMRES\n");
          hypre_printf("       50=DS-LGMRES       51=AMG-LGMRES     \n");
+         hypre_printf("       52=DS-CAGMRES      53=AMG-CAGMRES    \n");
          hypre_printf("       60=DS-FlexGMRES    61=AMG-FlexGMRES  \n");
          hypre_printf("       70=MGR             71=MGR-PCG  \n");
          hypre_printf("       72=MGR-FlexGMRES   73=MGR-BICGSTAB  \n");
@@ -2297,6 +2395,8 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       24=Multicolor hybrid Gauss-Seidel (thread-count independent)  \n");
+         hypre_printf("       25=Multicolor hybrid symmetric Gauss-Seidel (thread-count independent)  \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
@@ -2335,6 +2435,9 @@ main( hypre_int argc,
          hypre_printf("  -jtr  <val>            : set truncation threshold for Jacobi interpolation = val \n");
          hypre_printf("  -Ssw  <val>            : set S-commpkg-switch = val \n");
          hypre_printf("  -mxrs <val>            : set AMG maximum row sum threshold for dependency weakening \n");
+         hypre_printf("  -numeric_resetup       : AMG setup with -second_time only updates values\n");
+         hypre_printf("  -second_shift <val>    : add val to the diagonal of A before the second AMG setup\n");
+         hypre_printf("  -float_hierarchy       : store AMG coarse operators and P/R in single precision\n");
          hypre_printf("  -nf <val>              : set number of functions for systems AMG\n");
          hypre_printf("  -numsamp <val>         : set number of sample vectors for GSMG\n");
 
@@ -2349,10 +2452,12 @@ main( hypre_int argc,
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
+         hypre_printf("  -s_step <val>          : block size of s-step GMRES (CAGMRES)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
+         hypre_printf("  -pipelined             : use pipelined PCG (one reduction per iteration)\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
@@ -2379,6 +2484,7 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -print_comp_res        : print the relative residual of each vector component\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2571,6 +2677,31 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* SELL-C-sigma layout for host SpMV */
+   if (spmv_sell_chunk_size > 0)
+   {
+      ierr = HYPRE_SetSpMVSellCSigma(spmv_sell_chunk_size, spmv_sell_sigma); hypre_assert(ierr == 0);
+   }
+
+   /* host SpGEMM row accumulators */
+   if (spgemm_host_dense_ncols >= 0)
+   {
+      ierr = HYPRE_SetSpGemmHostAccumulator(spgemm_host_dense_ncols, spgemm_host_hash_max);
+      hypre_assert(ierr == 0);
+   }
+
+   /* persistent requests in the ParCSR halo exchange */
+   if (persistent_comm >= 0)
+   {
+      ierr = HYPRE_SetParCSRPersistentComm(persistent_comm); hypre_assert(ierr == 0);
+   }
+
+   /* per-level setup/solve profiler */
+   if (profile_prefix[0])
+   {
+      ierr = HYPRE_SetProfiling(1); hypre_assert(ierr == 0);
+   }
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -3237,10 +3368,36 @@ main( hypre_int argc,
          "should" modify coefficients of ij_x by using functions
          HYPRE_IJVectorSetValues or HYPRE_IJVectorAddToValues */
 
-      HYPRE_ParVectorSetRandomValues(b, 22775);
-      HYPRE_ParVectorInnerProd(b, b, &norm);
-      norm = 1. / hypre_sqrt(norm);
-      ierr = HYPRE_ParVectorScale(norm, b);
+      if (num_components == 1)
+      {
+         HYPRE_ParVectorSetRandomValues(b, rhs_seed);
+         HYPRE_ParVectorInnerProd(b, b, &norm);
+         norm = 1. / hypre_sqrt(norm);
+         ierr = HYPRE_ParVectorScale(norm, b);
+      }
+      else
+      {
+         /* component c is the vector of a single component run with
+            -rhsseed rhs_seed+c */
+         HYPRE_ParVector b_c;
+
+         HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(b),
+                               hypre_ParVectorPartitioning(b), &b_c);
+         HYPRE_ParVectorInitialize(b_c);
+         for (c = 0; c < num_components; c++)
+         {
+            HYPRE_ParVectorSetRandomValues(b_c, rhs_seed + c);
+            HYPRE_ParVectorInnerProd(b_c, b_c, &norm);
+            norm = 1. / hypre_sqrt(norm);
+            HYPRE_ParVectorScale(norm, b_c);
+
+            HYPRE_IJVectorSetComponent(ij_b, c);
+            HYPRE_IJVectorSetValues(ij_b, local_num_rows, NULL,
+                                    hypre_VectorData(hypre_ParVectorLocalVector(b_c)));
+         }
+         HYPRE_IJVectorSetComponent(ij_b, 0);
+         HYPRE_ParVectorDestroy(b_c);
+      }
 
       /* Initial guess */
       HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
@@ -3916,6 +4073,213 @@ main( hypre_int argc,
       hypre_ClearTiming();
    }
 
+   /*-----------------------------------------------------------
+    * Test product plans: recompute A*A, A^T*A and A^T*A*A for
+    * new values of A and compare with the full products
+    *-----------------------------------------------------------*/
+
+   if (test_plan)
+   {
+      hypre_ParCSRMatrix      *A_h;
+      hypre_ParCSRMatrix      *C[3], *D[3], *E;
+      hypre_ParCSRMatMatPlan  *mm_plan  = NULL;
+      hypre_ParCSRTMatMatPlan *tmm_plan = NULL;
+      hypre_ParCSRRAPPlan     *rap_plan = NULL;
+      hypre_CSRMatrix         *A_h_diag, *A_h_offd;
+      hypre_ParVector         *x_h, *y_C, *y_D;
+      HYPRE_Real               fnorm, fnorm0;
+      const char              *names[3] = {"A*A", "A^T*A", "A^T*A*A"};
+
+      A_h = hypre_ParCSRMatrixClone_v2(parcsr_A, 1, HYPRE_MEMORY_HOST);
+
+      C[0] = hypre_ParCSRMatMatSetup(A_h, A_h, &mm_plan);
+      C[1] = hypre_ParCSRTMatMatSetup(A_h, A_h, &tmm_plan);
+      C[2] = hypre_ParCSRMatrixRAPKTSetup(A_h, A_h, A_h, &rap_plan);
+
+      /* a product with the old values, so that SpMV data of C[0] is created */
+      x_h = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A_h),
+                                  hypre_ParCSRMatrixColStarts(A_h));
+      y_C = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      y_D = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      hypre_ParVectorInitialize_v2(x_h, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_C, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_D, HYPRE_MEMORY_HOST);
+      hypre_ParVectorSetRandomValues(x_h, 1);
+      hypre_ParCSRMatrixMatvec(1.0, C[0], x_h, 0.0, y_C);
+
+      /* change the values, but not the pattern, of A */
+      A_h_diag = hypre_ParCSRMatrixDiag(A_h);
+      A_h_offd = hypre_ParCSRMatrixOffd(A_h);
+      for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_h_diag); i++)
+      {
+         hypre_CSRMatrixData(A_h_diag)[i] *= 1.0 + 0.1 * (HYPRE_Real) (i % 7);
+      }
+      for (i = 0; i < hypre_CSRMatrixNumNonzeros(A_h_offd); i++)
+      {
+         hypre_CSRMatrixData(A_h_offd)[i] *= 1.0 + 0.1 * (HYPRE_Real) (i % 5);
+      }
+
+      hypre_ParCSRMatMatNumeric(mm_plan, A_h, A_h, C[0]);
+      hypre_ParCSRTMatMatNumeric(tmm_plan, A_h, A_h, C[1]);
+      hypre_ParCSRMatrixRAPKTNumeric(rap_plan, A_h, A_h, A_h, C[2]);
+
+      D[0] = hypre_ParCSRMatMat(A_h, A_h);
+      D[1] = hypre_ParCSRTMatMat(A_h, A_h);
+      D[2] = hypre_ParCSRMatrixRAPKT(A_h, A_h, A_h, 0);
+
+      /* y_C = C[0] * x with the new values */
+      hypre_ParCSRMatrixMatvec(1.0, C[0], x_h, 0.0, y_C);
+      hypre_ParCSRMatrixMatvec(1.0, D[0], x_h, 0.0, y_D);
+      hypre_ParVectorAxpy(-1.0, y_D, y_C);
+      fnorm  = hypre_sqrt(hypre_ParVectorInnerProd(y_C, y_C));
+      fnorm0 = hypre_sqrt(hypre_ParVectorInnerProd(y_D, y_D));
+      if (myid == 0)
+      {
+         hypre_printf("Product plan %s * x: relative error = %e\n", names[0],
+                      fnorm0 > 0.0 ? fnorm / fnorm0 : fnorm);
+      }
+
+      for (i = 0; i < 3; i++)
+      {
+         hypre_ParCSRMatrixAdd(1.0, C[i], -1.0, D[i], &E);
+         fnorm  = hypre_ParCSRMatrixFnorm(E);
+         fnorm0 = hypre_ParCSRMatrixFnorm(D[i]);
+         if (myid == 0)
+         {
+            hypre_printf("Product plan %s: relative error = %e\n", names[i],
+                         fnorm0 > 0.0 ? fnorm / fnorm0 : fnorm);
+         }
+         hypre_ParCSRMatrixDestroy(E);
+         hypre_ParCSRMatrixDestroy(C[i]);
+         hypre_ParCSRMatrixDestroy(D[i]);
+      }
+
+      hypre_ParCSRMatMatPlanDestroy(mm_plan);
+      hypre_ParCSRTMatMatPlanDestroy(tmm_plan);
+      hypre_ParCSRRAPPlanDestroy(rap_plan);
+      hypre_ParCSRMatrixDestroy(A_h);
+      hypre_ParVectorDestroy(x_h);
+      hypre_ParVectorDestroy(y_C);
+      hypre_ParVectorDestroy(y_D);
+   }
+
+   /*-----------------------------------------------------------
+    * Test SpMV after in-place value changes: a cached SpMV layout
+    * of A (e.g., SELL-C-sigma) must not keep the old values
+    *-----------------------------------------------------------*/
+
+   if (test_sell)
+   {
+      hypre_ParCSRMatrix *A_h;
+      hypre_ParVector    *x_h, *y_0, *y_1;
+      HYPRE_Real          fnorm, fnorm0;
+
+      A_h = hypre_ParCSRMatrixClone_v2(parcsr_A, 1, HYPRE_MEMORY_HOST);
+      x_h = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A_h),
+                                  hypre_ParCSRMatrixColStarts(A_h));
+      y_0 = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      y_1 = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      hypre_ParVectorInitialize_v2(x_h, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_0, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_1, HYPRE_MEMORY_HOST);
+      hypre_ParVectorSetRandomValues(x_h, 1);
+
+      /* y_0 = A*x with the old values, then y_1 = (2A)*x */
+      hypre_ParCSRMatrixMatvec(1.0, A_h, x_h, 0.0, y_0);
+      hypre_ParCSRMatrixScale(A_h, 2.0);
+      hypre_ParCSRMatrixMatvec(1.0, A_h, x_h, 0.0, y_1);
+      hypre_ParVectorAxpy(-2.0, y_0, y_1);
+      fnorm  = hypre_sqrt(hypre_ParVectorInnerProd(y_1, y_1));
+      fnorm0 = 2.0 * hypre_sqrt(hypre_ParVectorInnerProd(y_0, y_0));
+      if (myid == 0)
+      {
+         hypre_printf("SpMV after scaling: relative error = %e\n",
+                      fnorm0 > 0.0 ? fnorm / fnorm0 : fnorm);
+      }
+
+      /* y_1 = A*x with all values of A set to one, then y_0 = (A/2)*x */
+      hypre_ParCSRMatrixSetConstantValues(A_h, 1.0);
+      hypre_ParCSRMatrixMatvec(1.0, A_h, x_h, 0.0, y_1);
+      hypre_ParCSRMatrixScale(A_h, 0.5);
+      hypre_ParCSRMatrixMatvec(1.0, A_h, x_h, 0.0, y_0);
+      hypre_ParVectorAxpy(-2.0, y_0, y_1);
+      fnorm  = hypre_sqrt(hypre_ParVectorInnerProd(y_1, y_1));
+      fnorm0 = 2.0 * hypre_sqrt(hypre_ParVectorInnerProd(y_0, y_0));
+      if (myid == 0)
+      {
+         hypre_printf("SpMV after constant values: relative error = %e\n",
+                      fnorm0 > 0.0 ? fnorm / fnorm0 : fnorm);
+      }
+
+      hypre_ParCSRMatrixDestroy(A_h);
+      hypre_ParVectorDestroy(x_h);
+      hypre_ParVectorDestroy(y_0);
+      hypre_ParVectorDestroy(y_1);
+   }
+
+   /*-----------------------------------------------------------
+    * Test block diagonal scaling: B^{-1}(A*x) with the inverses of
+    * the diagonal blocks B cached in A must match (B^{-1}A)*x
+    *-----------------------------------------------------------*/
+
+   if (test_bdiag > 0)
+   {
+      hypre_ParCSRMatrix *A_h, *As;
+      hypre_ParVector    *x_h, *z_h, *y_0, *y_1;
+      HYPRE_Real          fnorm, fnorm0;
+
+      A_h = hypre_ParCSRMatrixClone_v2(parcsr_A, 1, HYPRE_MEMORY_HOST);
+      x_h = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A_h),
+                                  hypre_ParCSRMatrixColStarts(A_h));
+      z_h = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      y_0 = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_h),
+                                  hypre_ParCSRMatrixRowStarts(A_h));
+      hypre_ParVectorInitialize_v2(x_h, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(z_h, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(y_0, HYPRE_MEMORY_HOST);
+      hypre_ParVectorSetRandomValues(x_h, 1);
+
+      /* the external rows of blocks straddling a process boundary are
+         fetched through the assumed partition */
+      if (!hypre_ParCSRMatrixAssumedPartition(A_h))
+      {
+         hypre_ParCSRMatrixCreateAssumedPartition(A_h);
+      }
+
+      /* computes the inverses, keeps them in A_h and scales the rows */
+      hypre_ParcsrBdiagInvScal(A_h, test_bdiag, &As);
+      if (!hypre_ParCSRMatrixCommPkg(As))
+      {
+         hypre_MatvecCommPkgCreate(As);
+      }
+      hypre_ParCSRMatrixMatvec(1.0, As, x_h, 0.0, y_0);
+
+      /* applies the kept inverses */
+      hypre_ParCSRMatrixMatvec(1.0, A_h, x_h, 0.0, z_h);
+      hypre_ParvecBdiagInvScal(z_h, test_bdiag, &y_1, A_h);
+
+      hypre_ParVectorAxpy(-1.0, y_0, y_1);
+      fnorm  = hypre_sqrt(hypre_ParVectorInnerProd(y_1, y_1));
+      fnorm0 = hypre_sqrt(hypre_ParVectorInnerProd(y_0, y_0));
+      if (myid == 0)
+      {
+         hypre_printf("Block diagonal inverse: relative error = %e\n",
+                      fnorm0 > 0.0 ? fnorm / fnorm0 : fnorm);
+      }
+
+      hypre_ParCSRMatrixDestroy(A_h);
+      hypre_ParCSRMatrixDestroy(As);
+      hypre_ParVectorDestroy(x_h);
+      hypre_ParVectorDestroy(z_h);
+      hypre_ParVectorDestroy(y_0);
+      hypre_ParVectorDestroy(y_1);
+   }
+
    /*-----------------------------------------------------------
     * Perform sparse matrix/vector multiplication
     *-----------------------------------------------------------*/
@@ -4267,6 +4631,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFloatHierarchy(amg_solver, float_hierarchy);
+      HYPRE_BoomerAMGSetNumericResetup(amg_solver, numeric_resetup);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4356,6 +4722,30 @@ main( hypre_int argc,
          cudaProfilerStart();
 #endif
 
+         /* change the values, but not the sparsity pattern, of A */
+         if (second_shift != 0.0)
+         {
+            hypre_CSRMatrix *A_diag;
+            HYPRE_Int       *A_diag_i;
+            HYPRE_Complex   *A_diag_data;
+
+            hypre_ParCSRMatrixMigrate(parcsr_A, HYPRE_MEMORY_HOST);
+            A_diag      = hypre_ParCSRMatrixDiag(parcsr_A);
+            A_diag_i    = hypre_CSRMatrixI(A_diag);
+            A_diag_data = hypre_CSRMatrixData(A_diag);
+
+            /* the diagonal entry is stored first in each row */
+            for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+            {
+               if (A_diag_i[i + 1] > A_diag_i[i])
+               {
+                  A_diag_data[A_diag_i[i]] += second_shift;
+               }
+            }
+            hypre_CSRMatrixSellDestroy(A_diag);
+            hypre_ParCSRMatrixMigrate(parcsr_A, hypre_HandleMemoryLocation(hypre_handle()));
+         }
+
          time_index = hypre_InitializeTiming("BoomerAMG/AMG-DD Setup2");
          hypre_BeginTiming(time_index);
 
@@ -4556,6 +4946,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFloatHierarchy(amg_solver, float_hierarchy);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4644,6 +5035,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pcg_pipelined);
 
       if (solver_id == 1)
       {
@@ -4757,6 +5149,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4941,6 +5334,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6435,6 +6829,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(amg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -6622,6 +7017,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6972,6 +7368,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7049,6 +7446,214 @@ main( hypre_int argc,
       }
    }
 
+   /*-----------------------------------------------------------
+    * Solve the system using CAGMRES
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 52 || solver_id == 53)
+   {
+      time_index = hypre_InitializeTiming("CAGMRES Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRCAGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_CAGMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_CAGMRESSetSStep(pcg_solver, s_step);
+      HYPRE_CAGMRESSetUnroll(pcg_solver, unroll);
+      HYPRE_CAGMRESSetMaxIter(pcg_solver, max_iter);
+      HYPRE_CAGMRESSetTol(pcg_solver, tol);
+      HYPRE_CAGMRESSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_CAGMRESSetLogging(pcg_solver, ioutdat);
+      HYPRE_CAGMRESSetPrintLevel(pcg_solver, ioutdat);
+
+      if (solver_id == 53)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) { hypre_printf("Solver: AMG-CAGMRES\n"); }
+
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetCGCIts(pcg_precond, cgcits);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetNumSamples(pcg_precond, gsmg_samples);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
+         HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
+         HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
+         HYPRE_BoomerAMGSetSCommPkgSwitch(pcg_precond, S_commpkg_switch);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
+         HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
+         HYPRE_BoomerAMGSetCRRate(pcg_precond, CR_rate);
+         HYPRE_BoomerAMGSetCRStrongTh(pcg_precond, CR_strong_th);
+         HYPRE_BoomerAMGSetCRUseCG(pcg_precond, CR_use_CG);
+         if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
+         if (relax_down > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         }
+         if (relax_up > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         }
+         if (relax_coarse > -1)
+         {
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         }
+         HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
+         HYPRE_BoomerAMGSetAddRelaxWt(pcg_precond, add_relax_wt);
+         HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
+         HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
+         HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
+         HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         if (level_w > -1)
+         {
+            HYPRE_BoomerAMGSetLevelRelaxWt(pcg_precond, relax_wt_level, level_w);
+         }
+         if (level_ow > -1)
+         {
+            HYPRE_BoomerAMGSetLevelOuterWt(pcg_precond, outer_wt_level, level_ow);
+         }
+         HYPRE_BoomerAMGSetSmoothType(pcg_precond, smooth_type);
+         HYPRE_BoomerAMGSetSmoothNumLevels(pcg_precond, smooth_num_levels);
+         HYPRE_BoomerAMGSetSmoothNumSweeps(pcg_precond, smooth_num_sweeps);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
+         HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
+         HYPRE_BoomerAMGSetAggPMaxElmts(pcg_precond, agg_P_max_elmts);
+         HYPRE_BoomerAMGSetAggP12MaxElmts(pcg_precond, agg_P12_max_elmts);
+         HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
+         HYPRE_BoomerAMGSetNodal(pcg_precond, nodal);
+         HYPRE_BoomerAMGSetNodalDiag(pcg_precond, nodal_diag);
+         HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
+         HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
+         HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
+         HYPRE_BoomerAMGSetSchwarzUseNonSymm(pcg_precond, use_nonsymm_schwarz);
+         HYPRE_BoomerAMGSetSchwarzRlxWeight(pcg_precond, schwarz_rlx_weight);
+         if (eu_level < 0) { eu_level = 0; }
+         HYPRE_BoomerAMGSetEuLevel(pcg_precond, eu_level);
+         HYPRE_BoomerAMGSetEuBJ(pcg_precond, eu_bj);
+         HYPRE_BoomerAMGSetEuSparseA(pcg_precond, eu_sparse_A);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+         {
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         }
+         HYPRE_BoomerAMGSetAdditive(pcg_precond, additive);
+         HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
+         HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
+         HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
+         HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
+         HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
+         HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
+         HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
+#ifdef HYPRE_USING_DSUPERLU
+         HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
+#endif
+         if (nongalerk_tol)
+         {
+            HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            for (i = 0; i < nongalerk_num_tol - 1; i++)
+            {
+               HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
+            }
+         }
+         HYPRE_CAGMRESSetMaxIter(pcg_solver, mg_max_iter);
+         HYPRE_CAGMRESSetPrecond(pcg_solver,
+                                (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                                (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSetup,
+                                pcg_precond);
+      }
+      else if (solver_id == 52)
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) { hypre_printf("Solver: DS-CAGMRES\n"); }
+         pcg_precond = NULL;
+
+         HYPRE_CAGMRESSetPrecond(pcg_solver,
+                                (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScale,
+                                (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup,
+                                pcg_precond);
+      }
+
+      HYPRE_CAGMRESGetPrecond(pcg_solver, &pcg_precond_gotten);
+      if (pcg_precond_gotten != pcg_precond)
+      {
+         hypre_printf("HYPRE_CAGMRESGetPrecond got bad precond\n");
+         return (-1);
+      }
+      else if (myid == 0)
+      {
+         hypre_printf("HYPRE_CAGMRESGetPrecond got good precond\n");
+      }
+      HYPRE_CAGMRESSetup
+      (pcg_solver, (HYPRE_Matrix)parcsr_M, (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("CAGMRES Solve");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_CAGMRESSolve
+      (pcg_solver, (HYPRE_Matrix)parcsr_A, (HYPRE_Vector)b, (HYPRE_Vector)x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_CAGMRESGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_CAGMRESGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+      HYPRE_ParCSRCAGMRESDestroy(pcg_solver);
+
+      if (solver_id == 53)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("CAGMRES Iterations = %d\n", num_iterations);
+         hypre_printf("Final CAGMRES Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
    /*-----------------------------------------------------------
     * Solve the system using FlexGMRES
     *-----------------------------------------------------------*/
@@ -7177,6 +7782,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7588,6 +8194,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7988,6 +8595,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8320,6 +8928,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFloatHierarchy(pcg_precond, float_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8694,6 +9303,41 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
 
+   /* ||b_c - A x_c|| / ||b_c|| for each component c */
+   if (print_comp_res && b && x)
+   {
+      HYPRE_ParVector  r;
+      HYPRE_Real      *rr, *bb;
+
+      r = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParVectorGlobalSize(b),
+                                     hypre_ParVectorPartitioning(b), num_components);
+      hypre_ParVectorInitialize_v2(r, hypre_ParVectorMemoryLocation(b));
+      rr = hypre_CTAlloc(HYPRE_Real, 2 * num_components, HYPRE_MEMORY_HOST);
+      bb = rr + num_components;
+
+      hypre_ParVectorCopy(b, r);
+      HYPRE_ParCSRMatrixMatvec(-1.0, parcsr_A, x, 1.0, r);
+      hypre_ParVectorComponentInnerProd(r, r, rr);
+      hypre_ParVectorComponentInnerProd(b, b, bb);
+      if (myid == 0)
+      {
+         for (c = 0; c < num_components; c++)
+         {
+            hypre_printf("Component %d: ||b - A x|| / ||b|| = %e\n", c,
+                         bb[c] > 0.0 ? hypre_sqrt(rr[c] / bb[c]) : hypre_sqrt(rr[c]));
+         }
+      }
+
+      hypre_TFree(rr, HYPRE_MEMORY_HOST);
+      HYPRE_ParVectorDestroy(r);
+   }
+
+   if (profile_prefix[0])
+   {
+      HYPRE_ProfilePrint(hypre_MPI_COMM_WORLD, profile_prefix);
+      HYPRE_SetProfiling(0);
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
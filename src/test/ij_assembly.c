@@ -67,6 +67,21 @@ HYPRE_Int test_SetAddSet(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HY
                          HYPRE_BigInt *rows, HYPRE_BigInt *cols,
                          HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
 
+HYPRE_Int test_Slots(MPI_Comm comm, HYPRE_BigInt ilower, HYPRE_BigInt iupper,
+                     HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks,
+                     HYPRE_BigInt *rows, HYPRE_BigInt *cols,
+                     HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
+
+HYPRE_Int test_Stream(MPI_Comm comm, HYPRE_BigInt ilower, HYPRE_BigInt iupper,
+                      HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks,
+                      HYPRE_BigInt *rows, HYPRE_BigInt *cols,
+                      HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
+
+HYPRE_Int test_AddOMP(MPI_Comm comm, HYPRE_BigInt ilower, HYPRE_BigInt iupper,
+                      HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks,
+                      HYPRE_BigInt *rows, HYPRE_BigInt *cols,
+                      HYPRE_Real *coefs, HYPRE_IJMatrix *ij_A_ptr);
+
 //#define CUDA_PROFILER
 
 hypre_int
@@ -107,6 +122,7 @@ main( hypre_int  argc,
    HYPRE_Int                 option;
    HYPRE_Int                 stencil;
    HYPRE_Int                 print_matrix;
+   HYPRE_Int                 num_threads;
 
    /* Initialize MPI */
    hypre_MPI_Init(&argc, &argv);
@@ -152,6 +168,7 @@ main( hypre_int  argc,
    option              = 1;
    nchunks             = 1;
    print_matrix        = 0;
+   num_threads         = 0;
    stencil             = 7;
 
    /*-----------------------------------------------------------
@@ -212,6 +229,11 @@ main( hypre_int  argc,
          arg_index++;
          nchunks = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-print") == 0 )
       {
          arg_index++;
@@ -255,9 +277,13 @@ main( hypre_int  argc,
          hypre_printf("             4 = SetSet\n");
          hypre_printf("             8 = AddSet\n");
          hypre_printf("            16 = SetAddSet\n");
+         hypre_printf("            32 = Slots (host only)\n");
+         hypre_printf("            64 = Stream (host only)\n");
+         hypre_printf("           128 = AddOMP (host only)\n");
          hypre_printf("      -option <val>          : interface option of Set/AddToValues\n");
          hypre_printf("             1 = CSR-like (default)\n");
          hypre_printf("             2 = COO-like\n");
+         hypre_printf("      -nthreads <val>        : number of OpenMP threads\n");
          hypre_printf("      -print                 : print matrices\n");
          hypre_printf("\n");
       }
@@ -293,6 +319,11 @@ main( hypre_int  argc,
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
 #endif
 
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+
    /*-----------------------------------------------------------
     * Build matrix entries
     *-----------------------------------------------------------*/
@@ -410,6 +441,45 @@ main( hypre_int  argc,
       HYPRE_IJMatrixDestroy(ij_A);
    }
 
+   /* Test re-assembly through value slots */
+   if (mode & 32)
+   {
+      test_Slots(comm, ilower, iupper, num_nonzeros, nchunks, h_rows2, h_cols, h_coefs, &ij_A);
+
+      checkMatrix(parcsr_ref, ij_A);
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_Slots");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+   }
+
+   /* Test streamed off-processor AddToValues */
+   if (mode & 64)
+   {
+      test_Stream(comm, ilower, iupper, num_nonzeros, nchunks, h_rows2, h_cols, h_coefs, &ij_A);
+
+      checkMatrix(parcsr_ref, ij_A);
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_Stream");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+   }
+
+   /* Test threaded AddToValues into the assembled pattern */
+   if (mode & 128)
+   {
+      test_AddOMP(comm, ilower, iupper, num_nonzeros, nchunks, h_rows2, h_cols, h_coefs, &ij_A);
+
+      checkMatrix(parcsr_ref, ij_A);
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_AddOMP");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+   }
+
    /*-----------------------------------------------------------
     * Free memory
     *-----------------------------------------------------------*/
@@ -1264,3 +1334,266 @@ test_SetAddSet(MPI_Comm             comm,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Re-assembles the matrix through a value slot map.  The slot list holds
+ * every entry twice, once as is and once transposed, so that part of it
+ * lives in rows of other processors (the test matrices are symmetric).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+test_Slots(MPI_Comm             comm,
+           HYPRE_BigInt         ilower,
+           HYPRE_BigInt         iupper,
+           HYPRE_BigInt         num_nonzeros,
+           HYPRE_Int            nchunks,
+           HYPRE_BigInt        *rows,             /* host, length of num_nonzeros */
+           HYPRE_BigInt        *cols,
+           HYPRE_Real          *coefs,
+           HYPRE_IJMatrix      *ij_A_ptr)
+{
+   HYPRE_IJMatrix  ij_A;
+   HYPRE_Int       i, k, chunk, chunk_size, npairs;
+   HYPRE_Int       time_index;
+   HYPRE_Int      *ones;
+   HYPRE_BigInt   *slot_rows;
+   HYPRE_BigInt   *slot_cols;
+   HYPRE_Real     *slot_coefs;
+
+   npairs     = 2 * (HYPRE_Int) num_nonzeros;
+   ones       = hypre_TAlloc(HYPRE_Int,    num_nonzeros, HYPRE_MEMORY_HOST);
+   slot_rows  = hypre_TAlloc(HYPRE_BigInt, npairs,       HYPRE_MEMORY_HOST);
+   slot_cols  = hypre_TAlloc(HYPRE_BigInt, npairs,       HYPRE_MEMORY_HOST);
+   slot_coefs = hypre_TAlloc(HYPRE_Real,   npairs,       HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      ones[i] = 1;
+      for (k = 0; k < 2; k++)
+      {
+         slot_rows[2 * i + k]  = k ? cols[i] : rows[i];
+         slot_cols[2 * i + k]  = k ? rows[i] : cols[i];
+         slot_coefs[2 * i + k] = 0.5 * coefs[i];
+      }
+   }
+
+   // Assemble the pattern once
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixSetValues(ij_A, (HYPRE_Int) num_nonzeros, ones, rows, cols, coefs);
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   time_index = hypre_InitializeTiming("Test Slots setup");
+   hypre_BeginTiming(time_index);
+
+   HYPRE_IJMatrixSetValueSlots(ij_A, npairs, slot_rows, slot_cols);
+
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test Slots setup", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Re-assemble from scratch through the slots
+   time_index = hypre_InitializeTiming("Test Slots");
+   hypre_BeginTiming(time_index);
+
+   HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+   chunk_size = (npairs + nchunks - 1) / nchunks;
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(chunk) HYPRE_SMP_SCHEDULE
+#endif
+   for (chunk = 0; chunk < nchunks; chunk++)
+   {
+      HYPRE_Int first = chunk * chunk_size;
+      HYPRE_Int size  = hypre_max(0, hypre_min(chunk_size, npairs - first));
+
+      HYPRE_IJMatrixAddToValueSlots(ij_A, first, size, &slot_coefs[first]);
+   }
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test Slots", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrix
+   *ij_A_ptr = ij_A;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Assembles the matrix twice with AddToValues and off-processor streaming,
+ * first into an empty matrix and then into the assembled pattern.  Every
+ * entry is added as two halves, once as is and once transposed, so that
+ * part of them live in rows of other processors (the test matrices are
+ * symmetric).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+test_Stream(MPI_Comm             comm,
+            HYPRE_BigInt         ilower,
+            HYPRE_BigInt         iupper,
+            HYPRE_BigInt         num_nonzeros,
+            HYPRE_Int            nchunks,
+            HYPRE_BigInt        *rows,             /* host, length of num_nonzeros */
+            HYPRE_BigInt        *cols,
+            HYPRE_Real          *coefs,
+            HYPRE_IJMatrix      *ij_A_ptr)
+{
+   HYPRE_IJMatrix  ij_A;
+   HYPRE_Int       i, k, chunk, chunk_size, nentries, pass;
+   HYPRE_Int       time_index;
+   HYPRE_Int      *ones;
+   HYPRE_BigInt   *add_rows;
+   HYPRE_BigInt   *add_cols;
+   HYPRE_Real     *add_coefs;
+
+   nentries  = 2 * (HYPRE_Int) num_nonzeros;
+   ones      = hypre_TAlloc(HYPRE_Int,    nentries, HYPRE_MEMORY_HOST);
+   add_rows  = hypre_TAlloc(HYPRE_BigInt, nentries, HYPRE_MEMORY_HOST);
+   add_cols  = hypre_TAlloc(HYPRE_BigInt, nentries, HYPRE_MEMORY_HOST);
+   add_coefs = hypre_TAlloc(HYPRE_Real,   nentries, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      for (k = 0; k < 2; k++)
+      {
+         ones[2 * i + k]      = 1;
+         add_rows[2 * i + k]  = k ? cols[i] : rows[i];
+         add_cols[2 * i + k]  = k ? rows[i] : cols[i];
+         add_coefs[2 * i + k] = 0.5 * coefs[i];
+      }
+   }
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixSetOffProcStreaming(ij_A, 256);
+
+   time_index = hypre_InitializeTiming("Test Stream");
+   hypre_BeginTiming(time_index);
+
+   chunk_size = (nentries + nchunks - 1) / nchunks;
+   for (pass = 0; pass < 2; pass++)
+   {
+      if (pass)
+      {
+         HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+      }
+      for (chunk = 0; chunk < nchunks; chunk++)
+      {
+         HYPRE_Int first = chunk * chunk_size;
+         HYPRE_Int size  = hypre_max(0, hypre_min(chunk_size, nentries - first));
+
+         HYPRE_IJMatrixAddToValues(ij_A, size, &ones[first], &add_rows[first],
+                                   &add_cols[first], &add_coefs[first]);
+      }
+      HYPRE_IJMatrixAssemble(ij_A);
+   }
+
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test Stream", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrix
+   *ij_A_ptr = ij_A;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Re-assembles the matrix with the OpenMP variant of AddToValues into the
+ * assembled pattern.  Every entry is added as two halves, first all of them
+ * as is and then all of them transposed, so that threads working on the two
+ * halves hit the same rows at the same time, and part of the transposed
+ * entries live on other processors (the test matrices are symmetric).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+test_AddOMP(MPI_Comm             comm,
+            HYPRE_BigInt         ilower,
+            HYPRE_BigInt         iupper,
+            HYPRE_BigInt         num_nonzeros,
+            HYPRE_Int            nchunks,
+            HYPRE_BigInt        *rows,             /* host, length of num_nonzeros */
+            HYPRE_BigInt        *cols,
+            HYPRE_Real          *coefs,
+            HYPRE_IJMatrix      *ij_A_ptr)
+{
+   HYPRE_IJMatrix  ij_A;
+   HYPRE_Int       i, k, chunk, chunk_size, nentries;
+   HYPRE_Int       time_index;
+   HYPRE_Int      *ones;
+   HYPRE_BigInt   *add_rows;
+   HYPRE_BigInt   *add_cols;
+   HYPRE_Real     *add_coefs;
+
+   nentries  = 2 * (HYPRE_Int) num_nonzeros;
+   ones      = hypre_TAlloc(HYPRE_Int,    nentries, HYPRE_MEMORY_HOST);
+   add_rows  = hypre_TAlloc(HYPRE_BigInt, nentries, HYPRE_MEMORY_HOST);
+   add_cols  = hypre_TAlloc(HYPRE_BigInt, nentries, HYPRE_MEMORY_HOST);
+   add_coefs = hypre_TAlloc(HYPRE_Real,   nentries, HYPRE_MEMORY_HOST);
+   for (k = 0; k < 2; k++)
+   {
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         ones[k * num_nonzeros + i]      = 1;
+         add_rows[k * num_nonzeros + i]  = k ? cols[i] : rows[i];
+         add_cols[k * num_nonzeros + i]  = k ? rows[i] : cols[i];
+         add_coefs[k * num_nonzeros + i] = 0.5 * coefs[i];
+      }
+   }
+
+   // Assemble the pattern once
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, ilower, iupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixSetValues(ij_A, (HYPRE_Int) num_nonzeros, ones, rows, cols, coefs);
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   // Re-assemble from scratch with the OpenMP variant
+   time_index = hypre_InitializeTiming("Test AddOMP");
+   hypre_BeginTiming(time_index);
+
+   HYPRE_IJMatrixSetOMPFlag(ij_A, 1);
+   HYPRE_IJMatrixSetConstantValues(ij_A, 0.0);
+   chunk_size = (nentries + nchunks - 1) / nchunks;
+   for (chunk = 0; chunk < nchunks; chunk++)
+   {
+      HYPRE_Int first = chunk * chunk_size;
+      HYPRE_Int size  = hypre_max(0, hypre_min(chunk_size, nentries - first));
+
+      HYPRE_IJMatrixAddToValues(ij_A, size, &ones[first], &add_rows[first],
+                                &add_cols[first], &add_coefs[first]);
+   }
+   HYPRE_IJMatrixAssemble(ij_A);
+
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test AddOMP", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(ones, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(add_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrix
+   *ij_A_ptr = ij_A;
+
+   return hypre_error_flag;
+}
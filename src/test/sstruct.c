@@ -2253,6 +2253,7 @@ PrintUsage( char *progname,
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("                        3 - BiCGSTAB (only ParCSRHybrid)\n");
       hypre_printf("  -recompute <bool>  : Recompute residual in PCG?\n");
+      hypre_printf("  -pipelined         : use pipelined PCG\n");
       hypre_printf("  -v <n_pre> <n_post>: SysPFMG and Struct- # of pre and post relax\n");
       hypre_printf("  -skip <s>          : SysPFMG and Struct- skip relaxation (0 or 1)\n");
       hypre_printf("  -rap <r>           : Struct- coarse grid operator type\n");
@@ -2391,6 +2392,7 @@ main( hypre_int argc,
    HYPRE_Int             jump;
    HYPRE_Int             solver_type;
    HYPRE_Int             recompute_res;
+   HYPRE_Int             pcg_pipelined;
 
    HYPRE_Real            cf_tol;
 
@@ -2491,6 +2493,7 @@ main( hypre_int argc,
    object_type = HYPRE_SSTRUCT;
    solver_type = 1;
    recompute_res = 0;   /* What should be the default here? */
+   pcg_pipelined = 0;
    cf_tol = 0.90;
    pooldist = 0;
    cycred_tdim = 0;
@@ -2750,6 +2753,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -4045,6 +4053,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver) solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver) solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) solver, recompute_res);
+      HYPRE_PCGSetPipelined( (HYPRE_Solver) solver, pcg_pipelined );
 
       if ((solver_id == 10) || (solver_id == 11))
       {
@@ -4569,6 +4578,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( par_solver, 0 );
       HYPRE_PCGSetPrintLevel( par_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver) par_solver, recompute_res);
+      HYPRE_PCGSetPipelined( (HYPRE_Solver) par_solver, pcg_pipelined );
 
       if (solver_id == 20)
       {
@@ -5498,6 +5508,7 @@ main( hypre_int argc,
       HYPRE_PCGSetRelChange( (HYPRE_Solver)struct_solver, 0 );
       HYPRE_PCGSetPrintLevel( (HYPRE_Solver)struct_solver, 1 );
       HYPRE_PCGSetRecomputeResidual( (HYPRE_Solver)struct_solver, recompute_res);
+      HYPRE_PCGSetPipelined( (HYPRE_Solver)struct_solver, pcg_pipelined );
 
       if (solver_id == 210)
       {
@@ -50,6 +50,20 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+typedef struct
+{
+   HYPRE_Int            dim;
+   HYPRE_Real           c[3];
+   HYPRE_Int            istart[3];
+   HYPRE_Int            iend[3];
+   HYPRE_Int            period[3];
+   hypre_StructStencil *stencil;
+
+} CoeffGenData;
+
+HYPRE_Int CoeffGen( void *data, HYPRE_Int *ilower, HYPRE_Int *iupper,
+                    HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values );
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -99,6 +113,14 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           rb_temporal_block;
+   HYPRE_Int           batch_lines;
+   HYPRE_Int           coeff_gen;
+   CoeffGenData        coeff_gen_data;
+   HYPRE_Int           boxloop_tile[3];
+   HYPRE_Int           first_touch;
+   HYPRE_Int           overlap;
+   HYPRE_Int           pcg_pipelined;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -223,6 +245,15 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   rb_temporal_block = 0;
+   batch_lines = 0;
+   coeff_gen = 0;
+   boxloop_tile[0] = 0;
+   boxloop_tile[1] = 0;
+   boxloop_tile[2] = 0;
+   first_touch = 0;
+   overlap = -1;
+   pcg_pipelined = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -417,6 +448,43 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rbtb") == 0 )
+      {
+         arg_index++;
+         rb_temporal_block = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-batch_lines") == 0 )
+      {
+         arg_index++;
+         batch_lines = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-coeff_gen") == 0 )
+      {
+         arg_index++;
+         coeff_gen = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-boxloop_tile") == 0 )
+      {
+         arg_index++;
+         boxloop_tile[0] = atoi(argv[arg_index++]);
+         boxloop_tile[1] = atoi(argv[arg_index++]);
+         boxloop_tile[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-first_touch") == 0 )
+      {
+         arg_index++;
+         first_touch = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-overlap") == 0 )
+      {
+         arg_index++;
+         overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -564,6 +632,16 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host BoxLoop tiling and first touch */
+   HYPRE_SetStructBoxLoopTiling(boxloop_tile[0], boxloop_tile[1], boxloop_tile[2]);
+   HYPRE_SetStructFirstTouch(first_touch);
+
+   /* communication/computation overlap (default: library build setting) */
+   if (overlap > -1)
+   {
+      HYPRE_SetStructOverlapCommComp(overlap);
+   }
+
    /* begin lobpcg */
 
    if ( solver_id == 0 && lobpcgFlag )
@@ -644,6 +722,14 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -rbtb <n>           : fuse n R/B half-sweeps per pass in PFMG\n");
+      hypre_printf("  -batch_lines        : batched Thomas line solves in SMG\n");
+      hypre_printf("  -coeff_gen          : generate matrix coefficients on the fly\n");
+      hypre_printf("                        (diffusion only, solvers 1, 11, 21, ...)\n");
+      hypre_printf("  -boxloop_tile <tx> <ty> <tz> : tile host BoxLoops (0: whole extent)\n");
+      hypre_printf("  -first_touch        : zero new struct data with the BoxLoop threads\n");
+      hypre_printf("  -overlap <o>        : overlap ghost exchange with interior work (1) or not (0)\n");
+      hypre_printf("  -pipelined          : use pipelined PCG\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -730,6 +816,16 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   if (coeff_gen && (conx != 0.0 || cony != 0 || conz != 0 || read_fromfile_param ||
+                     (solver_id % 10) != 1 || relax > 1))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: -coeff_gen ignored (PFMG with Jacobi on diffusion problems only)\n");
+      }
+      coeff_gen = 0;
+   }
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1118,6 +1214,23 @@ main( hypre_int argc,
             }
          }
 
+         if (coeff_gen && constant_coefficient == 0)
+         {
+            /* same matrix as below, evaluated on the fly */
+            coeff_gen_data.dim     = dim;
+            coeff_gen_data.c[0]    = cx;
+            coeff_gen_data.c[1]    = cy;
+            coeff_gen_data.c[2]    = cz;
+            coeff_gen_data.stencil = stencil;
+            for (i = 0; i < 3; i++)
+            {
+               coeff_gen_data.istart[i] = hypre_BoxIMinD(hypre_StructGridBoundingBox(grid), i);
+               coeff_gen_data.iend[i]   = hypre_BoxIMaxD(hypre_StructGridBoundingBox(grid), i);
+               coeff_gen_data.period[i] = periodic[i];
+            }
+            HYPRE_StructMatrixSetCoeffGenerator(A, CoeffGen, &coeff_gen_data);
+         }
+
          HYPRE_StructMatrixSetSymmetric(A, sym);
          HYPRE_StructMatrixInitialize(A);
 
@@ -1125,14 +1238,17 @@ main( hypre_int argc,
           * Fill in the matrix elements
           *-----------------------------------------------------------*/
 
-         AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
+         if (!hypre_StructMatrixCoeffFcn(A))
+         {
+            AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
 
-         /* Zero out stencils reaching to real boundary */
-         /* But in constant coefficient case, no special stencils! */
+            /* Zero out stencils reaching to real boundary */
+            /* But in constant coefficient case, no special stencils! */
 
-         if ( constant_coefficient == 0 )
-         {
-            SetStencilBndry(A, grid, periodic);
+            if ( constant_coefficient == 0 )
+            {
+               SetStencilBndry(A, grid, periodic);
+            }
          }
          HYPRE_StructMatrixAssemble(A);
          /*-----------------------------------------------------------
@@ -1413,6 +1529,7 @@ main( hypre_int argc,
          HYPRE_StructSMGSetNumPostRelax(solver, n_post);
          HYPRE_StructSMGSetPrintLevel(solver, 1);
          HYPRE_StructSMGSetLogging(solver, 1);
+         HYPRE_StructSMGSetBatchLines(solver, batch_lines);
 #if 0//defined(HYPRE_USING_CUDA)
          HYPRE_StructSMGSetDeviceLevel(solver, device_level);
 #endif
@@ -1486,6 +1603,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetRBTemporalBlock(solver, rb_temporal_block);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1629,6 +1747,7 @@ main( hypre_int argc,
          HYPRE_PCGSetTwoNorm( (HYPRE_Solver)solver, 1 );
          HYPRE_PCGSetRelChange( (HYPRE_Solver)solver, 0 );
          HYPRE_PCGSetPrintLevel( (HYPRE_Solver)solver, 1 );
+         HYPRE_PCGSetPipelined( (HYPRE_Solver)solver, pcg_pipelined );
 
          if (solver_id == 10)
          {
@@ -1642,6 +1761,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 
 #if 0//defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
@@ -1668,6 +1788,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1812,6 +1933,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
+               HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
                HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -1837,6 +1959,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2063,6 +2186,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
                HYPRE_StructSMGSetPrintLevel(precond, 0);
                HYPRE_StructSMGSetLogging(precond, 0);
+               HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
                HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2088,6 +2212,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2326,6 +2451,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2351,6 +2477,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2450,6 +2577,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2475,6 +2603,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2601,6 +2730,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2626,6 +2756,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2752,6 +2883,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2777,6 +2909,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2850,6 +2983,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
             HYPRE_StructSMGSetPrintLevel(precond, 0);
             HYPRE_StructSMGSetLogging(precond, 0);
+            HYPRE_StructSMGSetBatchLines(precond, batch_lines);
 #if 0 //defined(HYPRE_USING_CUDA)
             HYPRE_StructSMGSetDeviceLevel(precond, device_level);
 #endif
@@ -2875,6 +3009,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetRBTemporalBlock(precond, rb_temporal_block);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -3593,3 +3728,85 @@ SetStencilBndry(HYPRE_StructMatrix A,
 
    return ierr;
 }
+
+/*********************************************************************************
+ * Coefficient generator for the diffusion matrix set up by AddValuesMatrix and
+ * SetStencilBndry (used with -coeff_gen).  Couplings that cross a non-periodic
+ * domain boundary are zero.
+ *********************************************************************************/
+
+HYPRE_Int
+CoeffGen( void          *data,
+          HYPRE_Int     *ilower,
+          HYPRE_Int     *iupper,
+          HYPRE_Int      nentries,
+          HYPRE_Int     *entries,
+          HYPRE_Complex *values )
+{
+   CoeffGenData  *gen   = (CoeffGenData *) data;
+   hypre_Index   *shape = hypre_StructStencilShape(gen -> stencil);
+   HYPRE_Int      dim   = (gen -> dim);
+   HYPRE_Int      lo[3] = {0, 0, 0};
+   HYPRE_Int      hi[3] = {0, 0, 0};
+   HYPRE_Int      index[3];
+   HYPRE_Int      edir[HYPRE_MAXDIM * 2 + 1];
+   HYPRE_Int      eoff[HYPRE_MAXDIM * 2 + 1];
+   HYPRE_Real     evalue[HYPRE_MAXDIM * 2 + 1];
+   HYPRE_Real     center;
+   HYPRE_Int      d, e, m, k, off;
+
+   center = 0.0;
+   for (d = 0; d < dim; d++)
+   {
+      lo[d] = ilower[d];
+      hi[d] = iupper[d];
+      center += 2.0 * (gen -> c[d]);
+   }
+
+   /* direction (-1 for the diagonal), offset and value of each entry */
+   for (e = 0; e < nentries; e++)
+   {
+      edir[e]   = -1;
+      eoff[e]   = 0;
+      evalue[e] = center;
+      for (d = 0; d < dim; d++)
+      {
+         off = hypre_IndexD(shape[entries[e]], d);
+         if (off != 0)
+         {
+            edir[e]   = (gen -> period[d]) ? -1 : d;
+            eoff[e]   = off;
+            evalue[e] = -(gen -> c[d]);
+            break;
+         }
+      }
+   }
+
+   m = 0;
+   for (index[2] = lo[2]; index[2] <= hi[2]; index[2]++)
+   {
+      for (index[1] = lo[1]; index[1] <= hi[1]; index[1]++)
+      {
+         for (index[0] = lo[0]; index[0] <= hi[0]; index[0]++)
+         {
+            for (e = 0; e < nentries; e++)
+            {
+               values[m] = evalue[e];
+               d = edir[e];
+               if (d >= 0)
+               {
+                  k = index[d];
+                  if (k < (gen -> istart[d]) || k > (gen -> iend[d]) ||
+                      k + eoff[e] < (gen -> istart[d]) || k + eoff[e] > (gen -> iend[d]))
+                  {
+                     values[m] = 0.0;
+                  }
+               }
+               m++;
+            }
+         }
+      }
+   }
+
+   return 0;
+}
@@ -31,6 +31,7 @@ main( hypre_int argc,
    HYPRE_Int         time_index;
    HYPRE_Int         num_procs, myid;
    HYPRE_Int         dim;
+   HYPRE_Int         tile[3];
    HYPRE_Int         rep, reps, fail, sum;
    HYPRE_Int         size;
    hypre_Box        *x1_data_box, *x2_data_box, *x3_data_box, *x4_data_box;
@@ -72,6 +73,10 @@ main( hypre_int argc,
 
    reps = -1;
 
+   tile[0] = 0;
+   tile[1] = 0;
+   tile[2] = 0;
+
    /*-----------------------------------------------------------
     * Parse command line
     *-----------------------------------------------------------*/
@@ -104,6 +109,13 @@ main( hypre_int argc,
          arg_index++;
          reps = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         tile[0] = atoi(argv[arg_index++]);
+         tile[1] = atoi(argv[arg_index++]);
+         tile[2] = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -127,6 +139,7 @@ main( hypre_int argc,
       hypre_printf("  -n <nx> <ny> <nz>   : problem size per block\n");
       hypre_printf("  -P <Px> <Py> <Pz>   : processor topology\n");
       hypre_printf("  -d <dim>            : problem dimension (2 or 3)\n");
+      hypre_printf("  -tile <tx> <ty> <tz>: BoxLoop tile size (0: whole extent)\n");
       hypre_printf("\n");
    }
 
@@ -159,6 +172,8 @@ main( hypre_int argc,
     * Initialize some stuff
     *-----------------------------------------------------------*/
 
+   HYPRE_SetStructBoxLoopTiling(tile[0], tile[1], tile[2]);
+
    hypre_SetIndex3(start, 1, 1, 1);
    hypre_SetIndex3(loop_size, nx, ny, nz);
    hypre_SetIndex3(unit_stride, 1, 1, 1);
@@ -199,6 +214,7 @@ main( hypre_int argc,
       hypre_printf("  (nx, ny, nz)    = (%d, %d, %d)\n", nx, ny, nz);
       hypre_printf("  (Px, Py, Pz)    = (%d, %d, %d)\n", P,  Q,  R);
       hypre_printf("  dim             = %d\n", dim);
+      hypre_printf("  tile            = (%d, %d, %d)\n", tile[0], tile[1], tile[2]);
       hypre_printf("  reps            = %d\n", reps);
    }
 
@@ -31,6 +31,64 @@ HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_SetSpMVUseVendor(use_vendor);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVSellCSigma
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVSellCSigma( HYPRE_Int chunk_size,
+                         HYPRE_Int sigma )
+{
+   return hypre_SetSpMVSellCSigma(chunk_size, sigma);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpGemmHostAccumulator
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpGemmHostAccumulator( HYPRE_Int dense_ncols,
+                                HYPRE_Int hash_max )
+{
+   return hypre_SetSpGemmHostAccumulator(dense_ncols, hash_max);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructBoxLoopTiling
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructBoxLoopTiling( HYPRE_Int tile_x,
+                              HYPRE_Int tile_y,
+                              HYPRE_Int tile_z )
+{
+   return hypre_SetStructBoxLoopTiling(tile_x, tile_y, tile_z);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructFirstTouch
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructFirstTouch( HYPRE_Int first_touch )
+{
+   return hypre_SetStructFirstTouch(first_touch);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructOverlapCommComp
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructOverlapCommComp( HYPRE_Int overlap )
+{
+   return hypre_SetStructOverlapCommComp(overlap);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetParCSRPersistentComm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetParCSRPersistentComm( HYPRE_Int persistent )
+{
+   return hypre_SetParCSRPersistentComm(persistent);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
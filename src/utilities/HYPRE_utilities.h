@@ -275,11 +275,46 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 
 HYPRE_Int HYPRE_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
+/* Host SpMV with the SELL-C-sigma layout: chunk_size in [0, 32] (0 disables it),
+   sigma a multiple of chunk_size. The layout holds a copy of the matrix values */
+HYPRE_Int HYPRE_SetSpMVSellCSigma( HYPRE_Int chunk_size, HYPRE_Int sigma );
+/* Host SpGEMM: B with at most dense_ncols columns uses a dense accumulator
+   (default 65536); for wider B, rows of A with one nonzero copy the row of B
+   and rows whose product has at most hash_max entries use a hash table
+   (default 8192). The result does not depend on the thresholds */
+HYPRE_Int HYPRE_SetSpGemmHostAccumulator( HYPRE_Int dense_ncols, HYPRE_Int hash_max );
+/* Host struct BoxLoops: split each loop into tiles of tile_x x tile_y x tile_z
+   points (0: whole extent) distributed over threads. All zero disables tiling */
+HYPRE_Int HYPRE_SetStructBoxLoopTiling( HYPRE_Int tile_x, HYPRE_Int tile_y, HYPRE_Int tile_z );
+/* Zero new host struct matrix and vector data with the BoxLoop thread layout
+   (first touch placement on NUMA systems) instead of calloc */
+HYPRE_Int HYPRE_SetStructFirstTouch( HYPRE_Int first_touch );
+/* Split struct stencil computations (matvec, residual, restriction, relaxation)
+   into interior and boundary parts so that the interior is computed while the
+   ghost exchange is in flight. Applies to compute packages created afterwards */
+HYPRE_Int HYPRE_SetStructOverlapCommComp( HYPRE_Int overlap );
+/* Host ParCSR halo exchanges (matvec, transpose matvec, hybrid Gauss-Seidel)
+   reuse persistent MPI requests cached in the communication package (default 1).
+   0 creates and frees the requests on every exchange */
+HYPRE_Int HYPRE_SetParCSRPersistentComm( HYPRE_Int persistent );
 /* Backwards compatibility with HYPRE_SetSpGemmUseCusparse() */
 #define HYPRE_SetSpGemmUseCusparse(use_vendor) HYPRE_SetSpGemmUseVendor(use_vendor)
 HYPRE_Int HYPRE_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
+/*--------------------------------------------------------------------------
+ * HYPRE profiling
+ *--------------------------------------------------------------------------*/
+
+/* Record time, calls, flop and memory traffic estimates and ParCSR messages
+   per solver, level and phase of BoomerAMG, MGR, ILU, PCG and GMRES setup and
+   solve. Turning profiling off discards the counters */
+HYPRE_Int HYPRE_SetProfiling( HYPRE_Int on );
+HYPRE_Int HYPRE_ProfileClear( void );
+/* Write the counters of each rank to <prefix>.<rank>.json and their aggregate
+   over comm to <prefix>.summary.json (rank 0). Collective */
+HYPRE_Int HYPRE_ProfilePrint( MPI_Comm comm, const char *prefix );
+
 #ifdef __cplusplus
 }
 #endif
@@ -378,6 +378,7 @@ extern "C" {
 #define MPI_COMM_TYPE_SHARED hypre_MPI_COMM_TYPE_SHARED
 
 #define MPI_BOTTOM          hypre_MPI_BOTTOM
+#define MPI_IN_PLACE        hypre_MPI_IN_PLACE
 
 #define MPI_FLOAT           hypre_MPI_FLOAT
 #define MPI_DOUBLE          hypre_MPI_DOUBLE
@@ -452,6 +453,7 @@ extern "C" {
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
 #define MPI_Reduce          hypre_MPI_Reduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
 #define MPI_Type_contiguous hypre_MPI_Type_contiguous
@@ -493,6 +495,7 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_COMM_TYPE_SHARED 0
 
 #define  hypre_MPI_BOTTOM  0x0
+#define  hypre_MPI_IN_PLACE ((void *) -1)
 
 #define  hypre_MPI_FLOAT 0
 #define  hypre_MPI_DOUBLE 1
@@ -538,6 +541,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
+#define  hypre_MPI_IN_PLACE           MPI_IN_PLACE
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
 
@@ -653,6 +657,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -1361,6 +1368,124 @@ HYPRE_Int hypre_GetTiming( const char *heading, HYPRE_Real *wall_time_ptr, MPI_C
 
 #endif
 
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the per-level solver profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILE_HEADER
+#define hypre_PROFILE_HEADER
+
+/*--------------------------------------------------------------------------
+ * Solvers and phases recorded by the profiler
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ProfileSolver_enum
+{
+   HYPRE_PROFILE_BOOMERAMG = 0,
+   HYPRE_PROFILE_MGR,
+   HYPRE_PROFILE_ILU,
+   HYPRE_PROFILE_PCG,
+   HYPRE_PROFILE_GMRES,
+   HYPRE_PROFILE_NUM_SOLVERS
+} hypre_ProfileSolver;
+
+typedef enum hypre_ProfilePhase_enum
+{
+   /* setup */
+   HYPRE_PROFILE_SETUP = 0,        /* whole setup, level 0 */
+   HYPRE_PROFILE_STRENGTH,
+   HYPRE_PROFILE_COARSEN,
+   HYPRE_PROFILE_INTERP,           /* transfer operators */
+   HYPRE_PROFILE_RAP,
+   HYPRE_PROFILE_COARSE_SETUP,
+   HYPRE_PROFILE_FACTOR,
+   HYPRE_PROFILE_SMOOTHER_SETUP,
+
+   /* solve */
+   HYPRE_PROFILE_SOLVE,            /* whole solve, level 0 */
+   HYPRE_PROFILE_RELAX,
+   HYPRE_PROFILE_RESIDUAL,
+   HYPRE_PROFILE_RESTRICT,
+   HYPRE_PROFILE_INTERP_APPLY,
+   HYPRE_PROFILE_COARSE_SOLVE,
+   HYPRE_PROFILE_TRISOLVE,
+   HYPRE_PROFILE_MATVEC,
+   HYPRE_PROFILE_PRECOND,
+
+   HYPRE_PROFILE_NUM_PHASES
+} hypre_ProfilePhase;
+
+/* counters kept for every (solver, level, phase) */
+typedef enum hypre_ProfileCounter_enum
+{
+   HYPRE_PROFILE_TIME = 0,         /* wall time in seconds */
+   HYPRE_PROFILE_CALLS,
+   HYPRE_PROFILE_FLOPS,            /* estimate */
+   HYPRE_PROFILE_BYTES,            /* estimated memory traffic */
+   HYPRE_PROFILE_MESSAGES,         /* point-to-point messages posted */
+   HYPRE_PROFILE_MESSAGE_BYTES,    /* bytes sent and received */
+   HYPRE_PROFILE_NUM_COUNTERS
+} hypre_ProfileCounter;
+
+#define HYPRE_PROFILE_MAX_DEPTH 32
+
+/*--------------------------------------------------------------------------
+ * hypre_Profile:
+ *
+ * data holds the counters as [solver][level][phase][counter] for max_levels
+ * levels.  The open regions are kept on a stack of at most
+ * HYPRE_PROFILE_MAX_DEPTH entries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int    max_levels;
+   HYPRE_Real  *data;
+
+   HYPRE_Int    depth;
+   HYPRE_Int    solver[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Int    level[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Int    phase[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Real   start[HYPRE_PROFILE_MAX_DEPTH];
+
+} hypre_Profile;
+
+#define hypre_ProfileMaxLevels(profile)  ((profile) -> max_levels)
+#define hypre_ProfileData(profile)       ((profile) -> data)
+#define hypre_ProfileDepth(profile)      ((profile) -> depth)
+
+#define hypre_ProfileEntry(profile, s, l, p) \
+   (hypre_ProfileData(profile) + \
+    (((s) * hypre_ProfileMaxLevels(profile) + (l)) * HYPRE_PROFILE_NUM_PHASES + (p)) * \
+    HYPRE_PROFILE_NUM_COUNTERS)
+
+/* NULL unless profiling was turned on with HYPRE_SetProfiling */
+extern hypre_Profile *hypre_global_profile;
+
+#define hypre_ProfileActive() (hypre_global_profile != NULL)
+
+/*--------------------------------------------------------------------------
+ * Prototypes
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ProfileBegin( HYPRE_Int solver, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfileEnd( void );
+HYPRE_Int hypre_ProfileAddWork( HYPRE_Real flops, HYPRE_Real bytes );
+HYPRE_Int hypre_ProfileAddSpMV( HYPRE_Real nnz, HYPRE_Real num_rows, HYPRE_Real num_cols,
+                                HYPRE_Int num_vectors );
+HYPRE_Int hypre_ProfileAddComm( HYPRE_Int num_messages, HYPRE_Real num_bytes );
+
+#endif /* hypre_PROFILE_HEADER */
+
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1550,6 +1675,12 @@ extern "C++"
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+#define HYPRE_SELL_MAX_CHUNK_SIZE 32
+
+/* default thresholds of the host SpGEMM row accumulators */
+#define HYPRE_SPGEMM_HOST_DENSE_NCOLS 65536
+#define HYPRE_SPGEMM_HOST_HASH_MAX    8192
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
@@ -1565,6 +1696,25 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* host SpMV with the SELL-C-sigma layout (chunk size 0: use CSR) */
+   HYPRE_Int              spmv_sell_chunk_size;
+   HYPRE_Int              spmv_sell_sigma;
+
+   /* host SpGEMM: B with at most dense_ncols columns always uses the dense
+      marker array, wider B uses a hash table for rows bounded by hash_max */
+   HYPRE_Int              spgemm_host_dense_ncols;
+   HYPRE_Int              spgemm_host_hash_max;
+
+   /* host struct BoxLoop tiling (no tiling: split each loop by rows) */
+   HYPRE_Int              struct_boxloop_tiled;
+   HYPRE_Int              struct_boxloop_tile[3];
+   HYPRE_Int              struct_first_touch;
+   /* split struct computations into interior/boundary to overlap the ghost exchange */
+   HYPRE_Int              struct_overlap_comm_comp;
+
+   /* host ParCSR halo exchange with persistent MPI requests cached in the comm pkg */
+   HYPRE_Int              parcsr_persistent_comm;
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -1605,6 +1755,19 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
 
+#define hypre_HandleSpMVSellChunkSize(hypre_handle)              ((hypre_handle) -> spmv_sell_chunk_size)
+#define hypre_HandleSpMVSellSigma(hypre_handle)                  ((hypre_handle) -> spmv_sell_sigma)
+
+#define hypre_HandleSpGemmHostDenseNCols(hypre_handle)           ((hypre_handle) -> spgemm_host_dense_ncols)
+#define hypre_HandleSpGemmHostHashMax(hypre_handle)              ((hypre_handle) -> spgemm_host_hash_max)
+
+#define hypre_HandleStructBoxLoopTiled(hypre_handle)             ((hypre_handle) -> struct_boxloop_tiled)
+#define hypre_HandleStructBoxLoopTile(hypre_handle)              ((hypre_handle) -> struct_boxloop_tile)
+#define hypre_HandleStructFirstTouch(hypre_handle)               ((hypre_handle) -> struct_first_touch)
+#define hypre_HandleStructOverlapCommComp(hypre_handle)          ((hypre_handle) -> struct_overlap_comm_comp)
+
+#define hypre_HandleParCSRPersistentComm(hypre_handle)           ((hypre_handle) -> parcsr_persistent_comm)
+
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -2130,6 +2293,12 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVSellCSigma( HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int hypre_SetSpGemmHostAccumulator( HYPRE_Int dense_ncols, HYPRE_Int hash_max );
+HYPRE_Int hypre_SetStructBoxLoopTiling( HYPRE_Int tile_x, HYPRE_Int tile_y, HYPRE_Int tile_z );
+HYPRE_Int hypre_SetStructFirstTouch( HYPRE_Int first_touch );
+HYPRE_Int hypre_SetStructOverlapCommComp( HYPRE_Int overlap );
+HYPRE_Int hypre_SetParCSRPersistentComm( HYPRE_Int persistent );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );
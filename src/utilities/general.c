@@ -38,6 +38,15 @@ hypre_HandleCreate(void)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
 #endif
 
+#if defined(HYPRE_OVERLAP_COMM_COMP)
+   hypre_HandleStructOverlapCommComp(hypre_handle_) = 1;
+#endif
+
+   hypre_HandleParCSRPersistentComm(hypre_handle_) = 1;
+
+   hypre_HandleSpGemmHostDenseNCols(hypre_handle_) = HYPRE_SPGEMM_HOST_DENSE_NCOLS;
+   hypre_HandleSpGemmHostHashMax(hypre_handle_)    = HYPRE_SPGEMM_HOST_HASH_MAX;
+
 #if defined(HYPRE_USING_GPU)
    hypre_HandleDeviceData(hypre_handle_) = hypre_DeviceDataCreate();
    /* Gauss-Seidel: SpTrSV */
@@ -34,6 +34,112 @@ hypre_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_error_flag;
 }
 
+/* Host SpMV with the SELL-C-sigma layout */
+HYPRE_Int
+hypre_SetSpMVSellCSigma( HYPRE_Int chunk_size,
+                         HYPRE_Int sigma )
+{
+   if (chunk_size < 0 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (chunk_size > 0 && (sigma < chunk_size || sigma % chunk_size))
+   {
+      /* sigma must be a positive multiple of the chunk size */
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpMVSellChunkSize(hypre_handle()) = chunk_size;
+   hypre_HandleSpMVSellSigma(hypre_handle())     = sigma;
+
+   return hypre_error_flag;
+}
+
+/* Host SpGEMM row accumulators */
+HYPRE_Int
+hypre_SetSpGemmHostAccumulator( HYPRE_Int dense_ncols,
+                                HYPRE_Int hash_max )
+{
+   if (dense_ncols < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hash_max < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpGemmHostDenseNCols(hypre_handle()) = dense_ncols;
+   hypre_HandleSpGemmHostHashMax(hypre_handle())    = hash_max;
+
+   return hypre_error_flag;
+}
+
+/* Host struct BoxLoop tiling */
+HYPRE_Int
+hypre_SetStructBoxLoopTiling( HYPRE_Int tile_x,
+                              HYPRE_Int tile_y,
+                              HYPRE_Int tile_z )
+{
+   HYPRE_Int *tile = hypre_HandleStructBoxLoopTile(hypre_handle());
+
+   if (tile_x < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (tile_y < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (tile_z < 0)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   tile[0] = tile_x;
+   tile[1] = tile_y;
+   tile[2] = tile_z;
+   hypre_HandleStructBoxLoopTiled(hypre_handle()) = (tile_x || tile_y || tile_z);
+
+   return hypre_error_flag;
+}
+
+/* Host struct data first touch */
+HYPRE_Int
+hypre_SetStructFirstTouch( HYPRE_Int first_touch )
+{
+   hypre_HandleStructFirstTouch(hypre_handle()) = first_touch;
+
+   return hypre_error_flag;
+}
+
+/* Struct communication/computation overlap */
+HYPRE_Int
+hypre_SetStructOverlapCommComp( HYPRE_Int overlap )
+{
+   hypre_HandleStructOverlapCommComp(hypre_handle()) = overlap;
+
+   return hypre_error_flag;
+}
+
+/* ParCSR halo exchange with persistent requests */
+HYPRE_Int
+hypre_SetParCSRPersistentComm( HYPRE_Int persistent )
+{
+   hypre_HandleParCSRPersistentComm(hypre_handle()) = persistent;
+
+   return hypre_error_flag;
+}
+
 /* GPU SpGemm */
 HYPRE_Int
 hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor )
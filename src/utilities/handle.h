@@ -14,6 +14,12 @@
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+#define HYPRE_SELL_MAX_CHUNK_SIZE 32
+
+/* default thresholds of the host SpGEMM row accumulators */
+#define HYPRE_SPGEMM_HOST_DENSE_NCOLS 65536
+#define HYPRE_SPGEMM_HOST_HASH_MAX    8192
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
@@ -29,6 +35,25 @@ typedef struct
    HYPRE_Int              struct_comm_recv_buffer_size;
    HYPRE_Int              struct_comm_send_buffer_size;
 
+   /* host SpMV with the SELL-C-sigma layout (chunk size 0: use CSR) */
+   HYPRE_Int              spmv_sell_chunk_size;
+   HYPRE_Int              spmv_sell_sigma;
+
+   /* host SpGEMM: B with at most dense_ncols columns always uses the dense
+      marker array, wider B uses a hash table for rows bounded by hash_max */
+   HYPRE_Int              spgemm_host_dense_ncols;
+   HYPRE_Int              spgemm_host_hash_max;
+
+   /* host struct BoxLoop tiling (no tiling: split each loop by rows) */
+   HYPRE_Int              struct_boxloop_tiled;
+   HYPRE_Int              struct_boxloop_tile[3];
+   HYPRE_Int              struct_first_touch;
+   /* split struct computations into interior/boundary to overlap the ghost exchange */
+   HYPRE_Int              struct_overlap_comm_comp;
+
+   /* host ParCSR halo exchange with persistent MPI requests cached in the comm pkg */
+   HYPRE_Int              parcsr_persistent_comm;
+
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    HYPRE_Int              device_gs_method; /* device G-S options */
@@ -69,6 +94,19 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle)       ((hypre_handle) -> struct_comm_send_buffer_size)
 
+#define hypre_HandleSpMVSellChunkSize(hypre_handle)              ((hypre_handle) -> spmv_sell_chunk_size)
+#define hypre_HandleSpMVSellSigma(hypre_handle)                  ((hypre_handle) -> spmv_sell_sigma)
+
+#define hypre_HandleSpGemmHostDenseNCols(hypre_handle)           ((hypre_handle) -> spgemm_host_dense_ncols)
+#define hypre_HandleSpGemmHostHashMax(hypre_handle)              ((hypre_handle) -> spgemm_host_hash_max)
+
+#define hypre_HandleStructBoxLoopTiled(hypre_handle)             ((hypre_handle) -> struct_boxloop_tiled)
+#define hypre_HandleStructBoxLoopTile(hypre_handle)              ((hypre_handle) -> struct_boxloop_tile)
+#define hypre_HandleStructFirstTouch(hypre_handle)               ((hypre_handle) -> struct_first_touch)
+#define hypre_HandleStructOverlapCommComp(hypre_handle)          ((hypre_handle) -> struct_overlap_comm_comp)
+
+#define hypre_HandleParCSRPersistentComm(hypre_handle)           ((hypre_handle) -> parcsr_persistent_comm)
+
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
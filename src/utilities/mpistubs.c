@@ -531,6 +531,11 @@ hypre_MPI_Allreduce( void              *sendbuf,
 {
    HYPRE_Int i;
 
+   if (sendbuf == hypre_MPI_IN_PLACE)
+   {
+      return 0;
+   }
+
    switch (datatype)
    {
       case hypre_MPI_INT:
@@ -642,6 +647,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1277,6 +1295,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* No non-blocking collectives before MPI-3: complete the reduction now */
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -0,0 +1,454 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Per-level setup/solve profiler.
+ *
+ * Solvers open a region with hypre_ProfileBegin(solver, level, phase) and
+ * close it with hypre_ProfileEnd().  Regions nest and all counters are
+ * inclusive: the time, flops, memory traffic and messages of a region
+ * include those of the regions opened inside it.  Flops and memory traffic
+ * are estimates charged by the ParCSR matvecs and the relaxation sweeps,
+ * messages are counted by the ParCSR communication handles.  All routines
+ * return immediately when profiling is off.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+hypre_Profile *hypre_global_profile = NULL;
+
+static const char *hypre_profile_solver_names[HYPRE_PROFILE_NUM_SOLVERS] =
+{
+   "BoomerAMG", "MGR", "ILU", "PCG", "GMRES"
+};
+
+static const char *hypre_profile_phase_names[HYPRE_PROFILE_NUM_PHASES] =
+{
+   "setup", "strength", "coarsen", "interp", "rap", "coarse_setup", "factor",
+   "smoother_setup", "solve", "relax", "residual", "restrict", "interp_apply", "coarse_solve",
+   "trisolve", "matvec", "precond"
+};
+
+static const char *hypre_profile_counter_names[HYPRE_PROFILE_NUM_COUNTERS] =
+{
+   "time", "calls", "flops", "bytes", "messages", "message_bytes"
+};
+
+#define HYPRE_PROFILE_ENTRY_SIZE (HYPRE_PROFILE_NUM_PHASES * HYPRE_PROFILE_NUM_COUNTERS)
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileResize
+ *
+ * Grow the level dimension of the counter array to at least num_levels.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfileResize( hypre_Profile *profile,
+                     HYPRE_Int      num_levels )
+{
+   HYPRE_Int    old_max_levels = hypre_ProfileMaxLevels(profile);
+   HYPRE_Real  *old_data       = hypre_ProfileData(profile);
+   HYPRE_Int    max_levels     = hypre_max(2 * old_max_levels, num_levels);
+   HYPRE_Real  *data;
+   HYPRE_Int    s;
+
+   data = hypre_CTAlloc(HYPRE_Real, HYPRE_PROFILE_NUM_SOLVERS * max_levels *
+                        HYPRE_PROFILE_ENTRY_SIZE, HYPRE_MEMORY_HOST);
+   for (s = 0; s < HYPRE_PROFILE_NUM_SOLVERS && old_data; s++)
+   {
+      hypre_TMemcpy(data + s * max_levels * HYPRE_PROFILE_ENTRY_SIZE,
+                    old_data + s * old_max_levels * HYPRE_PROFILE_ENTRY_SIZE,
+                    HYPRE_Real, old_max_levels * HYPRE_PROFILE_ENTRY_SIZE,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(old_data, HYPRE_MEMORY_HOST);
+
+   hypre_ProfileMaxLevels(profile) = max_levels;
+   hypre_ProfileData(profile)      = data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileBegin
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileBegin( HYPRE_Int solver,
+                    HYPRE_Int level,
+                    HYPRE_Int phase )
+{
+   hypre_Profile *profile = hypre_global_profile;
+   HYPRE_Int      depth;
+
+   if (!profile)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Regions nested too deeply are counted but not recorded */
+   depth = hypre_ProfileDepth(profile)++;
+   if (depth >= HYPRE_PROFILE_MAX_DEPTH)
+   {
+      return hypre_error_flag;
+   }
+
+   level = hypre_max(level, 0);
+   if (level >= hypre_ProfileMaxLevels(profile))
+   {
+      hypre_ProfileResize(profile, level + 1);
+   }
+
+   profile -> solver[depth] = solver;
+   profile -> level[depth]  = level;
+   profile -> phase[depth]  = phase;
+   profile -> start[depth]  = hypre_MPI_Wtime();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileEnd
+ *
+ * Close the innermost region.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileEnd( void )
+{
+   hypre_Profile *profile = hypre_global_profile;
+   HYPRE_Real    *entry;
+   HYPRE_Int      depth;
+
+   if (!profile || hypre_ProfileDepth(profile) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   depth = --hypre_ProfileDepth(profile);
+   if (depth >= HYPRE_PROFILE_MAX_DEPTH)
+   {
+      return hypre_error_flag;
+   }
+
+   entry = hypre_ProfileEntry(profile, profile -> solver[depth],
+                              profile -> level[depth], profile -> phase[depth]);
+   entry[HYPRE_PROFILE_TIME]  += hypre_MPI_Wtime() - profile -> start[depth];
+   entry[HYPRE_PROFILE_CALLS] += 1.0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileAdd
+ *
+ * Add value to a counter of every open region, so that like times the
+ * counters of a region include the work of the regions nested inside it.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ProfileAdd( hypre_Profile *profile,
+                  HYPRE_Int      counter,
+                  HYPRE_Real     value )
+{
+   HYPRE_Int  depth = hypre_min(hypre_ProfileDepth(profile), HYPRE_PROFILE_MAX_DEPTH);
+   HYPRE_Int  i;
+
+   for (i = 0; i < depth; i++)
+   {
+      hypre_ProfileEntry(profile, profile -> solver[i], profile -> level[i],
+                         profile -> phase[i])[counter] += value;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileAddWork
+ *
+ * Charge flop and memory traffic estimates to the open regions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileAddWork( HYPRE_Real flops,
+                      HYPRE_Real bytes )
+{
+   hypre_Profile *profile = hypre_global_profile;
+
+   if (profile)
+   {
+      hypre_ProfileAdd(profile, HYPRE_PROFILE_FLOPS, flops);
+      hypre_ProfileAdd(profile, HYPRE_PROFILE_BYTES, bytes);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileAddSpMV
+ *
+ * hypre_ProfileAddWork for one CSR matrix-vector product (or a kernel with
+ * the same access pattern such as a relaxation sweep) with num_vectors
+ * vectors.  The memory traffic assumes the matrix is streamed once and each
+ * vector entry is touched once.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileAddSpMV( HYPRE_Real nnz,
+                      HYPRE_Real num_rows,
+                      HYPRE_Real num_cols,
+                      HYPRE_Int  num_vectors )
+{
+   HYPRE_Real flops;
+   HYPRE_Real bytes;
+
+   if (!hypre_ProfileActive())
+   {
+      return hypre_error_flag;
+   }
+
+   num_vectors = hypre_max(num_vectors, 1);
+   flops = 2.0 * nnz * (HYPRE_Real) num_vectors;
+   bytes = nnz * (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+           (num_rows + 1.0) * (HYPRE_Real) sizeof(HYPRE_Int) +
+           (num_cols + 2.0 * num_rows) * (HYPRE_Real) (num_vectors * sizeof(HYPRE_Complex));
+
+   return hypre_ProfileAddWork(flops, bytes);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ProfileAddComm
+ *
+ * Charge point-to-point messages to the open regions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProfileAddComm( HYPRE_Int  num_messages,
+                      HYPRE_Real num_bytes )
+{
+   hypre_Profile *profile = hypre_global_profile;
+
+   if (profile)
+   {
+      hypre_ProfileAdd(profile, HYPRE_PROFILE_MESSAGES, (HYPRE_Real) num_messages);
+      hypre_ProfileAdd(profile, HYPRE_PROFILE_MESSAGE_BYTES, num_bytes);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetProfiling
+ *
+ * Turning profiling off discards the recorded counters.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetProfiling( HYPRE_Int on )
+{
+   hypre_Profile *profile = hypre_global_profile;
+
+   if (on && !profile)
+   {
+      profile = hypre_CTAlloc(hypre_Profile, 1, HYPRE_MEMORY_HOST);
+      hypre_ProfileMaxLevels(profile) = 0;
+      hypre_ProfileDepth(profile)     = 0;
+      hypre_ProfileResize(profile, 16);
+
+      hypre_global_profile = profile;
+   }
+   else if (!on && profile)
+   {
+      hypre_TFree(hypre_ProfileData(profile), HYPRE_MEMORY_HOST);
+      hypre_TFree(profile, HYPRE_MEMORY_HOST);
+
+      hypre_global_profile = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfileClear
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfileClear( void )
+{
+   hypre_Profile *profile = hypre_global_profile;
+
+   if (profile)
+   {
+      hypre_Memset(hypre_ProfileData(profile), 0,
+                   HYPRE_PROFILE_NUM_SOLVERS * hypre_ProfileMaxLevels(profile) *
+                   HYPRE_PROFILE_ENTRY_SIZE * sizeof(HYPRE_Real), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ProfilePrint
+ *
+ * Every rank writes its counters to <prefix>.<rank>.json and rank 0 writes
+ * the aggregate over all ranks to <prefix>.summary.json: time minimum,
+ * average and maximum, call count maximum and the sum of the other
+ * counters.  Rates in the summary are relative to the maximum time.
+ * Only (solver, level, phase) entries that were entered are written.
+ * Collective over comm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ProfilePrint( MPI_Comm    comm,
+                    const char *prefix )
+{
+   hypre_Profile *profile = hypre_global_profile;
+   HYPRE_Int      my_id, num_procs;
+   HYPRE_Int      max_levels, size;
+   HYPRE_Int      s, l, p, c, first;
+   HYPRE_Real    *local, *sums, *mins, *maxs, *entry;
+   char           filename[1024];
+   FILE          *fp;
+
+   if (!profile)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Profiling is not turned on!");
+      return hypre_error_flag;
+   }
+   if (!prefix)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* Per-rank output */
+   hypre_snprintf(filename, sizeof(filename), "%s.%d.json", prefix, my_id);
+   /* A rank that cannot write its file still joins the reductions below */
+   if ((fp = fopen(filename, "w")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open profile output file!");
+   }
+   else
+   {
+      hypre_fprintf(fp, "{\n  \"rank\": %d,\n  \"num_ranks\": %d,\n  \"regions\": [", my_id, num_procs);
+      first = 1;
+      for (s = 0; s < HYPRE_PROFILE_NUM_SOLVERS; s++)
+      {
+         for (l = 0; l < hypre_ProfileMaxLevels(profile); l++)
+         {
+            for (p = 0; p < HYPRE_PROFILE_NUM_PHASES; p++)
+            {
+               entry = hypre_ProfileEntry(profile, s, l, p);
+               if (entry[HYPRE_PROFILE_CALLS] == 0.0)
+               {
+                  continue;
+               }
+               hypre_fprintf(fp, "%s\n    {\"solver\": \"%s\", \"level\": %d, \"phase\": \"%s\"",
+                             first ? "" : ",", hypre_profile_solver_names[s], l,
+                             hypre_profile_phase_names[p]);
+               for (c = 0; c < HYPRE_PROFILE_NUM_COUNTERS; c++)
+               {
+                  hypre_fprintf(fp, (c == HYPRE_PROFILE_CALLS || c == HYPRE_PROFILE_MESSAGES) ?
+                                ", \"%s\": %.0f" : ", \"%s\": %.9e",
+                                hypre_profile_counter_names[c], entry[c]);
+               }
+               hypre_fprintf(fp, "}");
+               first = 0;
+            }
+         }
+      }
+      hypre_fprintf(fp, "\n  ]\n}\n");
+      fclose(fp);
+   }
+
+   /* Aggregate over ranks with a common number of levels */
+   hypre_MPI_Allreduce(&hypre_ProfileMaxLevels(profile), &max_levels, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MAX, comm);
+   size  = HYPRE_PROFILE_NUM_SOLVERS * max_levels * HYPRE_PROFILE_ENTRY_SIZE;
+   local = hypre_CTAlloc(HYPRE_Real, 2 * size, HYPRE_MEMORY_HOST);
+   sums  = hypre_CTAlloc(HYPRE_Real, 3 * size, HYPRE_MEMORY_HOST);
+   mins  = sums + size;
+   maxs  = sums + 2 * size;
+   for (s = 0; s < HYPRE_PROFILE_NUM_SOLVERS; s++)
+   {
+      hypre_TMemcpy(local + s * max_levels * HYPRE_PROFILE_ENTRY_SIZE,
+                    hypre_ProfileData(profile) +
+                    s * hypre_ProfileMaxLevels(profile) * HYPRE_PROFILE_ENTRY_SIZE,
+                    HYPRE_Real, hypre_ProfileMaxLevels(profile) * HYPRE_PROFILE_ENTRY_SIZE,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /* The minimum time only considers ranks that entered the region */
+   for (c = 0; c < size; c += HYPRE_PROFILE_NUM_COUNTERS)
+   {
+      local[size + c] = (local[c + HYPRE_PROFILE_CALLS] > 0.0) ?
+                        local[c + HYPRE_PROFILE_TIME] : HYPRE_REAL_MAX;
+   }
+   hypre_MPI_Reduce(local, sums, size, HYPRE_MPI_REAL, hypre_MPI_SUM, 0, comm);
+   hypre_MPI_Reduce(local + size, mins, size, HYPRE_MPI_REAL, hypre_MPI_MIN, 0, comm);
+   hypre_MPI_Reduce(local, maxs, size, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, comm);
+
+   if (my_id == 0)
+   {
+      hypre_snprintf(filename, sizeof(filename), "%s.summary.json", prefix);
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open profile output file!");
+      }
+      else
+      {
+         hypre_fprintf(fp, "{\n  \"num_ranks\": %d,\n  \"regions\": [", num_procs);
+         first = 1;
+         for (s = 0; s < HYPRE_PROFILE_NUM_SOLVERS; s++)
+         {
+            for (l = 0; l < max_levels; l++)
+            {
+               for (p = 0; p < HYPRE_PROFILE_NUM_PHASES; p++)
+               {
+                  HYPRE_Int   i = ((s * max_levels + l) * HYPRE_PROFILE_NUM_PHASES + p) *
+                                  HYPRE_PROFILE_NUM_COUNTERS;
+                  HYPRE_Real  time_max = maxs[i + HYPRE_PROFILE_TIME];
+
+                  if (maxs[i + HYPRE_PROFILE_CALLS] == 0.0)
+                  {
+                     continue;
+                  }
+                  hypre_fprintf(fp, "%s\n    {\"solver\": \"%s\", \"level\": %d, \"phase\": \"%s\"",
+                                first ? "" : ",", hypre_profile_solver_names[s], l,
+                                hypre_profile_phase_names[p]);
+                  hypre_fprintf(fp, ", \"calls\": %.0f", maxs[i + HYPRE_PROFILE_CALLS]);
+                  hypre_fprintf(fp, ", \"time_min\": %.9e, \"time_avg\": %.9e, \"time_max\": %.9e",
+                                mins[i + HYPRE_PROFILE_TIME],
+                                sums[i + HYPRE_PROFILE_TIME] / (HYPRE_Real) num_procs, time_max);
+                  for (c = HYPRE_PROFILE_FLOPS; c < HYPRE_PROFILE_NUM_COUNTERS; c++)
+                  {
+                     hypre_fprintf(fp, (c == HYPRE_PROFILE_MESSAGES) ?
+                                   ", \"%s\": %.0f" : ", \"%s\": %.9e",
+                                   hypre_profile_counter_names[c], sums[i + c]);
+                  }
+                  hypre_fprintf(fp, ", \"gflops_per_s\": %.9e, \"gbytes_per_s\": %.9e}",
+                                time_max > 0.0 ? 1.0e-9 * sums[i + HYPRE_PROFILE_FLOPS] / time_max : 0.0,
+                                time_max > 0.0 ? 1.0e-9 * sums[i + HYPRE_PROFILE_BYTES] / time_max : 0.0);
+                  first = 0;
+               }
+            }
+         }
+         hypre_fprintf(fp, "\n  ]\n}\n");
+         fclose(fp);
+      }
+   }
+
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+   hypre_TFree(sums, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the per-level solver profiler
+ *
+ *****************************************************************************/
+
+#ifndef hypre_PROFILE_HEADER
+#define hypre_PROFILE_HEADER
+
+/*--------------------------------------------------------------------------
+ * Solvers and phases recorded by the profiler
+ *--------------------------------------------------------------------------*/
+
+typedef enum hypre_ProfileSolver_enum
+{
+   HYPRE_PROFILE_BOOMERAMG = 0,
+   HYPRE_PROFILE_MGR,
+   HYPRE_PROFILE_ILU,
+   HYPRE_PROFILE_PCG,
+   HYPRE_PROFILE_GMRES,
+   HYPRE_PROFILE_NUM_SOLVERS
+} hypre_ProfileSolver;
+
+typedef enum hypre_ProfilePhase_enum
+{
+   /* setup */
+   HYPRE_PROFILE_SETUP = 0,        /* whole setup, level 0 */
+   HYPRE_PROFILE_STRENGTH,
+   HYPRE_PROFILE_COARSEN,
+   HYPRE_PROFILE_INTERP,           /* transfer operators */
+   HYPRE_PROFILE_RAP,
+   HYPRE_PROFILE_COARSE_SETUP,
+   HYPRE_PROFILE_FACTOR,
+   HYPRE_PROFILE_SMOOTHER_SETUP,
+
+   /* solve */
+   HYPRE_PROFILE_SOLVE,            /* whole solve, level 0 */
+   HYPRE_PROFILE_RELAX,
+   HYPRE_PROFILE_RESIDUAL,
+   HYPRE_PROFILE_RESTRICT,
+   HYPRE_PROFILE_INTERP_APPLY,
+   HYPRE_PROFILE_COARSE_SOLVE,
+   HYPRE_PROFILE_TRISOLVE,
+   HYPRE_PROFILE_MATVEC,
+   HYPRE_PROFILE_PRECOND,
+
+   HYPRE_PROFILE_NUM_PHASES
+} hypre_ProfilePhase;
+
+/* counters kept for every (solver, level, phase) */
+typedef enum hypre_ProfileCounter_enum
+{
+   HYPRE_PROFILE_TIME = 0,         /* wall time in seconds */
+   HYPRE_PROFILE_CALLS,
+   HYPRE_PROFILE_FLOPS,            /* estimate */
+   HYPRE_PROFILE_BYTES,            /* estimated memory traffic */
+   HYPRE_PROFILE_MESSAGES,         /* point-to-point messages posted */
+   HYPRE_PROFILE_MESSAGE_BYTES,    /* bytes sent and received */
+   HYPRE_PROFILE_NUM_COUNTERS
+} hypre_ProfileCounter;
+
+#define HYPRE_PROFILE_MAX_DEPTH 32
+
+/*--------------------------------------------------------------------------
+ * hypre_Profile:
+ *
+ * data holds the counters as [solver][level][phase][counter] for max_levels
+ * levels.  The open regions are kept on a stack of at most
+ * HYPRE_PROFILE_MAX_DEPTH entries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int    max_levels;
+   HYPRE_Real  *data;
+
+   HYPRE_Int    depth;
+   HYPRE_Int    solver[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Int    level[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Int    phase[HYPRE_PROFILE_MAX_DEPTH];
+   HYPRE_Real   start[HYPRE_PROFILE_MAX_DEPTH];
+
+} hypre_Profile;
+
+#define hypre_ProfileMaxLevels(profile)  ((profile) -> max_levels)
+#define hypre_ProfileData(profile)       ((profile) -> data)
+#define hypre_ProfileDepth(profile)      ((profile) -> depth)
+
+#define hypre_ProfileEntry(profile, s, l, p) \
+   (hypre_ProfileData(profile) + \
+    (((s) * hypre_ProfileMaxLevels(profile) + (l)) * HYPRE_PROFILE_NUM_PHASES + (p)) * \
+    HYPRE_PROFILE_NUM_COUNTERS)
+
+/* NULL unless profiling was turned on with HYPRE_SetProfiling */
+extern hypre_Profile *hypre_global_profile;
+
+#define hypre_ProfileActive() (hypre_global_profile != NULL)
+
+/*--------------------------------------------------------------------------
+ * Prototypes
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ProfileBegin( HYPRE_Int solver, HYPRE_Int level, HYPRE_Int phase );
+HYPRE_Int hypre_ProfileEnd( void );
+HYPRE_Int hypre_ProfileAddWork( HYPRE_Real flops, HYPRE_Real bytes );
+HYPRE_Int hypre_ProfileAddSpMV( HYPRE_Real nnz, HYPRE_Real num_rows, HYPRE_Real num_cols,
+                                HYPRE_Int num_vectors );
+HYPRE_Int hypre_ProfileAddComm( HYPRE_Int num_messages, HYPRE_Real num_bytes );
+
+#endif /* hypre_PROFILE_HEADER */
+
@@ -361,6 +361,12 @@ HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 /* handle.c */
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVSellCSigma( HYPRE_Int chunk_size, HYPRE_Int sigma );
+HYPRE_Int hypre_SetSpGemmHostAccumulator( HYPRE_Int dense_ncols, HYPRE_Int hash_max );
+HYPRE_Int hypre_SetStructBoxLoopTiling( HYPRE_Int tile_x, HYPRE_Int tile_y, HYPRE_Int tile_z );
+HYPRE_Int hypre_SetStructFirstTouch( HYPRE_Int first_touch );
+HYPRE_Int hypre_SetStructOverlapCommComp( HYPRE_Int overlap );
+HYPRE_Int hypre_SetParCSRPersistentComm( HYPRE_Int persistent );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );